@@ -0,0 +1,92 @@
+/**
+ * @file    DequeBench.cpp
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   dsa::deque against std::deque when the size oscillates, as a queue and as a stack
+ *
+ * usage: deque_bench [elements moved per configuration, default 20000000]
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <new>
+
+#include "Deque.h"
+
+namespace {
+    std::size_t allocations = 0;                                        // operator new calls, single-threaded
+
+    /* a large element: libstdc++ puts 2 of them in a 512-byte block */
+    struct record {
+        std::uint64_t id;
+        char payload[248] = {};
+    };
+
+    std::uint64_t key(std::uint64_t v) { return v; }
+    std::uint64_t key(const record& r) { return r.id; }
+
+    struct result {
+        double ns_per_element;
+        std::size_t allocations;
+    };
+
+    /* fill to amplitude then drain, FIFO or LIFO, until moved elements have gone through */
+    template <class Container>
+    result oscillate(std::size_t amplitude, std::size_t moved, bool fifo) {
+        using value_type = typename Container::value_type;
+        Container c;
+        std::uint64_t sum = 0;
+        const std::size_t before = allocations;
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t done = 0; done < moved; done += amplitude) {
+            for (std::size_t i = 0; i < amplitude; ++i) c.push_back(value_type{i});
+            for (std::size_t i = 0; i < amplitude; ++i) {
+                if (fifo) {
+                    sum += key(c.front());
+                    c.pop_front();
+                } else {
+                    sum += key(c.back());
+                    c.pop_back();
+                }
+            }
+        }
+        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        if (sum == 1) std::puts("");                                    // keep the loops
+        const std::size_t rounds = (moved + amplitude - 1) / amplitude;
+        return {elapsed.count() / static_cast<double>(rounds * amplitude), allocations - before};
+    }
+
+    template <class T>
+    void compare(const char* name, std::size_t moved) {
+        for (bool fifo : {true, false}) {
+            for (std::size_t amplitude : {std::size_t{16}, std::size_t{1000}, std::size_t{100000}}) {
+                const result a = oscillate<dsa::deque<T>>(amplitude, moved, fifo);
+                const result b = oscillate<std::deque<T>>(amplitude, moved, fifo);
+                std::printf("%-8s %-5s %-9zu %9.2f ns %9zu %9.2f ns %9zu\n", name, fifo ? "fifo" : "lifo",
+                            amplitude, a.ns_per_element, a.allocations, b.ns_per_element, b.allocations);
+            }
+        }
+    }
+}
+
+void* operator new(std::size_t n) {
+    ++allocations;
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+int main(int argc, char** argv) {
+    const std::size_t moved = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000000;
+    std::printf("%-8s %-5s %-9s %12s %9s %12s %9s\n", "element", "order", "amplitude", "dsa::deque", "allocs", "std::deque", "allocs");
+    compare<std::uint64_t>("uint64", moved);
+    compare<record>("record", moved / 8);
+    return 0;
+}
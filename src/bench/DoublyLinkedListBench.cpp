@@ -0,0 +1,92 @@
+/**
+ * @file    DoublyLinkedListBench.cpp
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   doubly_linked_list against its pre-sentinel version and std::list on erase patterns
+ *          that defeat branch prediction
+ *
+ * usage: doubly_linked_list_bench [nodes per configuration, default 1000000]
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "DoublyLinkedList.h"
+#include "NullTerminatedList.h"
+
+namespace {
+    template <class F>
+    double ns_per_op(std::size_t ops, F&& body) {
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / static_cast<double>(ops);
+    }
+
+    /* erase every node through a saved iterator, in random order: head, tail and middle mixed */
+    template <class List>
+    double shuffled_erase(std::size_t n) {
+        List list;
+        for (std::size_t i = 0; i < n; ++i) list.push_back(static_cast<int>(i));
+        std::vector<typename List::iterator> nodes;
+        nodes.reserve(n);
+        for (auto it = list.begin(); it != list.end(); ++it) nodes.push_back(it);
+        std::shuffle(nodes.begin(), nodes.end(), std::mt19937_64{42});
+        return ns_per_op(n, [&] {
+            for (typename List::iterator it : nodes) list.erase(it);
+        });
+    }
+
+    /*
+     * a list that stays between 0 and 3 nodes, pushed and popped at a random end: the empty,
+     * single-node, head and tail cases come in no predictable order
+    */
+    template <class List>
+    double random_ends(std::size_t ops) {
+        List list;
+        std::mt19937_64 rng{7};
+        std::vector<std::uint8_t> choice(ops);
+        for (std::uint8_t& c : choice) c = static_cast<std::uint8_t>(rng() % 4);
+        long sum = 0;
+        const double ns = ns_per_op(ops, [&] {
+            for (std::size_t i = 0; i < ops; ++i) {
+                const std::uint8_t c = choice[i];
+                if (list.empty() || (list.size() < 3 && c < 2)) {
+                    if (c & 1) list.push_front(static_cast<int>(i));
+                    else list.push_back(static_cast<int>(i));
+                } else if (c & 1) {
+                    sum += list.front();
+                    list.pop_front();
+                } else {
+                    sum += list.back();
+                    list.pop_back();
+                }
+            }
+        });
+        if (sum == 1) std::puts("");                                    // keep the loop
+        return ns;
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    std::printf("%-16s %10s %22s %22s %14s\n", "workload", "nodes", "doubly_linked_list", "null_terminated_list", "std::list");
+    for (std::size_t size : {n / 100, n}) {
+        std::printf("%-16s %10zu %19.2f ns %19.2f ns %11.2f ns\n", "shuffled erase", size,
+                    shuffled_erase<dsa::doubly_linked_list<int>>(size), shuffled_erase<dsa::null_terminated_list<int>>(size),
+                    shuffled_erase<std::list<int>>(size));
+    }
+    std::printf("%-16s %10s %19.2f ns %19.2f ns %11.2f ns\n", "random ends", "0-3",
+                random_ends<dsa::doubly_linked_list<int>>(n * 10), random_ends<dsa::null_terminated_list<int>>(n * 10),
+                random_ends<std::list<int>>(n * 10));
+    return 0;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file    MmapQueueBench.cpp
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   mmap_queue throughput with each sync_policy, on tmpfs and on disk
+ *
+ * usage: mmap_queue_bench [records, default 200000] [directories..., default /dev/shm .]
+ *      Pass a tmpfs mount and a directory on a disk; every_push runs 1/100 of the records.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unistd.h>
+
+#include "MmapQueue.h"
+
+namespace {
+    constexpr std::size_t record_bytes = 128;
+    constexpr std::size_t batch = 64;
+
+    double seconds_since(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    const char* name(dsa::sync_policy policy) {
+        switch (policy) {
+            case dsa::sync_policy::none: return "none";
+            case dsa::sync_policy::batch: return "batch";
+            default: return "every_push";
+        }
+    }
+
+    /* push n records one by one, then n in batches, then pop all of them; records/s each */
+    void run(const std::filesystem::path& dir, dsa::sync_policy policy, std::size_t n) {
+        std::filesystem::remove_all(dir);
+        const std::string record(record_bytes, 'r');
+        double push_rate, batch_rate, pop_rate;
+        {
+            dsa::mmap_queue q{dir, {std::size_t{16} << 20, policy}};
+            auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < n; ++i) q.push(record);
+            push_rate = static_cast<double>(n) / seconds_since(start);
+
+            const std::vector<std::string_view> records(batch, record);
+            start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < n; i += batch) q.push_batch(records);
+            batch_rate = static_cast<double>((n + batch - 1) / batch * batch) / seconds_since(start);
+
+            std::size_t popped = 0, bytes = 0;
+            start = std::chrono::steady_clock::now();
+            for (; !q.empty(); ++popped) {
+                bytes += q.front().size();
+                q.pop();
+            }
+            pop_rate = static_cast<double>(popped) / seconds_since(start);
+            if (bytes == 1) std::puts("");                              // keep the reads
+        }
+        std::filesystem::remove_all(dir);
+        std::printf("%-24s %-11s %9zu %12.0f/s %12.0f/s %12.0f/s %9.1f MB/s\n", dir.parent_path().c_str(), name(policy), n,
+                    push_rate, batch_rate, pop_rate, batch_rate * record_bytes / 1e6);
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    std::vector<std::filesystem::path> roots;
+    for (int i = 2; i < argc; ++i) roots.emplace_back(argv[i]);
+    if (roots.empty()) roots = {"/dev/shm", "."};
+
+    std::printf("%-24s %-11s %9s %14s %14s %14s %14s\n", "directory", "sync", "records", "push()", "push_batch()", "pop()", "batch MB/s");
+    for (const std::filesystem::path& root : roots) {
+        const std::filesystem::path dir = root / ("dsa-mmap-queue-bench-" + std::to_string(::getpid()));
+        for (dsa::sync_policy policy : {dsa::sync_policy::none, dsa::sync_policy::batch, dsa::sync_policy::every_push})
+            run(dir, policy, policy == dsa::sync_policy::every_push ? std::max<std::size_t>(n / 100, batch) : n);
+    }
+    return 0;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file    SkipListBench.cpp
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   skip_list against a std::map behind a reader-writer lock, 1 to 64 threads
+ *
+ * usage: skip_list_bench [operations per configuration, default 2000000]
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "SkipList.h"
+
+namespace {
+    constexpr std::uint64_t key_range = 1 << 16;
+
+    /* the incumbent: every lookup takes the lock shared, every update exclusive */
+    struct locked_map {
+        std::map<std::uint64_t, std::uint64_t> map;
+        mutable std::shared_mutex lock;
+
+        bool insert(std::uint64_t k, std::uint64_t v) {
+            std::unique_lock guard{lock};
+            return map.emplace(k, v).second;
+        }
+
+        bool erase(std::uint64_t k) {
+            std::unique_lock guard{lock};
+            return map.erase(k) != 0;
+        }
+
+        bool contains(std::uint64_t k) const {
+            std::shared_lock guard{lock};
+            return map.contains(k);
+        }
+    };
+
+    /* run ops operations over the threads, read_pct percent of them lookups; return Mop/s */
+    template <class Map>
+    double run(Map& map, unsigned threads, unsigned read_pct, std::uint64_t ops) {
+        std::vector<std::thread> workers;
+        const std::uint64_t per_thread = ops / threads;
+        const auto start = std::chrono::steady_clock::now();
+        for (unsigned t = 0; t < threads; ++t) {
+            workers.emplace_back([&map, t, read_pct, per_thread] {
+                std::mt19937_64 rng{t + 1};
+                std::uint64_t hits = 0;
+                for (std::uint64_t i = 0; i < per_thread; ++i) {
+                    const std::uint64_t r = rng();
+                    const std::uint64_t k = r % key_range;
+                    if ((r >> 32) % 100 < read_pct) hits += map.contains(k);
+                    else if ((r >> 40) & 1) hits += map.insert(k, i);
+                    else hits += map.erase(k);
+                }
+                if (hits == ~std::uint64_t{0}) std::puts("");           // keep the loop
+            });
+        }
+        for (std::thread& w : workers) w.join();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return static_cast<double>(per_thread * threads) / elapsed.count() / 1e6;
+    }
+
+    template <class Map>
+    void prefill(Map& map) {
+        for (std::uint64_t k = 0; k < key_range; k += 2) map.insert(k, k);
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::uint64_t ops = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+    std::printf("%-8s %-6s %14s %14s %8s\n", "threads", "read%", "skip_list", "locked map", "ratio");
+    for (unsigned read_pct : {50u, 90u, 99u}) {
+        for (unsigned threads = 1; threads <= 64; threads *= 2) {
+            dsa::skip_list<std::uint64_t, std::uint64_t> list;
+            locked_map map;
+            prefill(list);
+            prefill(map);
+            const double a = run(list, threads, read_pct, ops);
+            const double b = run(map, threads, read_pct, ops);
+            std::printf("%-8u %-6u %10.2f Mop/s %10.2f Mop/s %7.2fx\n", threads, read_pct, a, b, a / b);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file    TimerWheelBench.cpp
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   timer_wheel against a std::priority_queue timer at 1M and 10M pending timers
+ *
+ * usage: timer_wheel_bench [pending timers...], default 1000000 10000000
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include "TimerWheel.h"
+
+namespace {
+    constexpr std::uint64_t horizon = 1 << 20;                          // ticks the expiries spread over
+    constexpr std::uint64_t step = 1024;                                // ticks per advance()
+
+    /* the usual heap timer: cancel marks the timer, advance() drops marked ones as they surface */
+    class heap_timer {
+            struct entry {
+                std::uint64_t expiry;
+                std::uint64_t id;
+                bool operator>(const entry& x) const noexcept { return expiry > x.expiry; }
+            };
+
+            std::priority_queue<entry, std::vector<entry>, std::greater<entry>> heap;
+            std::vector<bool> cancelled;
+
+        public:
+            using handle = std::uint64_t;
+
+            handle schedule(std::uint64_t expiry, std::uint64_t payload) {
+                heap.push({expiry, payload});
+                cancelled.push_back(false);
+                return payload;
+            }
+
+            void cancel(handle h) { cancelled[h] = true; }
+
+            template <class F>
+            std::size_t advance(std::uint64_t now, F&& on_expire) {
+                std::size_t fired = 0;
+                while (!heap.empty() && heap.top().expiry <= now) {
+                    std::uint64_t id = heap.top().id;
+                    heap.pop();
+                    if (cancelled[id]) continue;
+                    on_expire(id);
+                    ++fired;
+                }
+                return fired;
+            }
+    };
+
+    struct result {
+        double schedule_ns;
+        double cancel_ns;
+        double advance_ns;
+        std::size_t fired;
+    };
+
+    double elapsed_ns(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /* schedule n timers over the horizon, cancel every other one, then run the clock out */
+    template <class Timer>
+    result run(std::size_t n) {
+        std::mt19937_64 rng{1};
+        std::vector<std::uint64_t> expiry(n);
+        for (std::uint64_t& e : expiry) e = 1 + rng() % horizon;
+
+        Timer timer;
+        std::vector<typename Timer::handle> handles;
+        handles.reserve(n);
+        result r{};
+
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < n; ++i) handles.push_back(timer.schedule(expiry[i], i));
+        r.schedule_ns = elapsed_ns(start) / static_cast<double>(n);
+
+        start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < n; i += 2) timer.cancel(handles[i]);
+        r.cancel_ns = elapsed_ns(start) / static_cast<double>(n / 2);
+
+        std::uint64_t sum = 0;
+        start = std::chrono::steady_clock::now();
+        for (std::uint64_t now = step; now <= horizon + step; now += step)
+            r.fired += timer.advance(now, [&sum](std::uint64_t p) { sum += p; });
+        r.advance_ns = elapsed_ns(start) / static_cast<double>(n);
+        if (sum == 1) std::puts("");                                    // keep the callbacks
+        return r;
+    }
+
+    void print(const char* name, std::size_t n, const result& r) {
+        std::printf("%-14s %10zu %12.2f ns %12.2f ns %12.2f ns %10zu\n", name, n, r.schedule_ns, r.cancel_ns, r.advance_ns, r.fired);
+    }
+}
+
+int main(int argc, char** argv) {
+    std::vector<std::size_t> sizes;
+    for (int i = 1; i < argc; ++i) sizes.push_back(std::strtoull(argv[i], nullptr, 10));
+    if (sizes.empty()) sizes = {1000000, 10000000};
+
+    std::printf("%-14s %10s %15s %15s %15s %10s\n", "timer", "pending", "schedule", "cancel", "advance/timer", "fired");
+    for (std::size_t n : sizes) {
+        print("timer_wheel", n, run<dsa::timer_wheel<std::uint64_t>>(n));
+        print("priority_queue", n, run<heap_timer>(n));
+    }
+    return 0;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file    TrivialTypesBench.cpp
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   the trivially copyable and relocatable fast paths on clear, erase-range and bulk copy
+ *
+ * Every operation runs twice, on a trivial element and on a twin with the same layout whose
+ * out-of-line copy and destructor make it non-trivial, so the difference is the fast path.
+ *
+ * usage: trivial_types_bench [elements per configuration, default 1000000]
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <random>
+#include <type_traits>
+
+#include "Deque.h"
+#include "DoublyLinkedList.h"
+#include "FlatHashMap.h"
+#include "SmallVector.h"
+
+namespace {
+    struct plain {
+        std::uint64_t v;
+    };
+
+    /* counts the copies and destructions of guarded, so the optimizer has to run every one */
+    std::uint64_t guarded_calls = 0;
+
+    struct guarded {
+        std::uint64_t v;
+
+        guarded(std::uint64_t x) : v{x} {}
+        [[gnu::noinline]] guarded(const guarded& x);
+        [[gnu::noinline]] guarded& operator=(const guarded& x);
+        [[gnu::noinline]] ~guarded();
+    };
+
+    guarded::guarded(const guarded& x) : v{x.v} { ++guarded_calls; }
+
+    guarded& guarded::operator=(const guarded& x) {
+        v = x.v;
+        ++guarded_calls;
+        return *this;
+    }
+
+    guarded::~guarded() { ++guarded_calls; }
+
+    /* the same type, declared relocatable: defragment() memcpy's it */
+    struct relocatable : guarded {
+        using guarded::guarded;
+    };
+
+    static_assert(std::is_trivially_copyable_v<plain> && !std::is_trivially_copyable_v<guarded>);
+}
+
+template <>
+struct dsa::is_trivially_relocatable<relocatable> : std::true_type {};
+
+namespace {
+    template <class F>
+    double ms(F&& body) {
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    template <class T>
+    dsa::doubly_linked_list<T> make_list(std::size_t n) {
+        dsa::doubly_linked_list<T> list;
+        for (std::size_t i = 0; i < n; ++i) list.push_back(T{i});
+        return list;
+    }
+
+    template <class T>
+    double list_clear(std::size_t n) {
+        dsa::doubly_linked_list<T> list = make_list<T>(n);
+        return ms([&] { list.clear(); });
+    }
+
+    template <class T>
+    double list_erase_range(std::size_t n) {
+        dsa::doubly_linked_list<T> list = make_list<T>(n);
+        auto first = std::next(list.begin(), static_cast<std::ptrdiff_t>(n / 4));
+        auto last = std::next(first, static_cast<std::ptrdiff_t>(n / 2));
+        return ms([&] { list.erase(first, last); });
+    }
+
+    template <class T>
+    double list_copy(std::size_t n) {
+        const dsa::doubly_linked_list<T> list = make_list<T>(n);
+        return ms([&] { dsa::doubly_linked_list<T> copy{list}; });
+    }
+
+    template <class T>
+    double list_defragment(std::size_t n) {
+        dsa::doubly_linked_list<T> list = make_list<T>(n);
+        std::mt19937_64 rng{3};
+        for (auto it = list.begin(); it != list.end();) it = rng() & 1 ? list.erase(it) : std::next(it);
+        return ms([&] { list.defragment(); });
+    }
+
+    template <class T>
+    double deque_copy(std::size_t n) {
+        dsa::deque<T> d;
+        for (std::size_t i = 0; i < n; ++i) d.push_back(T{i});
+        return ms([&] { dsa::deque<T> copy{d}; });
+    }
+
+    template <class T>
+    double small_vector_copy(std::size_t n) {
+        dsa::small_vector<T, 16> v;
+        for (std::size_t i = 0; i < n; ++i) v.push_back(T{i});
+        return ms([&] { dsa::small_vector<T, 16> copy{v}; });
+    }
+
+    template <class T>
+    double flat_hash_map_copy(std::size_t n) {
+        dsa::flat_hash_map<std::uint64_t, T> map;
+        for (std::size_t i = 0; i < n; ++i) map.try_emplace(i, T{i});
+        return ms([&] { dsa::flat_hash_map<std::uint64_t, T> copy{map}; });
+    }
+
+    void print(const char* name, double trivial, double other) {
+        std::printf("%-26s %11.3f ms %11.3f ms %7.2fx\n", name, trivial, other, other / trivial);
+    }
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    std::printf("%zu elements\n%-26s %14s %14s %8s\n", n, "operation", "trivial", "non-trivial", "gain");
+    print("list clear", list_clear<plain>(n), list_clear<guarded>(n));
+    print("list erase(first, last)", list_erase_range<plain>(n), list_erase_range<guarded>(n));
+    print("list copy", list_copy<plain>(n), list_copy<guarded>(n));
+    print("deque copy", deque_copy<plain>(n), deque_copy<guarded>(n));
+    print("small_vector copy", small_vector_copy<plain>(n), small_vector_copy<guarded>(n));
+    print("flat_hash_map copy", flat_hash_map_copy<plain>(n), flat_hash_map_copy<guarded>(n));
+    print("list defragment (opt-in)", list_defragment<relocatable>(n), list_defragment<guarded>(n));
+    std::printf("%llu copies and destructions of the non-trivial twin\n", static_cast<unsigned long long>(guarded_calls));
+    return 0;
+}
@@ -0,0 +1,565 @@
+/**
+ * @file    AdaptiveContainer.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A ring that lives inline while small, moves to the heap when it grows and back when it shrinks
+*/
+
+#ifndef ADAPTIVE_CONTAINER_H
+#define ADAPTIVE_CONTAINER_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "Algorithm.h"
+#include "ErrorPolicy.h"
+#include "MemoryUsage.h"
+#include "TypeTraits.h"
+
+namespace dsa {
+    /**
+     * @brief where an adaptive_container spent its operations, see adaptive_container::stats()
+     *
+     * Time is counted in pushes and pops rather than read from a clock, which would cost more
+     * than the operations themselves.
+    */
+    struct adaptive_stats {
+        std::uint64_t inline_ops = 0;       //!< pushes and pops done on the inline ring
+        std::uint64_t heap_ops = 0;         //!< pushes and pops done on the heap ring
+        std::uint64_t promotions = 0;       //!< moves from the inline to the heap ring
+        std::uint64_t demotions = 0;        //!< moves from the heap back to the inline ring
+        std::uint64_t shrinks = 0;          //!< halvings of the heap ring
+        std::size_t peak_size = 0;          //!< largest size seen
+
+        /** @brief return the fraction of the operations done inline, 1 before the first one */
+        double inline_share() const noexcept {
+            const std::uint64_t __ops = inline_ops + heap_ops;
+            return __ops == 0 ? 1.0 : static_cast<double>(inline_ops) / static_cast<double>(__ops);
+        }
+    };
+
+    /**
+     * @brief adaptive_container is a sequence container for dsa::queue and dsa::stack that
+     *      changes representation with its size. It starts as a ring of _N elements inside
+     *      the object, moves to a heap ring that doubles when full once it outgrows _N, halves
+     *      the heap ring after a sustained stretch below a quarter of its capacity, and moves
+     *      back inline after a sustained stretch at low occupancy.
+     *
+     * @tparam
+     *      _Tp the type of stored element
+     * @tparam
+     *      _N number of elements stored inline
+     * @tparam
+     *      _Policy what front/back/pop_front/pop_back on an empty container do, see ErrorPolicy.h
+     *
+     * @note
+     *      The hysteresis keeps an instance that hovers around _N from moving back and forth:
+     *      it is promoted when a push finds _N elements, but demoted only after
+     *      demote_after() consecutive pushes and pops that leave it with at most _N / 2
+     *      elements. The heap ring is halved the same way, after demote_after() consecutive
+     *      operations that leave it at most a quarter full, so a spike does not pin its peak
+     *      allocation while the size stays above _N / 2; halving never goes below 2 * _N and
+     *      leaves the ring at most half full. Demotion and halving need a _Tp that relocates
+     *      without throwing; for other types only shrink_to_fit() goes back inline. Elements are stored in at most two
+     *      contiguous runs, see segments(). Any push or pop may move the elements.
+    */
+    template <class _Tp, std::size_t _N = 16, class _Policy = unchecked_policy>
+    class adaptive_container {
+            static_assert(_N > 0, "adaptive_container needs an inline capacity");
+            static_assert(dsa::error_policy<_Policy>, "_Policy must be an error policy");
+
+            static constexpr bool __can_demote = is_trivially_relocatable_v<_Tp> || std::is_nothrow_move_constructible_v<_Tp>;
+
+        public:
+            using value_type = _Tp;                                     //!< value_type
+            using size_type = std::size_t;                              //!< size_type
+            using reference = _Tp&;                                     //!< reference
+            using const_reference = const _Tp&;                         //!< const_reference
+
+            /** @brief number of elements stored inline */
+            static constexpr size_type inline_capacity = _N;
+
+            /** @brief construct an empty inline container */
+            adaptive_container() noexcept : __data_{__inline_data()} {}
+
+            /** @brief copy constructor, the copy starts with fresh statistics */
+            adaptive_container(const adaptive_container& __x) : adaptive_container() {
+                __demote_after_ = __x.__demote_after_;
+                if (__x.__size_ > _N) __reallocate(__x.__capacity_);
+                for (std::span<const _Tp> __s : __x.segments()) {
+                    for (const _Tp& __e : __s) __push_unchecked(__e);
+                }
+            }
+
+            /** @brief move constructor, takes the heap ring and the statistics of __x */
+            adaptive_container(adaptive_container&& __x) noexcept(std::is_nothrow_move_constructible_v<_Tp>) : adaptive_container() {
+                __take(__x);
+            }
+
+            /** @brief copy assignment operator */
+            adaptive_container& operator=(const adaptive_container& __x) {
+                if (this != &__x) {
+                    clear();
+                    if (__x.__size_ > __capacity_) __reallocate(__x.__capacity_);
+                    for (std::span<const _Tp> __s : __x.segments()) {
+                        for (const _Tp& __e : __s) __push_unchecked(__e);
+                    }
+                }
+                return *this;
+            }
+
+            /** @brief move assignment operator */
+            adaptive_container& operator=(adaptive_container&& __x) noexcept(std::is_nothrow_move_constructible_v<_Tp>) {
+                if (this != &__x) {
+                    clear();
+                    __release();
+                    __take(__x);
+                }
+                return *this;
+            }
+
+            /** @brief default destructor */
+            ~adaptive_container() {
+                clear();
+                __release();
+            }
+
+            /** @brief push a copy of __x at the back */
+            void push_back(const _Tp& __x) { emplace_back(__x); }
+
+            /** @brief push __x at the back */
+            void push_back(_Tp&& __x) { emplace_back(std::move(__x)); }
+
+            /** @brief construct an element at the back from __args */
+            template <class... _Args>
+            reference emplace_back(_Args&&... __args) {
+                if (__size_ != __capacity_) [[likely]] {
+                    __push_unchecked(std::forward<_Args>(__args)...);
+                } else {
+                    __emplace_back_slow(std::forward<_Args>(__args)...);
+                }
+                if (__size_ > __stats_.peak_size) __stats_.peak_size = __size_;
+                __account();                                    /* may move the elements back inline */
+                return (*this)[__size_ - 1];
+            }
+
+            /** @brief remove the front element */
+            void pop_front() noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "pop_front on an empty adaptive_container");
+                std::destroy_at(__data_ + __head_);
+                __head_ = __head_ + 1 == __capacity_ ? 0 : __head_ + 1;
+                --__size_;
+                __account();
+            }
+
+            /** @brief remove the back element */
+            void pop_back() noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "pop_back on an empty adaptive_container");
+                std::destroy_at(&(*this)[__size_ - 1]);
+                --__size_;
+                __account();
+            }
+
+            /** @brief remove the front element and return it, std::nullopt if the container is empty */
+            std::optional<_Tp> try_pop_front() {
+                if (__size_ == 0) return std::nullopt;
+                std::optional<_Tp> __x{std::move(front())};
+                pop_front();
+                return __x;
+            }
+
+            /** @brief remove the back element and return it, std::nullopt if the container is empty */
+            std::optional<_Tp> try_pop_back() {
+                if (__size_ == 0) return std::nullopt;
+                std::optional<_Tp> __x{std::move(back())};
+                pop_back();
+                return __x;
+            }
+
+            /** @brief return a reference to the front element */
+            reference front() noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "front on an empty adaptive_container");
+                return __data_[__head_];
+            }
+
+            /** @brief return a constant reference to the front element */
+            const_reference front() const noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "front on an empty adaptive_container");
+                return __data_[__head_];
+            }
+
+            /** @brief return a reference to the back element */
+            reference back() noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "back on an empty adaptive_container");
+                return (*this)[__size_ - 1];
+            }
+
+            /** @brief return a constant reference to the back element */
+            const_reference back() const noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "back on an empty adaptive_container");
+                return (*this)[__size_ - 1];
+            }
+
+            /** @brief return the element __i positions from the front, no bounds checking */
+            reference operator[](size_type __i) noexcept { return __data_[__wrap(__head_ + __i)]; }
+
+            /** @brief return the element __i positions from the front, no bounds checking */
+            const_reference operator[](size_type __i) const noexcept { return __data_[__wrap(__head_ + __i)]; }
+
+            /** @brief check whether the container is empty */
+            bool empty() const noexcept { return __size_ == 0; }
+
+            /** @brief return the number of elements */
+            size_type size() const noexcept { return __size_; }
+
+            /** @brief return the number of elements that fit without moving */
+            size_type capacity() const noexcept { return __capacity_; }
+
+            /** @brief check whether the elements are stored inline */
+            bool is_inline() const noexcept { return __data_ == __inline_data(); }
+
+            /** @brief check whether __x and __y hold equal elements from the front, see dsa::equal() */
+            friend bool operator==(const adaptive_container& __x, const adaptive_container& __y) { return dsa::equal(__x, __y); }
+
+            /** @brief return the counters of the representations, see adaptive_stats */
+            const adaptive_stats& stats() const noexcept { return __stats_; }
+
+            /** @brief return the number of low-occupancy operations before moving back inline */
+            std::uint32_t demote_after() const noexcept { return __demote_after_; }
+
+            /** @brief set the number of low-occupancy operations before moving back inline, at least 1 */
+            void set_demote_after(std::uint32_t __ops) noexcept { __demote_after_ = std::max<std::uint32_t>(__ops, 1); }
+
+            /**
+             * @brief
+             *      return the elements as contiguous runs, front first
+             *
+             * @return
+             *      two spans; the second is empty unless the elements wrap around the end of
+             *      the storage
+            */
+            std::array<std::span<const _Tp>, 2> segments() const noexcept {
+                const size_type __first = std::min(__size_, __capacity_ - __head_);
+                return {std::span<const _Tp>{__data_ + __head_, __first}, std::span<const _Tp>{__data_, __size_ - __first}};
+            }
+
+            /** @brief remove every element, keeps the heap ring and the statistics */
+            void clear() noexcept {
+                if constexpr (!std::is_trivially_destructible_v<_Tp>) {
+                    for (size_type __i = 0; __i < __size_; ++__i) std::destroy_at(&(*this)[__i]);
+                }
+                __head_ = 0;
+                __size_ = 0;
+            }
+
+            void shrink_to_fit();
+
+            memory_footprint memory_usage() const noexcept;
+
+        private:
+            using __alloc_traits = std::allocator_traits<std::allocator<_Tp>>;
+
+            _Tp* __data_;                                           //!< __inline_data() or a heap ring of __capacity_ elements
+            size_type __head_ = 0;                                  //!< slot of the front element
+            size_type __size_ = 0;
+            size_type __capacity_ = _N;                             //!< _N while inline
+            std::uint32_t __low_ops_ = 0;                           //!< consecutive heap operations at or below _N / 2
+            std::uint32_t __sparse_ops_ = 0;                        //!< consecutive heap operations at or below __capacity_ / 4
+            std::uint32_t __demote_after_ = 256;
+            adaptive_stats __stats_;
+            alignas(_Tp) std::byte __inline_[_N * sizeof(_Tp)];     //!< inline storage
+
+            _Tp* __inline_data() noexcept { return std::launder(reinterpret_cast<_Tp*>(__inline_)); }
+            const _Tp* __inline_data() const noexcept { return std::launder(reinterpret_cast<const _Tp*>(__inline_)); }
+
+            /* slot of __i, which is below 2 * __capacity_ */
+            size_type __wrap(size_type __i) const noexcept { return __i >= __capacity_ ? __i - __capacity_ : __i; }
+
+            /* construct at the back of a container that is not full */
+            template <class... _Args>
+            void __push_unchecked(_Args&&... __args) {
+                ::new (static_cast<void*>(__data_ + __wrap(__head_ + __size_))) _Tp(std::forward<_Args>(__args)...);
+                ++__size_;
+            }
+
+            /* count the operation, then demote or halve the heap ring after a sustained stretch at low occupancy */
+            void __account() noexcept {
+                if (is_inline()) {
+                    ++__stats_.inline_ops;
+                    return;
+                }
+                ++__stats_.heap_ops;
+                if (__size_ > _N / 2) {
+                    __low_ops_ = 0;
+                } else if (++__low_ops_ >= __demote_after_) {
+                    if constexpr (__can_demote) __move_to(__inline_data(), _N);
+                    return;
+                }
+                if (__size_ > __capacity_ / 4 || __capacity_ / 2 < 2 * _N) {
+                    __sparse_ops_ = 0;
+                } else if (++__sparse_ops_ >= __demote_after_) {
+                    if constexpr (__can_demote) __shrink();
+                }
+            }
+
+            void __shrink() noexcept;
+
+            template <class... _Args>
+            void __emplace_back_slow(_Args&&... __args);
+
+            void __reallocate(size_type __cap);
+            void __move_to(_Tp* __buffer, size_type __cap) noexcept(__can_demote);
+            void __relocate(_Tp* __to) noexcept(__can_demote);
+            void __take(adaptive_container& __x) noexcept(std::is_nothrow_move_constructible_v<_Tp>);
+            void __release() noexcept;
+    };
+}   /* namespace dsa */
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Move the elements, front first, to the raw storage __to and destroy the sources
+**
+** @note
+**       One memcpy per run for a trivially relocatable _Tp. Otherwise the elements are
+**       moved, or copied when the move constructor may throw and a copy constructor
+**       exists, so a failure leaves the sources untouched.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N, class _Policy>
+void dsa::adaptive_container<_Tp, _N, _Policy>::__relocate(_Tp* __to) noexcept(__can_demote) {
+    const size_type __first = std::min(__size_, __capacity_ - __head_);
+    _Tp* const __run[2] = {__data_ + __head_, __data_};
+    const size_type __len[2] = {__first, __size_ - __first};
+    if constexpr (is_trivially_relocatable_v<_Tp>) {
+        for (int __r = 0; __r < 2; ++__r) {
+            if (__len[__r] != 0) std::memcpy(static_cast<void*>(__to), static_cast<const void*>(__run[__r]), __len[__r] * sizeof(_Tp));
+            __to += __len[__r];
+        }
+    } else {
+        if constexpr (std::is_nothrow_move_constructible_v<_Tp> || !std::is_copy_constructible_v<_Tp>) {
+            std::uninitialized_move_n(__run[1], __len[1], std::uninitialized_move_n(__run[0], __len[0], __to).second);
+        } else {
+            _Tp* __mid = std::uninitialized_copy_n(__run[0], __len[0], __to);
+            try {
+                std::uninitialized_copy_n(__run[1], __len[1], __mid);
+            } catch (...) {
+                std::destroy(__to, __mid);
+                throw;
+            }
+        }
+        std::destroy_n(__run[0], __len[0]);
+        std::destroy_n(__run[1], __len[1]);
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Move the elements to __buffer of __cap elements, the inline storage or a fresh heap
+**      ring, and free the old heap ring
+**
+** @note
+**       Complexity: O(n). Strong exception guarantee. Counts a promotion or a demotion
+**       when the representation changes.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N, class _Policy>
+void dsa::adaptive_container<_Tp, _N, _Policy>::__move_to(_Tp* __buffer, size_type __cap) noexcept(__can_demote) {
+    const bool __was_inline = is_inline();
+    __relocate(__buffer);
+    __release();
+    __data_ = __buffer;
+    __capacity_ = __cap;
+    __head_ = 0;
+    __low_ops_ = 0;
+    __sparse_ops_ = 0;
+    if (__was_inline != is_inline()) ++(__was_inline ? __stats_.promotions : __stats_.demotions);
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Move the elements to a heap ring of __cap elements, __cap > _N and __cap >= size()
+**
+** @note
+**       Complexity: O(n). Strong exception guarantee.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N, class _Policy>
+void dsa::adaptive_container<_Tp, _N, _Policy>::__reallocate(size_type __cap) {
+    typename __alloc_traits::allocator_type __a;
+    _Tp* __buffer = __alloc_traits::allocate(__a, __cap);
+    try {
+        __move_to(__buffer, __cap);
+    } catch (...) {
+        __alloc_traits::deallocate(__a, __buffer, __cap);
+        throw;
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Move the elements to a heap ring of half the capacity, called by __account() once the
+**      ring has stayed at most a quarter full for demote_after() operations
+**
+** @note
+**       Complexity: O(n). If the allocation fails the ring is kept and the count starts
+**       over, a pop must not throw for a shrink nobody asked for.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N, class _Policy>
+void dsa::adaptive_container<_Tp, _N, _Policy>::__shrink() noexcept {
+    try {
+        __reallocate(__capacity_ / 2);
+        ++__stats_.shrinks;
+    } catch (const std::bad_alloc&) {
+        __sparse_ops_ = 0;
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      emplace_back() into a full container: promote to, or double, the heap ring,
+**      constructing the new element before the old ones move so that __args may refer to
+**      one of them
+**
+** @note
+**       Complexity: O(n). Strong exception guarantee.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N, class _Policy>
+template <class... _Args>
+void dsa::adaptive_container<_Tp, _N, _Policy>::__emplace_back_slow(_Args&&... __args) {
+    const size_type __cap = 2 * __capacity_;
+    typename __alloc_traits::allocator_type __a;
+    _Tp* __buffer = __alloc_traits::allocate(__a, __cap);
+    _Tp* __slot = __buffer + __size_;
+    try {
+        ::new (static_cast<void*>(__slot)) _Tp(std::forward<_Args>(__args)...);
+    } catch (...) {
+        __alloc_traits::deallocate(__a, __buffer, __cap);
+        throw;
+    }
+    try {
+        __move_to(__buffer, __cap);
+    } catch (...) {
+        std::destroy_at(__slot);
+        __alloc_traits::deallocate(__a, __buffer, __cap);
+        throw;
+    }
+    ++__size_;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Take the elements, heap ring and statistics of __x, which is left empty and inline;
+**      this container must be empty and inline
+**
+** @note
+**       Complexity: O(1) if __x is on the heap, O(n) otherwise.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N, class _Policy>
+void dsa::adaptive_container<_Tp, _N, _Policy>::__take(adaptive_container& __x) noexcept(std::is_nothrow_move_constructible_v<_Tp>) {
+    __stats_ = __x.__stats_;
+    __demote_after_ = __x.__demote_after_;
+    if (__x.is_inline()) {
+        for (size_type __i = 0; __i < __x.__size_; ++__i) __push_unchecked(std::move(__x[__i]));
+        __x.clear();
+        return;
+    }
+    __data_ = __x.__data_;
+    __head_ = __x.__head_;
+    __size_ = __x.__size_;
+    __capacity_ = __x.__capacity_;
+    __low_ops_ = __x.__low_ops_;
+    __sparse_ops_ = __x.__sparse_ops_;
+    __x.__data_ = __x.__inline_data();
+    __x.__head_ = 0;
+    __x.__size_ = 0;
+    __x.__capacity_ = _N;
+    __x.__low_ops_ = 0;
+    __x.__sparse_ops_ = 0;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Free the heap ring, if any; the elements must already be destroyed or moved out
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N, class _Policy>
+void dsa::adaptive_container<_Tp, _N, _Policy>::__release() noexcept {
+    if (!is_inline()) {
+        typename __alloc_traits::allocator_type __a;
+        __alloc_traits::deallocate(__a, __data_, __capacity_);
+        __data_ = __inline_data();
+        __capacity_ = _N;
+        __head_ = 0;
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Move the elements back inline if they fit, whatever the recent occupancy
+**
+** @note
+**       Complexity: O(n). Strong exception guarantee.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N, class _Policy>
+void dsa::adaptive_container<_Tp, _N, _Policy>::shrink_to_fit() {
+    if (!is_inline() && __size_ <= _N) __move_to(__inline_data(), _N);
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Return the memory held by the container
+**
+** @note
+**       The unused inline storage counts as overhead while the elements are on the heap.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N, class _Policy>
+dsa::memory_footprint dsa::adaptive_container<_Tp, _N, _Policy>::memory_usage() const noexcept {
+    memory_footprint __m;
+    __m.payload_bytes = __size_ * sizeof(_Tp);
+    __m.overhead_bytes = sizeof(*this) - __m.payload_bytes;
+    if (!is_inline()) __m += __heap_block(__capacity_ * sizeof(_Tp), alignof(_Tp));
+    return __m;
+}
+#endif /* ADAPTIVE_CONTAINER_H */
@@ -0,0 +1,248 @@
+/**
+ * @file    AsyncQueue.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A FIFO queue whose consumers co_await the next element
+*/
+
+#ifndef ASYNC_QUEUE_H
+#define ASYNC_QUEUE_H
+
+#include <coroutine>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "Deque.h"
+#include "Executor.h"
+#include "MemoryUsage.h"
+#include "queue.h"
+
+namespace dsa {
+    /**
+     * @brief async_queue is a thread-safe FIFO queue for coroutine pipelines. co_await pop()
+     *      suspends the consumer while the queue is empty and resumes it when an element is
+     *      pushed, so a stage waiting for input holds no thread.
+     *
+     * @tparam
+     *      _Tp the type of stored element
+     * @tparam
+     *      _Container the type of underlying container, see dsa::queue
+     *
+     * @note
+     *      Waiting consumers are served in FIFO order and an element pushed while one waits
+     *      goes straight to it. A consumer is resumed on the queue's executor, or inside
+     *      push() on the pushing thread if the queue has none. After close(), push() drops
+     *      its argument and pop() yields the remaining elements, then std::nullopt.
+    */
+    template <class _Tp, class _Container = deque<_Tp>>
+    class async_queue {
+            class __pop_awaiter;
+
+        public:
+            using value_type = _Tp;                                     //!< value_type
+            using size_type = std::size_t;                              //!< size_type
+
+            /** @brief construct a queue that resumes consumers inside push() */
+            async_queue() noexcept = default;
+
+            /** @brief construct a queue that resumes consumers on __ex */
+            explicit async_queue(executor& __ex) noexcept : __executor_{&__ex} {}
+
+            async_queue(const async_queue&) = delete;
+            async_queue& operator=(const async_queue&) = delete;
+
+            /** @brief push a copy of __x, return false if the queue is closed */
+            bool push(const _Tp& __x) { return emplace(__x); }
+
+            /** @brief push __x, return false if the queue is closed */
+            bool push(_Tp&& __x) { return emplace(std::move(__x)); }
+
+            template <class... _Args>
+            bool emplace(_Args&&... __args);
+
+            /**
+             * @brief
+             *      return an awaitable for the next element
+             *
+             * @return
+             *      awaitable yielding std::optional<_Tp>: the element, or std::nullopt once the
+             *      queue is closed and drained
+             *
+             * @note
+             *      Does not suspend when an element is available.
+            */
+            [[nodiscard]] __pop_awaiter pop() noexcept { return __pop_awaiter{this}; }
+
+            /** @brief remove and return the first element without waiting, std::nullopt if there is none */
+            std::optional<_Tp> try_pop() {
+                std::lock_guard<std::mutex> __guard{__lock_};
+                return __items_.try_pop();
+            }
+
+            void close();
+
+            /** @brief check whether close() was called */
+            bool closed() const {
+                std::lock_guard<std::mutex> __guard{__lock_};
+                return __closed_;
+            }
+
+            /** @brief return the number of queued elements */
+            size_type size() const {
+                std::lock_guard<std::mutex> __guard{__lock_};
+                return __items_.size();
+            }
+
+            /** @brief check whether no element is queued */
+            bool empty() const { return size() == 0; }
+
+            /** @brief return the number of suspended consumers */
+            size_type waiting() const {
+                std::lock_guard<std::mutex> __guard{__lock_};
+                return __waiting_;
+            }
+
+            /** @brief return the memory held by the queue, the suspended consumers live in their own frames */
+            memory_footprint memory_usage() const
+                requires requires(const _Container& __c) { __c.memory_usage(); }
+            {
+                std::lock_guard<std::mutex> __guard{__lock_};
+                memory_footprint __m = __items_.memory_usage();
+                __m.overhead_bytes += sizeof(*this) - sizeof(__items_);
+                return __m;
+            }
+
+        private:
+            /** @brief awaitable returned by pop(), linked into the waiter list while suspended */
+            class __pop_awaiter {
+                    friend class async_queue;
+
+                    async_queue* __q_;
+                    __pop_awaiter* __next_ = nullptr;       //!< next waiter, FIFO
+                    std::coroutine_handle<> __h_;
+                    std::optional<_Tp> __value_;
+
+                    explicit __pop_awaiter(async_queue* __q) noexcept : __q_{__q} {}
+
+                public:
+                    bool await_ready() const noexcept { return false; }
+
+                    /* The coroutine may be resumed on another thread as soon as the lock is
+                     * released, so nothing here touches *this after that point. */
+                    bool await_suspend(std::coroutine_handle<> __h) {
+                        std::lock_guard<std::mutex> __guard{__q_->__lock_};
+                        __value_ = __q_->__items_.try_pop();
+                        if (__value_ || __q_->__closed_) return false;
+                        __h_ = __h;
+                        __q_->__enqueue(this);
+                        return true;
+                    }
+
+                    std::optional<_Tp> await_resume() { return std::move(__value_); }
+            };
+
+            mutable std::mutex __lock_;
+            queue<_Tp, _Container> __items_;            //!< elements nobody waits for yet
+            __pop_awaiter* __head_ = nullptr;           //!< oldest suspended consumer
+            __pop_awaiter* __tail_ = nullptr;           //!< newest suspended consumer
+            size_type __waiting_ = 0;                   //!< length of the waiter list
+            bool __closed_ = false;
+            executor* __executor_ = nullptr;            //!< where consumers resume, nullptr for inline
+
+            void __enqueue(__pop_awaiter* __w) noexcept {
+                if (__tail_ == nullptr) __head_ = __w;
+                else __tail_->__next_ = __w;
+                __tail_ = __w;
+                ++__waiting_;
+            }
+
+            __pop_awaiter* __dequeue() noexcept {
+                __pop_awaiter* __w = __head_;
+                __head_ = __w->__next_;
+                if (__head_ == nullptr) __tail_ = nullptr;
+                --__waiting_;
+                return __w;
+            }
+
+            void __resume(std::coroutine_handle<> __h) {
+                if (__executor_ != nullptr) __executor_->post(__h);
+                else __h.resume();
+            }
+    };
+}   /* namespace dsa */
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Construct an element from __args and hand it to the oldest waiting consumer, or queue it
+**
+** @param [in]
+**      args: the arguments args... are forwarded to the constructor as std::forward<_Args>(args)...
+**
+** @return
+**       false if the queue is closed, in which case nothing is constructed
+**
+** @note
+**       Complexity: O(1). The consumer is resumed after the lock is released.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Container>
+template <class... _Args>
+bool dsa::async_queue<_Tp, _Container>::emplace(_Args&&... __args) {
+    std::coroutine_handle<> __h;
+    {
+        std::lock_guard<std::mutex> __guard{__lock_};
+        if (__closed_) return false;
+        if (__head_ == nullptr) {
+            __items_.emplace(std::forward<_Args>(__args)...);
+            return true;
+        }
+        __pop_awaiter* __w = __dequeue();
+        try {
+            __w->__value_.emplace(std::forward<_Args>(__args)...);
+        } catch (...) {
+            __w->__next_ = __head_;                 /* put it back in front */
+            __head_ = __w;
+            if (__tail_ == nullptr) __tail_ = __w;
+            ++__waiting_;
+            throw;
+        }
+        __h = __w->__h_;
+    }
+    __resume(__h);
+    return true;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Close the queue: later pushes fail and every waiting consumer resumes with std::nullopt
+**
+** @note
+**       Elements already queued can still be popped. Complexity: O(number of waiting consumers)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Container>
+void dsa::async_queue<_Tp, _Container>::close() {
+    __pop_awaiter* __w;
+    {
+        std::lock_guard<std::mutex> __guard{__lock_};
+        __closed_ = true;
+        __w = __head_;
+        __head_ = __tail_ = nullptr;
+        __waiting_ = 0;
+    }
+    while (__w != nullptr) {
+        __pop_awaiter* __next = __w->__next_;       /* read before the consumer can resume */
+        __resume(__w->__h_);
+        __w = __next;
+    }
+}
+#endif /* ASYNC_QUEUE_H */
@@ -0,0 +1,205 @@
+/**
+ * @file    Executor.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   Minimal executors that resume coroutines, and a fire-and-forget coroutine type
+*/
+
+#ifndef EXECUTOR_H
+#define EXECUTOR_H
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Deque.h"
+
+namespace dsa {
+    class executor;
+
+    /**
+     * @brief return type of a fire-and-forget coroutine. The coroutine starts suspended and
+     *      runs once it is handed to executor::spawn(); its frame frees itself at the end.
+     *
+     * @note
+     *      An exception escaping the coroutine calls std::terminate().
+    */
+    class async_task {
+        public:
+            /** @brief promise of an async_task coroutine */
+            struct promise_type {
+                async_task get_return_object() noexcept {
+                    return async_task{std::coroutine_handle<promise_type>::from_promise(*this)};
+                }
+                std::suspend_always initial_suspend() noexcept { return {}; }
+                std::suspend_never final_suspend() noexcept { return {}; }
+                void return_void() noexcept {}
+                [[noreturn]] void unhandled_exception() noexcept { std::terminate(); }
+            };
+
+            async_task(const async_task&) = delete;
+            async_task& operator=(const async_task&) = delete;
+
+            /** @brief move constructor */
+            async_task(async_task&& __x) noexcept : __h_{std::exchange(__x.__h_, nullptr)} {}
+
+            /** @brief destroy the coroutine if it was never spawned */
+            ~async_task() {
+                if (__h_) __h_.destroy();
+            }
+
+            /** @brief give up ownership of the suspended coroutine */
+            std::coroutine_handle<> release() noexcept { return std::exchange(__h_, nullptr); }
+
+        private:
+            std::coroutine_handle<promise_type> __h_;
+
+            explicit async_task(std::coroutine_handle<promise_type> __h) noexcept : __h_{__h} {}
+    };
+
+    /**
+     * @brief something that resumes suspended coroutines
+     *
+     * A single-threaded executor resumes posted coroutines later, on its own thread. A
+     * multi-threaded one may resume a coroutine on another thread before post() returns;
+     * the awaiters in this library allow for that.
+    */
+    class executor {
+        public:
+            virtual ~executor() = default;
+
+            /** @brief resume __h later, on one of the executor's threads */
+            virtual void post(std::coroutine_handle<> __h) = 0;
+
+            /** @brief start a coroutine on this executor */
+            void spawn(async_task __t) { post(__t.release()); }
+
+            /** @brief awaitable that moves the awaiting coroutine onto this executor */
+            auto schedule() noexcept {
+                struct __awaiter {
+                    executor* __ex_;
+                    bool await_ready() const noexcept { return false; }
+                    void await_suspend(std::coroutine_handle<> __h) { __ex_->post(__h); }
+                    void await_resume() const noexcept {}
+                };
+                return __awaiter{this};
+            }
+    };
+
+    /**
+     * @brief single-threaded executor driven by its owner: post() queues, run() resumes
+     *
+     * @note
+     *      Not thread-safe: post() and run() must be called from the same thread, which is
+     *      the thread every coroutine resumes on.
+    */
+    class manual_executor final : public executor {
+        public:
+            /** @brief queue __h */
+            void post(std::coroutine_handle<> __h) override { __ready_.push_back(__h); }
+
+            /** @brief resume the oldest queued coroutine, return false if there is none */
+            bool run_one() {
+                std::optional<std::coroutine_handle<>> __h = __ready_.try_pop_front();
+                if (!__h) return false;
+                __h->resume();
+                return true;
+            }
+
+            /**
+             * @brief
+             *      resume queued coroutines until none is left, those posted meanwhile included
+             *
+             * @return
+             *      number of coroutines resumed
+            */
+            std::size_t run() {
+                std::size_t __n = 0;
+                while (run_one()) ++__n;
+                return __n;
+            }
+
+            /** @brief return the number of queued coroutines */
+            std::size_t pending() const noexcept { return __ready_.size(); }
+
+        private:
+            deque<std::coroutine_handle<>> __ready_;    //!< FIFO of coroutines to resume
+    };
+
+    /**
+     * @brief multi-threaded executor: a fixed set of threads resume posted coroutines in
+     *      FIFO order and sleep on a condition variable while there are none
+     *
+     * @note
+     *      The destructor calls stop(): coroutines already posted still run, then the threads
+     *      are joined. Coroutines still suspended elsewhere at that point are not resumed.
+    */
+    class thread_pool_executor final : public executor {
+        public:
+            /** @brief start __threads worker threads, at least one */
+            explicit thread_pool_executor(std::size_t __threads = std::thread::hardware_concurrency()) {
+                if (__threads == 0) __threads = 1;
+                __workers_.reserve(__threads);
+                for (std::size_t __i = 0; __i < __threads; ++__i) __workers_.emplace_back([this] { __work(); });
+            }
+
+            thread_pool_executor(const thread_pool_executor&) = delete;
+            thread_pool_executor& operator=(const thread_pool_executor&) = delete;
+
+            /** @brief default destructor, see stop() */
+            ~thread_pool_executor() override { stop(); }
+
+            /** @brief queue __h and wake a worker */
+            void post(std::coroutine_handle<> __h) override {
+                {
+                    std::lock_guard<std::mutex> __guard{__lock_};
+                    __ready_.push_back(__h);
+                }
+                __wakeup_.notify_one();
+            }
+
+            /** @brief run the coroutines already posted, then join the threads; idempotent */
+            void stop() {
+                {
+                    std::lock_guard<std::mutex> __guard{__lock_};
+                    __stopping_ = true;
+                }
+                __wakeup_.notify_all();
+                for (std::thread& __t : __workers_)
+                    if (__t.joinable()) __t.join();
+            }
+
+            /** @brief return the number of worker threads */
+            std::size_t threads() const noexcept { return __workers_.size(); }
+
+        private:
+            std::mutex __lock_;
+            std::condition_variable __wakeup_;
+            deque<std::coroutine_handle<>> __ready_;    //!< FIFO of coroutines to resume
+            bool __stopping_ = false;
+            std::vector<std::thread> __workers_;
+
+            void __work() {
+                for (;;) {
+                    std::coroutine_handle<> __h;
+                    {
+                        std::unique_lock<std::mutex> __guard{__lock_};
+                        __wakeup_.wait(__guard, [this] { return __stopping_ || !__ready_.empty(); });
+                        if (__ready_.empty()) return;
+                        __h = __ready_.front();
+                        __ready_.pop_front();
+                    }
+                    __h.resume();
+                }
+            }
+    };
+}   /* namespace dsa */
+
+#endif /* EXECUTOR_H */
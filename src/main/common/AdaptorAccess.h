@@ -0,0 +1,39 @@
+/**
+ * @file    AdaptorAccess.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   Reach the underlying container of a stack or queue from outside the adaptor
+*/
+
+#ifndef ADAPTOR_ACCESS_H
+#define ADAPTOR_ACCESS_H
+
+namespace dsa {
+    /** @brief stack and queue, whose elements are reached through their protected container */
+    template <class _Adaptor>
+    concept __container_adaptor = requires { typename _Adaptor::container_type; }
+                                  && !requires(const _Adaptor& __a) { __a.begin(); };
+
+    /**
+     * @brief
+     *      the container holding the elements of _Cp: _Cp itself, or the protected member of
+     *      an adaptor (c for the standard layout, _container for the older dsa adaptors),
+     *      followed through adaptors over adaptors
+     *
+     * @note
+     *      The member is named through a class derived from the adaptor, which may form a
+     *      pointer to a protected member of its base; nothing of this class is instantiated.
+    */
+    template <class _Cp>
+    struct __adaptor_access : _Cp {
+        template <class _Xp>
+        static auto& __get(_Xp& __c) noexcept {
+            if constexpr (!__container_adaptor<_Cp>) return __c;
+            else if constexpr (requires { &__adaptor_access::c; }) return __adaptor_access<typename _Cp::container_type>::__get(__c.*(&__adaptor_access::c));
+            else return __adaptor_access<typename _Cp::container_type>::__get(__c.*(&__adaptor_access::_container));
+        }
+    };
+}   /* namespace dsa */
+
+#endif /* ADAPTOR_ACCESS_H */
@@ -0,0 +1,412 @@
+/**
+ * @file    Algorithm.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   find, count, contains and equal over the contiguous runs of the dsa containers
+*/
+
+#ifndef ALGORITHM_H
+#define ALGORITHM_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+#include "AdaptorAccess.h"
+
+#if !defined(DSA_ALGORITHM_SCALAR)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DSA_ALGORITHM_SSE2 1
+#endif
+#if defined(DSA_ALGORITHM_SSE2) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define DSA_ALGORITHM_AVX2 1
+#endif
+#endif
+
+namespace dsa {
+    /**
+     * @brief element types the vector kernels compare, with the result of operator==:
+     *      integers bitwise, float and double with IEEE equality (NaN != NaN, -0.0 == 0.0)
+    */
+    template <class _Tp>
+    concept __simd_element = (std::is_integral_v<_Tp> && !std::is_same_v<_Tp, bool>)
+                             || std::is_same_v<_Tp, float> || std::is_same_v<_Tp, double>;
+
+#if defined(DSA_ALGORITHM_SSE2)
+    /** @brief 16-byte kernels; every equality mask has one bit per byte, sizeof(_Tp) bits per element */
+    struct __sse2_kernel {
+        using __reg = __m128i;
+        static constexpr std::size_t __bytes = 16;
+
+        static __reg __load(const void* __p) noexcept { return _mm_loadu_si128(static_cast<const __m128i*>(__p)); }
+
+        template <class _Tp>
+        static __reg __splat(_Tp __v) noexcept {
+            if constexpr (std::is_same_v<_Tp, float>) return _mm_castps_si128(_mm_set1_ps(__v));
+            else if constexpr (std::is_same_v<_Tp, double>) return _mm_castpd_si128(_mm_set1_pd(__v));
+            else if constexpr (sizeof(_Tp) == 1) return _mm_set1_epi8(static_cast<char>(__v));
+            else if constexpr (sizeof(_Tp) == 2) return _mm_set1_epi16(static_cast<short>(__v));
+            else if constexpr (sizeof(_Tp) == 4) return _mm_set1_epi32(static_cast<int>(__v));
+            else return _mm_set1_epi64x(static_cast<long long>(__v));
+        }
+
+        template <class _Tp>
+        static std::uint32_t __eq(__reg __a, __reg __b) noexcept {
+            __reg __m;
+            if constexpr (std::is_same_v<_Tp, float>) __m = _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(__a), _mm_castsi128_ps(__b)));
+            else if constexpr (std::is_same_v<_Tp, double>) __m = _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(__a), _mm_castsi128_pd(__b)));
+            else if constexpr (sizeof(_Tp) == 1) __m = _mm_cmpeq_epi8(__a, __b);
+            else if constexpr (sizeof(_Tp) == 2) __m = _mm_cmpeq_epi16(__a, __b);
+            else if constexpr (sizeof(_Tp) == 4) __m = _mm_cmpeq_epi32(__a, __b);
+            else {                                              /* SSE2 has no 64-bit compare: both halves must match */
+                __m = _mm_cmpeq_epi32(__a, __b);
+                __m = _mm_and_si128(__m, _mm_shuffle_epi32(__m, _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(__m));
+        }
+    };
+#endif
+
+#if defined(DSA_ALGORITHM_AVX2)
+    /** @brief 32-byte kernels, same masks as __sse2_kernel, compiled for AVX2 whatever the build flags */
+    struct __avx2_kernel {
+        using __reg = __m256i;
+        static constexpr std::size_t __bytes = 32;
+
+        [[gnu::target("avx2")]] static __reg __load(const void* __p) noexcept { return _mm256_loadu_si256(static_cast<const __m256i*>(__p)); }
+
+        template <class _Tp>
+        [[gnu::target("avx2")]] static __reg __splat(_Tp __v) noexcept {
+            if constexpr (std::is_same_v<_Tp, float>) return _mm256_castps_si256(_mm256_set1_ps(__v));
+            else if constexpr (std::is_same_v<_Tp, double>) return _mm256_castpd_si256(_mm256_set1_pd(__v));
+            else if constexpr (sizeof(_Tp) == 1) return _mm256_set1_epi8(static_cast<char>(__v));
+            else if constexpr (sizeof(_Tp) == 2) return _mm256_set1_epi16(static_cast<short>(__v));
+            else if constexpr (sizeof(_Tp) == 4) return _mm256_set1_epi32(static_cast<int>(__v));
+            else return _mm256_set1_epi64x(static_cast<long long>(__v));
+        }
+
+        template <class _Tp>
+        [[gnu::target("avx2")]] static std::uint32_t __eq(__reg __a, __reg __b) noexcept {
+            __reg __m;
+            if constexpr (std::is_same_v<_Tp, float>) __m = _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(__a), _mm256_castsi256_ps(__b), _CMP_EQ_OQ));
+            else if constexpr (std::is_same_v<_Tp, double>) __m = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(__a), _mm256_castsi256_pd(__b), _CMP_EQ_OQ));
+            else if constexpr (sizeof(_Tp) == 1) __m = _mm256_cmpeq_epi8(__a, __b);
+            else if constexpr (sizeof(_Tp) == 2) __m = _mm256_cmpeq_epi16(__a, __b);
+            else if constexpr (sizeof(_Tp) == 4) __m = _mm256_cmpeq_epi32(__a, __b);
+            else __m = _mm256_cmpeq_epi64(__a, __b);
+            return static_cast<std::uint32_t>(_mm256_movemask_epi8(__m));
+        }
+    };
+
+    /** @brief check once whether the CPU runs AVX2, true at compile time when the build targets it */
+    inline bool __has_avx2() noexcept {
+#if defined(__AVX2__)
+        return true;
+#else
+        static const bool __yes = (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+        return __yes;
+#endif
+    }
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"        /* the runs only hold 32-byte registers once inlined into the AVX2 wrappers */
+#endif
+    /* index of the first element of [__p, __p + __n) equal to __v, __n if none */
+    template <class _Kernel, class _Tp>
+    [[gnu::always_inline]] inline std::size_t __find_run(const _Tp* __p, std::size_t __n, _Tp __v) noexcept {
+        constexpr std::size_t __step = _Kernel::__bytes / sizeof(_Tp);
+        const typename _Kernel::__reg __needle = _Kernel::template __splat<_Tp>(__v);
+        std::size_t __i = 0;
+        for (; __i + __step <= __n; __i += __step) {
+            const std::uint32_t __m = _Kernel::template __eq<_Tp>(_Kernel::__load(__p + __i), __needle);
+            if (__m != 0) return __i + static_cast<std::size_t>(std::countr_zero(__m)) / sizeof(_Tp);
+        }
+        for (; __i < __n; ++__i) {
+            if (__p[__i] == __v) return __i;
+        }
+        return __n;
+    }
+
+    /* number of elements of [__p, __p + __n) equal to __v */
+    template <class _Kernel, class _Tp>
+    [[gnu::always_inline]] inline std::size_t __count_run(const _Tp* __p, std::size_t __n, _Tp __v) noexcept {
+        constexpr std::size_t __step = _Kernel::__bytes / sizeof(_Tp);
+        const typename _Kernel::__reg __needle = _Kernel::template __splat<_Tp>(__v);
+        std::size_t __bits = 0, __i = 0;
+        for (; __i + __step <= __n; __i += __step)
+            __bits += static_cast<std::size_t>(std::popcount(_Kernel::template __eq<_Tp>(_Kernel::__load(__p + __i), __needle)));
+        std::size_t __c = __bits / sizeof(_Tp);
+        for (; __i < __n; ++__i) __c += __p[__i] == __v;
+        return __c;
+    }
+
+    /* check whether [__a, __a + __n) and [__b, __b + __n) are equal element by element */
+    template <class _Kernel, class _Tp>
+    [[gnu::always_inline]] inline bool __equal_run(const _Tp* __a, const _Tp* __b, std::size_t __n) noexcept {
+        constexpr std::size_t __step = _Kernel::__bytes / sizeof(_Tp);
+        constexpr std::uint32_t __all = static_cast<std::uint32_t>((std::uint64_t{1} << _Kernel::__bytes) - 1);
+        std::size_t __i = 0;
+        for (; __i + __step <= __n; __i += __step) {
+            if (_Kernel::template __eq<_Tp>(_Kernel::__load(__a + __i), _Kernel::__load(__b + __i)) != __all) return false;
+        }
+        for (; __i < __n; ++__i) {
+            if (!(__a[__i] == __b[__i])) return false;
+        }
+        return true;
+    }
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#if defined(DSA_ALGORITHM_AVX2)
+    template <class _Tp>
+    [[gnu::target("avx2,popcnt")]] std::size_t __find_avx2(const _Tp* __p, std::size_t __n, _Tp __v) noexcept { return __find_run<__avx2_kernel>(__p, __n, __v); }
+
+    template <class _Tp>
+    [[gnu::target("avx2,popcnt")]] std::size_t __count_avx2(const _Tp* __p, std::size_t __n, _Tp __v) noexcept { return __count_run<__avx2_kernel>(__p, __n, __v); }
+
+    template <class _Tp>
+    [[gnu::target("avx2,popcnt")]] bool __equal_avx2(const _Tp* __a, const _Tp* __b, std::size_t __n) noexcept { return __equal_run<__avx2_kernel>(__a, __b, __n); }
+#endif
+
+    /**
+     * @brief the contiguous-run primitives: AVX2 when the CPU has it, else SSE2, else a
+     *      scalar loop; types other than __simd_element always take the scalar loop
+    */
+    template <class _Tp>
+    std::size_t __find_span(std::span<const _Tp> __s, const _Tp& __v) {
+        if constexpr (__simd_element<_Tp>) {
+#if defined(DSA_ALGORITHM_AVX2)
+            if (__has_avx2()) return __find_avx2(__s.data(), __s.size(), __v);
+#endif
+#if defined(DSA_ALGORITHM_SSE2)
+            return __find_run<__sse2_kernel>(__s.data(), __s.size(), __v);
+#endif
+        }
+        return static_cast<std::size_t>(std::find(__s.begin(), __s.end(), __v) - __s.begin());
+    }
+
+    /** @copydoc __find_span */
+    template <class _Tp>
+    std::size_t __count_span(std::span<const _Tp> __s, const _Tp& __v) {
+        if constexpr (__simd_element<_Tp>) {
+#if defined(DSA_ALGORITHM_AVX2)
+            if (__has_avx2()) return __count_avx2(__s.data(), __s.size(), __v);
+#endif
+#if defined(DSA_ALGORITHM_SSE2)
+            return __count_run<__sse2_kernel>(__s.data(), __s.size(), __v);
+#endif
+        }
+        return static_cast<std::size_t>(std::count(__s.begin(), __s.end(), __v));
+    }
+
+    /** @copydoc __find_span */
+    template <class _Tp>
+    bool __equal_span(std::span<const _Tp> __a, std::span<const _Tp> __b) {
+        if constexpr (__simd_element<_Tp>) {
+#if defined(DSA_ALGORITHM_AVX2)
+            if (__has_avx2()) return __equal_avx2(__a.data(), __b.data(), __a.size());
+#endif
+#if defined(DSA_ALGORITHM_SSE2)
+            return __equal_run<__sse2_kernel>(__a.data(), __b.data(), __a.size());
+#endif
+        }
+        return std::equal(__a.begin(), __a.end(), __b.begin());
+    }
+
+    /**
+     * @brief the contiguous runs of a container, front to back, indexed 0 to count() - 1
+     *
+     * Three shapes are recognized: a contiguous range (small_vector) is one run; segments()
+     * returns the runs of a ring (ring_buffer, adaptive_container); segment_count() and
+     * segment(i) give the blocks of a chunked container (deque).
+    */
+    template <class _Cp>
+    struct __segments_of {
+        const _Cp& __c_;
+
+        std::size_t count() const noexcept {
+            if constexpr (std::ranges::contiguous_range<const _Cp>) return 1;
+            else if constexpr (requires { __c_.segments(); }) return std::tuple_size_v<std::remove_cvref_t<decltype(__c_.segments())>>;
+            else return __c_.segment_count();
+        }
+
+        auto operator[](std::size_t __i) const noexcept {
+            if constexpr (std::ranges::contiguous_range<const _Cp>) return std::span{std::ranges::data(__c_), std::ranges::size(__c_)};
+            else if constexpr (requires { __c_.segments(); }) return __c_.segments()[__i];
+            else return __c_.segment(__i);
+        }
+    };
+
+    /** @brief containers whose elements __segments_of can reach as contiguous runs */
+    template <class _Cp>
+    concept __segmented = std::ranges::contiguous_range<const _Cp>
+                          || requires(const _Cp& __c) { __c.segments(); }
+                          || requires(const _Cp& __c) { __c.segment_count(); __c.segment(std::size_t{0}); };
+
+    /**
+     * @brief
+     *      __v as an element of type _Ep that compares equal to exactly the elements __v does,
+     *      so an int needle can take the kernels of a std::size_t or float container
+     *
+     * @return
+     *      nullopt when __v does not convert there and back unchanged, e.g. -1 or 300 for
+     *      std::uint8_t elements, or 0.1 for float ones: the caller then compares with __v
+    */
+    template <__simd_element _Ep, class _Tp>
+        requires std::is_arithmetic_v<_Tp>
+    std::optional<_Ep> __as_element(_Tp __v) noexcept {
+        if constexpr (std::is_floating_point_v<_Ep> && std::is_integral_v<_Tp>) {
+            return static_cast<_Ep>(__v);                   // x == __v converts __v to _Ep as well
+        } else if constexpr (std::is_floating_point_v<_Ep> && std::is_floating_point_v<_Tp>) {
+            if constexpr (sizeof(_Tp) <= sizeof(_Ep)) return static_cast<_Ep>(__v);
+            else {
+                /* Out of the range of _Ep the conversion is undefined; NaN fails both tests */
+                const bool __in_range = (__v >= std::numeric_limits<_Ep>::lowest() && __v <= std::numeric_limits<_Ep>::max())
+                                        || __v == std::numeric_limits<_Tp>::infinity() || __v == -std::numeric_limits<_Tp>::infinity();
+                if (!__in_range || static_cast<_Tp>(static_cast<_Ep>(__v)) != __v) return std::nullopt;
+                return static_cast<_Ep>(__v);
+            }
+        } else if constexpr (std::is_integral_v<_Tp> && !std::is_same_v<_Tp, bool>) {
+            const _Ep __e = static_cast<_Ep>(__v);
+            if (static_cast<_Tp>(__e) != __v || (__e < _Ep{}) != (__v < _Tp{})) return std::nullopt;
+            return __e;
+        } else {
+            return std::nullopt;                            // bool, or a floating needle for integers
+        }
+    }
+
+    /**
+     * @brief
+     *      return the position of the first element of __c equal to __v
+     *
+     * @param[in]
+     *      __c: a dsa container, or a stack or queue over one
+     * @param[in]
+     *      __v: value to look for
+     *
+     * @return
+     *      the index from the front (the bottom of a stack), size() if there is none
+     *
+     * @note
+     *      Complexity: O(n). On contiguous runs of integers, float or double the comparison
+     *      is vectorized, 16 to 32 bytes per instruction, when __v has the element type or is
+     *      an arithmetic value that converts to it exactly (see __as_element()); other
+     *      containers are walked with their iterators.
+    */
+    template <class _Cp, class _Tp>
+    std::size_t find(const _Cp& __c, const _Tp& __v) {
+        const auto& __elements = __adaptor_access<_Cp>::__get(__c);
+        using _Ep = typename std::remove_cvref_t<decltype(__elements)>::value_type;
+        if constexpr (__segmented<std::remove_cvref_t<decltype(__elements)>>) {
+            if constexpr (!std::is_same_v<_Ep, _Tp> && __simd_element<_Ep> && std::is_arithmetic_v<_Tp>) {
+                if (const std::optional<_Ep> __e = __as_element<_Ep>(__v)) return find(__c, *__e);
+            }
+            const __segments_of<std::remove_cvref_t<decltype(__elements)>> __segs{__elements};
+            std::size_t __base = 0;
+            for (std::size_t __k = 0, __n = __segs.count(); __k < __n; ++__k) {
+                const std::span<const _Ep> __s = __segs[__k];
+                std::size_t __i;
+                if constexpr (std::is_same_v<_Ep, _Tp>) __i = __find_span(__s, __v);
+                else __i = static_cast<std::size_t>(std::find(__s.begin(), __s.end(), __v) - __s.begin());
+                if (__i != __s.size()) return __base + __i;
+                __base += __s.size();
+            }
+            return __base;
+        } else {
+            return static_cast<std::size_t>(std::distance(std::begin(__elements), std::find(std::begin(__elements), std::end(__elements), __v)));
+        }
+    }
+
+    /**
+     * @brief
+     *      return the number of elements of __c equal to __v
+     *
+     * @note
+     *      Complexity: O(n), vectorized as find()
+    */
+    template <class _Cp, class _Tp>
+    std::size_t count(const _Cp& __c, const _Tp& __v) {
+        const auto& __elements = __adaptor_access<_Cp>::__get(__c);
+        using _Ep = typename std::remove_cvref_t<decltype(__elements)>::value_type;
+        if constexpr (__segmented<std::remove_cvref_t<decltype(__elements)>>) {
+            if constexpr (!std::is_same_v<_Ep, _Tp> && __simd_element<_Ep> && std::is_arithmetic_v<_Tp>) {
+                if (const std::optional<_Ep> __e = __as_element<_Ep>(__v)) return count(__c, *__e);
+            }
+            const __segments_of<std::remove_cvref_t<decltype(__elements)>> __segs{__elements};
+            std::size_t __total = 0;
+            for (std::size_t __k = 0, __n = __segs.count(); __k < __n; ++__k) {
+                const std::span<const _Ep> __s = __segs[__k];
+                if constexpr (std::is_same_v<_Ep, _Tp>) __total += __count_span(__s, __v);
+                else __total += static_cast<std::size_t>(std::count(__s.begin(), __s.end(), __v));
+            }
+            return __total;
+        } else {
+            return static_cast<std::size_t>(std::count(std::begin(__elements), std::end(__elements), __v));
+        }
+    }
+
+    /** @brief check whether __c holds an element equal to __v, see find() */
+    template <class _Cp, class _Tp>
+    bool contains(const _Cp& __c, const _Tp& __v) {
+        return find(__c, __v) != __adaptor_access<_Cp>::__get(__c).size();
+    }
+
+    /**
+     * @brief
+     *      check whether __x and __y hold equal elements in the same order
+     *
+     * @param[in]
+     *      __x, __y: dsa containers, or stacks or queues over them, possibly of different types
+     *
+     * @note
+     *      Complexity: O(n). When both sides are made of contiguous runs the runs are
+     *      compared pairwise, in pieces up to the next boundary on either side, so a ring
+     *      that wraps compares with a deque whose blocks start elsewhere; for the element
+     *      types of find() each piece is vectorized.
+    */
+    template <class _C1, class _C2>
+    bool equal(const _C1& __x, const _C2& __y) {
+        const auto& __a = __adaptor_access<_C1>::__get(__x);
+        const auto& __b = __adaptor_access<_C2>::__get(__y);
+        if (__a.size() != __b.size()) return false;
+        using _A = std::remove_cvref_t<decltype(__a)>;
+        using _B = std::remove_cvref_t<decltype(__b)>;
+        using _Ep = typename _A::value_type;
+        if constexpr (__segmented<_A> && __segmented<_B> && std::is_same_v<_Ep, typename _B::value_type>) {
+            const __segments_of<_A> __sa{__a};
+            const __segments_of<_B> __sb{__b};
+            std::span<const _Ep> __ra, __rb;
+            for (std::size_t __ka = 0, __kb = 0, __left = __a.size(); __left != 0;) {
+                while (__ra.empty()) __ra = __sa[__ka++];
+                while (__rb.empty()) __rb = __sb[__kb++];
+                const std::size_t __n = std::min(__ra.size(), __rb.size());
+                if (!__equal_span(__ra.first(__n), __rb.first(__n))) return false;
+                __ra = __ra.subspan(__n);
+                __rb = __rb.subspan(__n);
+                __left -= __n;
+            }
+            return true;
+        } else {
+            return std::equal(std::begin(__a), std::end(__a), std::begin(__b));
+        }
+    }
+}   /* namespace dsa */
+
+#endif /* ALGORITHM_H */
@@ -0,0 +1,48 @@
+/**
+ * @file    Checksum.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   CRC-32 for the records the dsa containers write to files
+*/
+
+#ifndef CHECKSUM_H
+#define CHECKSUM_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace dsa {
+    /** @brief lookup table of the reflected CRC-32 polynomial 0xEDB88320 */
+    inline constexpr std::array<std::uint32_t, 256> __crc32_table = [] {
+        std::array<std::uint32_t, 256> __t{};
+        for (std::uint32_t __i = 0; __i < 256; ++__i) {
+            std::uint32_t __c = __i;
+            for (int __k = 0; __k < 8; ++__k) __c = (__c & 1) ? 0xEDB88320u ^ (__c >> 1) : __c >> 1;
+            __t[__i] = __c;
+        }
+        return __t;
+    }();
+
+    /**
+     * @brief
+     *      compute the CRC-32 (IEEE 802.3, as zlib's crc32()) of __n bytes at __data
+     *
+     * @param[in]
+     *      __data, __n: bytes to checksum
+     * @param[in]
+     *      __crc: CRC of the preceding bytes, to checksum a buffer in pieces
+     *
+     * @return
+     *      the checksum, crc32("123456789", 9) == 0xCBF43926
+    */
+    inline std::uint32_t crc32(const void* __data, std::size_t __n, std::uint32_t __crc = 0) noexcept {
+        const unsigned char* __p = static_cast<const unsigned char*>(__data);
+        __crc = ~__crc;
+        for (std::size_t __i = 0; __i < __n; ++__i) __crc = __crc32_table[(__crc ^ __p[__i]) & 0xFF] ^ (__crc >> 8);
+        return ~__crc;
+    }
+}   /* namespace dsa */
+
+#endif /* CHECKSUM_H */
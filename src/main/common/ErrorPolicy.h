@@ -0,0 +1,87 @@
+/**
+ * @file    ErrorPolicy.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   Compile-time policies for how the dsa containers react to a violated precondition
+*/
+
+#ifndef ERROR_POLICY_H
+#define ERROR_POLICY_H
+
+#include <concepts>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace dsa {
+    /** @brief throw _Exception(__what), kept out of line so the checking callers stay small */
+    template <class _Exception>
+    [[noreturn, gnu::cold, gnu::noinline]] void __throw_error(const char* __what) {
+        throw _Exception(__what);
+    }
+
+    /** @brief print __what and abort, kept out of line for the same reason */
+    [[noreturn, gnu::cold, gnu::noinline]] inline void __abort_error(const char* __what) noexcept {
+        std::fprintf(stderr, "dsa: precondition violated: %s\n", __what);
+        std::abort();
+    }
+
+    /**
+     * @brief check every precondition and throw on violation
+     *
+     * @note
+     *      pop on an empty container throws std::runtime_error, the type passed to require()
+     *      otherwise. The operations it guards are not noexcept.
+    */
+    struct checked_policy {
+        static constexpr bool is_nothrow = false;       //!< guarded operations may throw
+
+        /** @brief throw _Exception(__what) unless __ok */
+        template <class _Exception = std::runtime_error>
+        static constexpr void require(bool __ok, const char* __what) {
+            if (!__ok) [[unlikely]] __throw_error<_Exception>(__what);
+        }
+    };
+
+    /**
+     * @brief check nothing; a violated precondition is undefined behaviour
+     *
+     * @note
+     *      The guarded operations are noexcept and compile to the bare operation.
+    */
+    struct unchecked_policy {
+        static constexpr bool is_nothrow = true;        //!< guarded operations never throw
+
+        /** @brief do nothing */
+        template <class _Exception = std::runtime_error>
+        static constexpr void require(bool, const char*) noexcept {}
+    };
+
+    /**
+     * @brief check preconditions in debug builds only, and abort on violation
+     *
+     * @note
+     *      Follows assert(): with NDEBUG defined it behaves as unchecked_policy.
+    */
+    struct assert_only_policy {
+        static constexpr bool is_nothrow = true;        //!< guarded operations never throw
+
+        /** @brief abort with __what unless __ok, nothing under NDEBUG */
+        template <class _Exception = std::runtime_error>
+        static constexpr void require([[maybe_unused]] bool __ok, [[maybe_unused]] const char* __what) noexcept {
+#ifndef NDEBUG
+            if (!__ok) [[unlikely]] __abort_error(__what);
+#endif
+        }
+    };
+
+    /** @brief a type usable as the _Policy parameter of the dsa containers */
+    template <class _Policy>
+    concept error_policy = requires(bool __ok, const char* __what) {
+        { _Policy::is_nothrow } -> std::convertible_to<bool>;
+        _Policy::template require<std::runtime_error>(__ok, __what);
+    };
+}   /* namespace dsa */
+
+#endif /* ERROR_POLICY_H */
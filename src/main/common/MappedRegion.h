@@ -0,0 +1,126 @@
+/**
+ * @file    MappedRegion.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   An owning read-write shared mapping of a file or of anonymous memory
+*/
+
+#ifndef MAPPED_REGION_H
+#define MAPPED_REGION_H
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace dsa {
+    /**
+     * @brief mapped_region owns a MAP_SHARED mapping and unmaps it on destruction.
+     *
+     * open_file() maps a file, growing it to the requested size; writes reach the file and
+     * every process that maps it. offset_list arenas and the mmap_queue segment files are
+     * both mapped this way. anonymous_shared() maps memory that a fork()ed child
+     * shares with its parent.
+     *
+     * @note
+     *      POSIX only. Errors are reported as std::system_error.
+    */
+    class mapped_region {
+        public:
+            using size_type = std::size_t;          //!< size_type
+
+            /** @brief construct an empty region */
+            mapped_region() noexcept = default;
+
+            /**
+             * @brief map the first __bytes of the file at __p, growing it with zeros if it is
+             *      shorter; a missing file is created if __create, an error otherwise
+             */
+            static mapped_region open_file(const std::filesystem::path& __p, size_type __bytes, bool __create = true);
+
+            /** @brief map __bytes of zeroed memory shared with children created by fork() */
+            static mapped_region anonymous_shared(size_type __bytes);
+
+            /** @brief move constructor */
+            mapped_region(mapped_region&& __x) noexcept
+                : __data_{std::exchange(__x.__data_, nullptr)}, __size_{std::exchange(__x.__size_, 0)} {}
+
+            /** @brief move assignment operator */
+            mapped_region& operator=(mapped_region&& __x) noexcept {
+                if (this != &__x) {
+                    __unmap();
+                    __data_ = std::exchange(__x.__data_, nullptr);
+                    __size_ = std::exchange(__x.__size_, 0);
+                }
+                return *this;
+            }
+
+            mapped_region(const mapped_region&) = delete;
+            mapped_region& operator=(const mapped_region&) = delete;
+
+            /** @brief destructor */
+            ~mapped_region() { __unmap(); }
+
+            /** @brief return the first byte of the mapping */
+            std::byte* data() const noexcept { return __data_; }
+
+            /** @brief return the length of the mapping in bytes */
+            size_type size() const noexcept { return __size_; }
+
+            /** @brief write the dirty pages of a file mapping back to the file */
+            void flush() const {
+                if (__data_ != nullptr && ::msync(__data_, __size_, MS_SYNC) != 0) __throw_errno("mapped_region: msync");
+            }
+
+        private:
+            std::byte* __data_ = nullptr;       //!< start of the mapping
+            size_type __size_ = 0;              //!< length of the mapping
+
+            mapped_region(void* __m, size_type __bytes) noexcept : __data_{static_cast<std::byte*>(__m)}, __size_{__bytes} {}
+
+            [[noreturn]] static void __throw_errno(const char* __what) {
+                throw std::system_error(errno, std::generic_category(), __what);
+            }
+
+            void __unmap() noexcept {
+                if (__data_ != nullptr) ::munmap(__data_, __size_);
+            }
+    };
+}   /* namespace dsa */
+
+/* Map __bytes of the file at __p read-write, creating it if __create and zero-filling it as needed */
+inline dsa::mapped_region dsa::mapped_region::open_file(const std::filesystem::path& __p, size_type __bytes, bool __create) {
+    const int __fd = ::open(__p.c_str(), __create ? O_RDWR | O_CREAT : O_RDWR, 0644);
+    if (__fd < 0) __throw_errno("mapped_region: open");
+    struct stat __st;
+    if (::fstat(__fd, &__st) != 0 || (static_cast<size_type>(__st.st_size) < __bytes && ::ftruncate(__fd, __bytes) != 0)) {
+        const int __e = errno;
+        ::close(__fd);
+        errno = __e;
+        __throw_errno("mapped_region: size");
+    }
+    void* __m = ::mmap(nullptr, __bytes, PROT_READ | PROT_WRITE, MAP_SHARED, __fd, 0);
+    const int __e = errno;
+    ::close(__fd);                          /* the mapping keeps the file open */
+    if (__m == MAP_FAILED) {
+        errno = __e;
+        __throw_errno("mapped_region: mmap");
+    }
+    return mapped_region{__m, __bytes};
+}
+
+/* Map __bytes of anonymous memory that survives fork() as shared */
+inline dsa::mapped_region dsa::mapped_region::anonymous_shared(size_type __bytes) {
+    void* __m = ::mmap(nullptr, __bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (__m == MAP_FAILED) __throw_errno("mapped_region: mmap");
+    return mapped_region{__m, __bytes};
+}
+
+#endif /* MAPPED_REGION_H */
@@ -0,0 +1,277 @@
+/**
+ * @file    MemoryUsage.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   Memory footprint of the dsa containers and a process-wide registry of them
+*/
+
+#ifndef MEMORY_USAGE_H
+#define MEMORY_USAGE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#endif
+
+namespace dsa {
+    /**
+     * @brief memory held by a container, returned by the memory_usage() members
+     *
+     * payload_bytes is sizeof(value_type) per element. overhead_bytes is everything else the
+     * container owns: the container object itself, links, control bytes, index maps and
+     * allocated but unused capacity. slack_bytes is what the allocator adds on top of the
+     * requested sizes, see allocation_slack().
+    */
+    struct memory_footprint {
+        std::size_t payload_bytes = 0;      //!< bytes of the stored values
+        std::size_t overhead_bytes = 0;     //!< bytes of the structure around the values
+        std::size_t slack_bytes = 0;        //!< estimated allocator headers and rounding
+        std::size_t allocations = 0;        //!< number of live heap allocations
+
+        /** @brief return the bytes the container costs in total */
+        std::size_t total() const noexcept { return payload_bytes + overhead_bytes + slack_bytes; }
+
+        /** @brief accumulate another footprint */
+        memory_footprint& operator+=(const memory_footprint& __x) noexcept {
+            payload_bytes += __x.payload_bytes;
+            overhead_bytes += __x.overhead_bytes;
+            slack_bytes += __x.slack_bytes;
+            allocations += __x.allocations;
+            return *this;
+        }
+
+        /** @brief return the sum of two footprints */
+        friend memory_footprint operator+(memory_footprint __x, const memory_footprint& __y) noexcept {
+            return __x += __y;
+        }
+    };
+
+    /**
+     * @brief
+     *      estimate the bytes the default allocator spends on top of a request of __bytes
+     *
+     * @param[in]
+     *      __bytes: requested size
+     * @param[in]
+     *      __align: requested alignment
+     *
+     * @return
+     *      header and rounding bytes of the chunk, 0 for an empty request
+     *
+     * @note
+     *      Models a boundary-tag malloc such as glibc's: one size_t header, chunks rounded
+     *      to 2 * sizeof(void*) with a minimum of 4 * sizeof(void*), and worst-case padding
+     *      for over-aligned requests. The containers allocate through std::allocator or
+     *      ::operator new, so this is the allocator they see unless it is replaced.
+    */
+    constexpr std::size_t allocation_slack(std::size_t __bytes, std::size_t __align = alignof(std::max_align_t)) noexcept {
+        if (__bytes == 0) return 0;
+        constexpr std::size_t __header = sizeof(std::size_t);
+        constexpr std::size_t __granule = 2 * sizeof(void*);
+        constexpr std::size_t __min_chunk = 4 * sizeof(void*);
+        std::size_t __chunk = (__bytes + __header + __granule - 1) & ~(__granule - 1);
+        if (__chunk < __min_chunk) __chunk = __min_chunk;
+        if (__align > __granule) __chunk += __align;
+        return __chunk - __bytes;
+    }
+
+    /** @brief footprint of one heap block of __bytes */
+    constexpr memory_footprint __heap_block(std::size_t __bytes, std::size_t __align = alignof(std::max_align_t)) noexcept {
+        memory_footprint __m;
+        if (__bytes != 0) {
+            __m.overhead_bytes = __bytes;
+            __m.slack_bytes = allocation_slack(__bytes, __align);
+            __m.allocations = 1;
+        }
+        return __m;
+    }
+
+    /** @brief one line of memory_registry::report() */
+    struct memory_report_entry {
+        std::string label;                  //!< label the containers were tracked with
+        std::size_t containers = 0;         //!< number of tracked containers with this label
+        memory_footprint usage;             //!< sum of their footprints
+    };
+
+    /**
+     * @brief process-wide registry of tracked containers
+     *
+     * track() returns a registration that must not outlive the container; the container is
+     * untracked when the registration is destroyed. report() and dump() call memory_usage()
+     * on every tracked container, so they must not run while one of them is being modified.
+    */
+    class memory_registry {
+        public:
+            /** @brief RAII handle of a tracked container */
+            class registration {
+                    friend class memory_registry;
+                    memory_registry* __registry_ = nullptr;
+                    std::uint64_t __id_ = 0;
+
+                    registration(memory_registry* __r, std::uint64_t __id) noexcept : __registry_{__r}, __id_{__id} {}
+
+                public:
+                    registration() = default;
+                    registration(const registration&) = delete;
+                    registration& operator=(const registration&) = delete;
+
+                    /** @brief move constructor */
+                    registration(registration&& __x) noexcept : __registry_{__x.__registry_}, __id_{__x.__id_} {
+                        __x.__registry_ = nullptr;
+                    }
+
+                    /** @brief move assignment operator */
+                    registration& operator=(registration&& __x) noexcept {
+                        if (this != &__x) {
+                            reset();
+                            std::swap(__registry_, __x.__registry_);
+                            __id_ = __x.__id_;
+                        }
+                        return *this;
+                    }
+
+                    ~registration() { reset(); }
+
+                    /** @brief stop tracking the container */
+                    void reset() noexcept {
+                        if (__registry_ != nullptr) __registry_->__untrack(__id_);
+                        __registry_ = nullptr;
+                    }
+            };
+
+            memory_registry() = default;
+            memory_registry(const memory_registry&) = delete;
+            memory_registry& operator=(const memory_registry&) = delete;
+
+            /** @brief return the registry shared by the whole process */
+            static memory_registry& global() {
+                static memory_registry __instance;
+                return __instance;
+            }
+
+            /**
+             * @brief
+             *      track __c under __label
+             *
+             * @param[in]
+             *      __c: container with a memory_usage() member
+             * @param[in]
+             *      __label: name the footprint is summed under, the container type by default
+             *
+             * @return
+             *      registration that untracks __c when destroyed
+            */
+            template <class _Container>
+            [[nodiscard]] registration track(const _Container& __c, std::string __label = __type_name<_Container>()) {
+                const _Container* __p = std::addressof(__c);
+                std::lock_guard<std::mutex> __guard{__lock_};
+                const std::uint64_t __id = ++__last_id_;
+                __entries_.emplace(__id, __entry{std::move(__label), [__p] { return __p->memory_usage(); }});
+                return registration{this, __id};
+            }
+
+            /** @brief return the number of tracked containers */
+            std::size_t size() const {
+                std::lock_guard<std::mutex> __guard{__lock_};
+                return __entries_.size();
+            }
+
+            std::vector<memory_report_entry> report() const;
+            void dump(std::ostream& __os) const;
+
+        private:
+            struct __entry {
+                std::string __label_;
+                std::function<memory_footprint()> __probe_;
+            };
+
+            mutable std::mutex __lock_;
+            std::map<std::uint64_t, __entry> __entries_;
+            std::uint64_t __last_id_ = 0;
+
+            void __untrack(std::uint64_t __id) noexcept {
+                std::lock_guard<std::mutex> __guard{__lock_};
+                __entries_.erase(__id);
+            }
+
+            template <class _Tp>
+            static std::string __type_name() {
+                const char* __mangled = typeid(_Tp).name();
+#if defined(__GNUC__)
+                int __status = 0;
+                std::unique_ptr<char, void (*)(void*)> __demangled{abi::__cxa_demangle(__mangled, nullptr, nullptr, &__status), std::free};
+                if (__status == 0 && __demangled) return __demangled.get();
+#endif
+                return __mangled;
+            }
+    };
+
+    /**
+     * @brief
+     *      sum the footprints of the tracked containers per label
+     *
+     * @return
+     *      one entry per label, largest total first
+    */
+    inline std::vector<memory_report_entry> memory_registry::report() const {
+        std::map<std::string, memory_report_entry> __by_label;
+        {
+            std::lock_guard<std::mutex> __guard{__lock_};
+            for (const auto& __e : __entries_) {
+                memory_report_entry& __r = __by_label[__e.second.__label_];
+                ++__r.containers;
+                __r.usage += __e.second.__probe_();
+            }
+        }
+
+        std::vector<memory_report_entry> __out;
+        __out.reserve(__by_label.size());
+        for (auto& __kv : __by_label) {
+            __kv.second.label = __kv.first;
+            __out.push_back(std::move(__kv.second));
+        }
+        std::stable_sort(__out.begin(), __out.end(), [](const memory_report_entry& __a, const memory_report_entry& __b) {
+            return __a.usage.total() > __b.usage.total();
+        });
+        return __out;
+    }
+
+    /** @brief write report() as a table, one label per line followed by the grand total */
+    inline void memory_registry::dump(std::ostream& __os) const {
+        const std::vector<memory_report_entry> __rows = report();
+        memory_footprint __sum;
+        std::size_t __containers = 0;
+
+        __os << std::left << std::setw(48) << "label" << std::right << std::setw(12) << "containers"
+             << std::setw(16) << "payload" << std::setw(16) << "overhead" << std::setw(16) << "slack"
+             << std::setw(16) << "total" << '\n';
+        auto __line = [&__os](const std::string& __label, std::size_t __n, const memory_footprint& __m) {
+            __os << std::left << std::setw(48) << __label << std::right << std::setw(12) << __n
+                 << std::setw(16) << __m.payload_bytes << std::setw(16) << __m.overhead_bytes
+                 << std::setw(16) << __m.slack_bytes << std::setw(16) << __m.total() << '\n';
+        };
+        for (const memory_report_entry& __r : __rows) {
+            __line(__r.label, __r.containers, __r.usage);
+            __sum += __r.usage;
+            __containers += __r.containers;
+        }
+        __line("total", __containers, __sum);
+    }
+}   /* namespace dsa */
+
+#endif /* MEMORY_USAGE_H */
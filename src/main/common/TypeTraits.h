@@ -0,0 +1,45 @@
+/**
+ * @file    TypeTraits.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   Type traits the dsa containers use to pick their fast paths
+*/
+
+#ifndef TYPE_TRAITS_H
+#define TYPE_TRAITS_H
+
+#include <type_traits>
+#include <utility>
+
+namespace dsa {
+    /**
+     * @brief
+     *      whether an object of type _Tp can be moved to another address by copying its bytes,
+     *      after which the source is treated as raw storage and is not destroyed
+     *
+     * @note
+     *      True for trivially copyable types. Specialize it as std::true_type for a type whose
+     *      move constructor followed by the destruction of the source is equivalent to a
+     *      memcpy, e.g. a type that owns a heap object but holds no pointer into itself:
+     *
+     *          template <> struct dsa::is_trivially_relocatable<my_handle> : std::true_type {};
+     *
+     *      The containers then relocate such elements with memcpy when they move them to new
+     *      storage (flat_hash_map rehash, doubly_linked_list::defragment()).
+    */
+    template <class _Tp>
+    struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<_Tp>> {};
+
+    /** @brief a pair is relocatable when both members are, whatever its assignment operators */
+    template <class _T1, class _T2>
+    struct is_trivially_relocatable<std::pair<_T1, _T2>>
+        : std::bool_constant<is_trivially_relocatable<std::remove_cv_t<_T1>>::value &&
+                             is_trivially_relocatable<std::remove_cv_t<_T2>>::value> {};
+
+    /** @brief is_trivially_relocatable<_Tp>::value, cv-qualifiers ignored */
+    template <class _Tp>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<std::remove_cv_t<_Tp>>::value;
+}   /* namespace dsa */
+
+#endif /* TYPE_TRAITS_H */
@@ -0,0 +1,715 @@
+/**
+ * @file    Deque.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A block-based double-ended queue with a tunable block size and a block cache.
+*/
+
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "Algorithm.h"
+#include "ErrorPolicy.h"
+#include "MemoryUsage.h"
+
+namespace dsa {
+    template <class _Tp, std::size_t _BlockBytes, class _Policy>
+    class deque;
+
+    /**
+     * @brief
+     *      deque iterator, a (container, index) pair
+     *  @note
+     *      The iterator category is random_access_iterator
+    */
+    template <class _Tp, std::size_t _BlockBytes, class _Policy, bool _Const>
+    class __deque_iterator {
+            friend class deque<_Tp, _BlockBytes, _Policy>;
+            friend class __deque_iterator<_Tp, _BlockBytes, _Policy, !_Const>;
+
+            using __deque_pointer = std::conditional_t<_Const, const deque<_Tp, _BlockBytes, _Policy>*, deque<_Tp, _BlockBytes, _Policy>*>;
+            __deque_pointer __d_;               //!< owning deque
+            std::size_t __i_;                   //!< position from the front
+
+        public:
+            using value_type = _Tp;                                                 //!< value_type
+            using reference = std::conditional_t<_Const, const _Tp&, _Tp&>;         //!< reference
+            using pointer = std::conditional_t<_Const, const _Tp*, _Tp*>;           //!< pointer
+            using difference_type = std::ptrdiff_t;                                 //!< distance
+            using iterator_category = std::random_access_iterator_tag;              //!< category
+
+            __deque_iterator() noexcept : __d_{nullptr}, __i_{0} {}
+            __deque_iterator(__deque_pointer __d, std::size_t __i) noexcept : __d_{__d}, __i_{__i} {}
+
+            /** @brief conversion from iterator to const_iterator */
+            template <bool _R, class = std::enable_if_t<_Const && !_R>>
+            __deque_iterator(const __deque_iterator<_Tp, _BlockBytes, _Policy, _R>& __x) noexcept : __d_{__x.__d_}, __i_{__x.__i_} {}
+
+            reference operator*() const { return (*__d_)[__i_]; }
+            pointer operator->() const { return std::addressof((*__d_)[__i_]); }
+            reference operator[](difference_type __n) const { return (*__d_)[__i_ + __n]; }
+
+            __deque_iterator& operator++() { ++__i_; return *this; }
+            __deque_iterator operator++(int) { __deque_iterator __t{*this}; ++__i_; return __t; }
+            __deque_iterator& operator--() { --__i_; return *this; }
+            __deque_iterator operator--(int) { __deque_iterator __t{*this}; --__i_; return __t; }
+            __deque_iterator& operator+=(difference_type __n) { __i_ += __n; return *this; }
+            __deque_iterator& operator-=(difference_type __n) { __i_ -= __n; return *this; }
+
+            friend __deque_iterator operator+(__deque_iterator __x, difference_type __n) { return __x += __n; }
+            friend __deque_iterator operator+(difference_type __n, __deque_iterator __x) { return __x += __n; }
+            friend __deque_iterator operator-(__deque_iterator __x, difference_type __n) { return __x -= __n; }
+            friend difference_type operator-(const __deque_iterator& __x, const __deque_iterator& __y) {
+                return static_cast<difference_type>(__x.__i_) - static_cast<difference_type>(__y.__i_);
+            }
+
+            friend bool operator==(const __deque_iterator& __x, const __deque_iterator& __y) { return __x.__i_ == __y.__i_; }
+            friend auto operator<=>(const __deque_iterator& __x, const __deque_iterator& __y) { return __x.__i_ <=> __y.__i_; }
+    };
+
+    /**
+     * @brief deque is a double-ended queue that stores its elements in fixed-size blocks
+     *      indexed by a map of block pointers.
+     *
+     * @tparam
+     *      _Tp the type of stored element
+     * @tparam
+     *      _BlockBytes target size of one block in bytes; a block always holds at least
+     *      16 elements
+     * @tparam
+     *      _Policy what front/back/pop_back/pop_front on an empty deque do, see ErrorPolicy.h;
+     *      unchecked_policy by default, at() always throws
+     *
+     * @note
+     *      Blocks that become empty are kept in a cache and handed out again before new
+     *      memory is requested, so a deque that oscillates around a size does not call
+     *      the allocator once it has reached its high-water mark. shrink_to_fit()
+     *      returns the cached blocks.
+     *      push/pop at either end invalidate iterators but not references to the other
+     *      elements.
+    */
+    template <class _Tp, std::size_t _BlockBytes = 4096, class _Policy = unchecked_policy>
+    class deque {
+        static_assert(dsa::error_policy<_Policy>, "_Policy must be an error policy");
+        public:
+            using value_type = _Tp;                                                 //!< value_type
+            using size_type = std::size_t;                                          //!< size_type
+            using difference_type = std::ptrdiff_t;                                 //!< difference_type
+            using reference = _Tp&;                                                 //!< reference
+            using const_reference = const _Tp&;                                     //!< const_reference
+            using iterator = __deque_iterator<_Tp, _BlockBytes, _Policy, false>;             //!< iterator type
+            using const_iterator = __deque_iterator<_Tp, _BlockBytes, _Policy, true>;        //!< const_iterator type
+            using error_policy = _Policy;                                           //!< precondition policy
+
+            /** @brief number of elements per block */
+            static constexpr size_type block_size = _BlockBytes / sizeof(_Tp) > 16 ? _BlockBytes / sizeof(_Tp) : 16;
+
+            /** @brief default constructor, does not allocate */
+            deque() noexcept
+                : __map_{nullptr}, __map_cap_{0}, __map_first_{0}, __map_size_{0},
+                  __start_{0}, __size_{0}, __free_blocks_{nullptr}, __free_count_{0} {}
+
+            /** @brief construct with the elements of the initializer list */
+            deque(std::initializer_list<_Tp> __il) : deque() {
+                for (const _Tp& __v : __il) push_back(__v);
+            }
+
+            /** @brief copy constructor */
+            deque(const deque& __x) : deque() {
+                reserve(__x.size());
+                if constexpr (std::is_trivially_copyable_v<_Tp>) {
+                    __copy_blocks(__x);
+                } else {
+                    for (const _Tp& __v : __x) push_back(__v);
+                }
+            }
+
+            /** @brief move constructor */
+            deque(deque&& __x) noexcept : deque() { swap(__x); }
+
+            /** @brief copy assignment operator */
+            deque& operator=(const deque& __x) {
+                if (this != &__x) {
+                    deque __t{__x};
+                    swap(__t);
+                }
+                return *this;
+            }
+
+            /** @brief move assignment operator */
+            deque& operator=(deque&& __x) noexcept {
+                deque __t{std::move(__x)};
+                swap(__t);
+                return *this;
+            }
+
+            /** @brief default destructor */
+            ~deque() {
+                clear();
+                __release_cache();
+                __deallocate_map(__map_, __map_cap_);
+            }
+
+            /** @brief return the number of elements */
+            size_type size() const noexcept { return __size_; }
+
+            /** @brief check whether the deque is empty */
+            bool empty() const noexcept { return __size_ == 0; }
+
+            /** @brief return the number of blocks kept for reuse */
+            size_type cached_blocks() const noexcept { return __free_count_; }
+
+            /** @brief return an iterator to the first element */
+            iterator begin() noexcept { return iterator{this, 0}; }
+
+            /** @brief return an iterator to the end */
+            iterator end() noexcept { return iterator{this, __size_}; }
+
+            /** @brief return a constant iterator to the first element */
+            const_iterator begin() const noexcept { return const_iterator{this, 0}; }
+
+            /** @brief return a constant iterator to the end */
+            const_iterator end() const noexcept { return const_iterator{this, __size_}; }
+
+            /** @brief return a constant iterator to the first element */
+            const_iterator cbegin() const noexcept { return begin(); }
+
+            /** @brief return a constant iterator to the end */
+            const_iterator cend() const noexcept { return end(); }
+
+            /** @brief return a reference to the element at position __i, no bounds checking */
+            reference operator[](size_type __i) noexcept {
+                const size_type __p = __start_ + __i;
+                return __map_[__map_first_ + __p / block_size][__p % block_size];
+            }
+
+            /** @brief return a constant reference to the element at position __i, no bounds checking */
+            const_reference operator[](size_type __i) const noexcept {
+                const size_type __p = __start_ + __i;
+                return __map_[__map_first_ + __p / block_size][__p % block_size];
+            }
+
+            /** @brief return the number of blocks holding elements, see segment() */
+            size_type segment_count() const noexcept { return __size_ == 0 ? 0 : (__start_ + __size_ - 1) / block_size + 1; }
+
+            /** @brief return the elements held by block __i of segment_count(), front to back */
+            std::span<const _Tp> segment(size_type __i) const noexcept {
+                const size_type __first = __i == 0 ? __start_ : 0;
+                const size_type __last = std::min(block_size, __start_ + __size_ - __i * block_size);
+                return {__map_[__map_first_ + __i] + __first, __last - __first};
+            }
+
+            /** @brief check whether __x and __y hold equal elements, see dsa::equal() */
+            friend bool operator==(const deque& __x, const deque& __y) { return dsa::equal(__x, __y); }
+
+            /** @brief return a reference to the element at position __i, throw std::out_of_range if out of bounds */
+            reference at(size_type __i) {
+                if (__i >= __size_) throw std::out_of_range("Index out of range");
+                return (*this)[__i];
+            }
+
+            /** @brief return a constant reference to the element at position __i, throw std::out_of_range if out of bounds */
+            const_reference at(size_type __i) const {
+                if (__i >= __size_) throw std::out_of_range("Index out of range");
+                return (*this)[__i];
+            }
+
+            /** @brief return a reference to the first element */
+            reference front() noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "Empty deque");
+                return __map_[__map_first_][__start_];
+            }
+
+            /** @brief return a constant reference to the first element */
+            const_reference front() const noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "Empty deque");
+                return __map_[__map_first_][__start_];
+            }
+
+            /** @brief return a reference to the last element */
+            reference back() noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "Empty deque");
+                return (*this)[__size_ - 1];
+            }
+
+            /** @brief return a constant reference to the last element */
+            const_reference back() const noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "Empty deque");
+                return (*this)[__size_ - 1];
+            }
+
+            /** @brief append a copy of __x */
+            void push_back(const _Tp& __x) { emplace_back(__x); }
+
+            /** @brief append __x */
+            void push_back(_Tp&& __x) { emplace_back(std::move(__x)); }
+
+            /** @brief prepend a copy of __x */
+            void push_front(const _Tp& __x) { emplace_front(__x); }
+
+            /** @brief prepend __x */
+            void push_front(_Tp&& __x) { emplace_front(std::move(__x)); }
+
+            template <class... _Args>
+            reference emplace_back(_Args&&... __args);
+
+            template <class... _Args>
+            reference emplace_front(_Args&&... __args);
+
+            /** @brief remove the last element, see _Policy for an empty deque */
+            void pop_back() noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "Empty deque");
+                __pop_back();
+            }
+
+            /** @brief remove the first element, see _Policy for an empty deque */
+            void pop_front() noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "Empty deque");
+                __pop_front();
+            }
+
+            /** @brief remove and return the last element, std::nullopt if the deque is empty */
+            std::optional<_Tp> try_pop_back() noexcept(std::is_nothrow_move_constructible_v<_Tp>) {
+                if (__size_ == 0) return std::nullopt;
+                std::optional<_Tp> __v{std::move((*this)[__size_ - 1])};
+                __pop_back();
+                return __v;
+            }
+
+            /** @brief remove and return the first element, std::nullopt if the deque is empty */
+            std::optional<_Tp> try_pop_front() noexcept(std::is_nothrow_move_constructible_v<_Tp>) {
+                if (__size_ == 0) return std::nullopt;
+                std::optional<_Tp> __v{std::move(__map_[__map_first_][__start_])};
+                __pop_front();
+                return __v;
+            }
+            void clear() noexcept;
+
+            void reserve(size_type __n);
+            void shrink_to_fit() noexcept;
+
+            memory_footprint memory_usage() const noexcept;
+
+            /** @brief exchange the contents with __x */
+            void swap(deque& __x) noexcept {
+                std::swap(__map_, __x.__map_);
+                std::swap(__map_cap_, __x.__map_cap_);
+                std::swap(__map_first_, __x.__map_first_);
+                std::swap(__map_size_, __x.__map_size_);
+                std::swap(__start_, __x.__start_);
+                std::swap(__size_, __x.__size_);
+                std::swap(__free_blocks_, __x.__free_blocks_);
+                std::swap(__free_count_, __x.__free_count_);
+            }
+
+        private:
+            using __block_pointer = _Tp*;
+            using __block_alloc_traits = std::allocator_traits<std::allocator<_Tp>>;
+            using __map_alloc_traits = std::allocator_traits<std::allocator<__block_pointer>>;
+
+            __block_pointer* __map_;            //!< block pointers, the blocks in use are [__map_first_, __map_first_ + __map_size_)
+            size_type __map_cap_;               //!< number of entries of __map_
+            size_type __map_first_;             //!< index in __map_ of the first block in use
+            size_type __map_size_;              //!< number of blocks in use
+            size_type __start_;                 //!< offset of the first element in the first block
+            size_type __size_;                  //!< number of elements
+            void* __free_blocks_;               //!< cached blocks, linked through their first bytes
+            size_type __free_count_;            //!< number of cached blocks
+
+            __block_pointer __acquire_block();
+            void __release_block(__block_pointer __b) noexcept;
+            void __release_cache() noexcept;
+            void __reorganize_map(size_type __extra_front, size_type __extra_back);
+            void __copy_blocks(const deque& __x) noexcept;
+            void __pop_back() noexcept;
+            void __pop_front() noexcept;
+
+            static void __deallocate_map(__block_pointer* __map, size_type __cap) noexcept {
+                if (__map != nullptr) {
+                    typename __map_alloc_traits::allocator_type __ma;
+                    __map_alloc_traits::deallocate(__ma, __map, __cap);
+                }
+            }
+    };
+};      /* namespace dsa */
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Take a block from the cache, or allocate one if the cache is empty
+**
+** @return
+**       an uninitialized block of block_size elements
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _BlockBytes, class _Policy>
+typename dsa::deque<_Tp, _BlockBytes, _Policy>::__block_pointer dsa::deque<_Tp, _BlockBytes, _Policy>::__acquire_block() {
+    if (__free_blocks_ != nullptr) {
+        void* __b = __free_blocks_;
+        __free_blocks_ = *static_cast<void**>(__b);
+        --__free_count_;
+        return static_cast<__block_pointer>(__b);
+    }
+    typename __block_alloc_traits::allocator_type __ba;
+    return __block_alloc_traits::allocate(__ba, block_size);
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Put an empty block back into the cache
+**
+** @note
+**       A block holds at least 16 elements, so it always has room for the link pointer
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _BlockBytes, class _Policy>
+void dsa::deque<_Tp, _BlockBytes, _Policy>::__release_block(__block_pointer __b) noexcept {
+    ::new (static_cast<void*>(__b)) void*(__free_blocks_);
+    __free_blocks_ = __b;
+    ++__free_count_;
+}
+
+template <class _Tp, std::size_t _BlockBytes, class _Policy>
+void dsa::deque<_Tp, _BlockBytes, _Policy>::__release_cache() noexcept {
+    typename __block_alloc_traits::allocator_type __ba;
+    while (__free_blocks_ != nullptr) {
+        void* __b = __free_blocks_;
+        __free_blocks_ = *static_cast<void**>(__b);
+        __block_alloc_traits::deallocate(__ba, static_cast<__block_pointer>(__b), block_size);
+    }
+    __free_count_ = 0;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Make room in the map for __extra_front blocks before and __extra_back blocks after
+**      the blocks in use
+**
+** @note
+**       Re-centers the map in place while it is at most half full, otherwise grows it
+**       geometrically. Complexity: O(number of blocks)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _BlockBytes, class _Policy>
+void dsa::deque<_Tp, _BlockBytes, _Policy>::__reorganize_map(size_type __extra_front, size_type __extra_back) {
+    const size_type __need = __map_size_ + __extra_front + __extra_back;
+    if (2 * __need <= __map_cap_) {
+        const size_type __new_first = __extra_front + (__map_cap_ - __need) / 2;
+        std::memmove(__map_ + __new_first, __map_ + __map_first_, __map_size_ * sizeof(__block_pointer));
+        __map_first_ = __new_first;
+        return;
+    }
+
+    const size_type __new_cap = std::max<size_type>({8, 2 * __map_cap_, 2 * __need});
+    typename __map_alloc_traits::allocator_type __ma;
+    __block_pointer* __new_map = __map_alloc_traits::allocate(__ma, __new_cap);
+    const size_type __new_first = __extra_front + (__new_cap - __need) / 2;
+    if (__map_size_ != 0)
+        std::memcpy(__new_map + __new_first, __map_ + __map_first_, __map_size_ * sizeof(__block_pointer));
+    __deallocate_map(__map_, __map_cap_);
+    __map_ = __new_map;
+    __map_cap_ = __new_cap;
+    __map_first_ = __new_first;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      The element is constructed with input parameters and appended to the end of the deque
+**
+** @param [in]
+**      args: the arguments args... are forwarded to the constructor as std::forward<_Args>(args)...
+**
+** @return
+**       reference to the new element
+**
+** @note
+**       Complexity: O(1) amortized. Strong exception guarantee.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _BlockBytes, class _Policy>
+template <class... _Args>
+typename dsa::deque<_Tp, _BlockBytes, _Policy>::reference dsa::deque<_Tp, _BlockBytes, _Policy>::emplace_back(_Args&&... __args) {
+    const size_type __p = __start_ + __size_;
+    if (__p == __map_size_ * block_size) {
+        if (__map_first_ + __map_size_ == __map_cap_) __reorganize_map(0, 1);
+        __block_pointer __b = __acquire_block();
+        try {
+            ::new (static_cast<void*>(__b)) _Tp(std::forward<_Args>(__args)...);
+        } catch (...) {
+            __release_block(__b);
+            throw;
+        }
+        __map_[__map_first_ + __map_size_++] = __b;
+        ++__size_;
+        return *__b;
+    }
+
+    _Tp* __slot = __map_[__map_first_ + __p / block_size] + __p % block_size;
+    ::new (static_cast<void*>(__slot)) _Tp(std::forward<_Args>(__args)...);
+    ++__size_;
+    return *__slot;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      The element is constructed with input parameters and prepended to the beginning of the deque
+**
+** @param [in]
+**      args: the arguments args... are forwarded to the constructor as std::forward<_Args>(args)...
+**
+** @return
+**       reference to the new element
+**
+** @note
+**       Complexity: O(1) amortized. Strong exception guarantee.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _BlockBytes, class _Policy>
+template <class... _Args>
+typename dsa::deque<_Tp, _BlockBytes, _Policy>::reference dsa::deque<_Tp, _BlockBytes, _Policy>::emplace_front(_Args&&... __args) {
+    if (__start_ == 0) {
+        if (__map_first_ == 0) __reorganize_map(1, 0);
+        __block_pointer __b = __acquire_block();
+        try {
+            ::new (static_cast<void*>(__b + block_size - 1)) _Tp(std::forward<_Args>(__args)...);
+        } catch (...) {
+            __release_block(__b);
+            throw;
+        }
+        __map_[--__map_first_] = __b;
+        ++__map_size_;
+        __start_ = block_size - 1;
+        ++__size_;
+        return __b[__start_];
+    }
+
+    _Tp* __slot = __map_[__map_first_] + __start_ - 1;
+    ::new (static_cast<void*>(__slot)) _Tp(std::forward<_Args>(__args)...);
+    --__start_;
+    ++__size_;
+    return *__slot;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Remove the last element of the deque. The deque must not be empty.
+**
+** @note
+**       Complexity: O(1). A block left empty goes back to the block cache.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _BlockBytes, class _Policy>
+void dsa::deque<_Tp, _BlockBytes, _Policy>::__pop_back() noexcept {
+    std::destroy_at(std::addressof((*this)[__size_ - 1]));
+    --__size_;
+    if (__map_size_ * block_size - (__start_ + __size_) >= block_size) {
+        __release_block(__map_[__map_first_ + __map_size_ - 1]);
+        --__map_size_;
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Remove the first element of the deque. The deque must not be empty.
+**
+** @note
+**       Complexity: O(1). A block left empty goes back to the block cache.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _BlockBytes, class _Policy>
+void dsa::deque<_Tp, _BlockBytes, _Policy>::__pop_front() noexcept {
+    std::destroy_at(std::addressof(__map_[__map_first_][__start_]));
+    --__size_;
+    if (++__start_ == block_size) {
+        __release_block(__map_[__map_first_++]);
+        --__map_size_;
+        __start_ = 0;
+    } else if (__size_ == 0) {
+        /* Rewind inside the remaining block so that a FIFO that drains does not drift */
+        __start_ = 0;
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Remove every element. The blocks go to the block cache and the map is kept.
+**
+** @note
+**       Complexity: O(n), O(number of blocks) for a trivially destructible _Tp
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _BlockBytes, class _Policy>
+void dsa::deque<_Tp, _BlockBytes, _Policy>::clear() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<_Tp>) {
+        for (size_type __i = 0; __i < __size_; ++__i)
+            std::destroy_at(std::addressof((*this)[__i]));
+    }
+    for (size_type __b = 0; __b < __map_size_; ++__b)
+        __release_block(__map_[__map_first_ + __b]);
+    __map_first_ = __map_cap_ / 2;
+    __map_size_ = 0;
+    __start_ = 0;
+    __size_ = 0;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Fill an empty deque with a copy of __x, one memcpy per source segment
+**
+** @note
+**       Only used for a trivially copyable _Tp, after reserve(__x.size()) has put the
+**       blocks in the cache and made room in the map.
+**       Complexity: O(n)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _BlockBytes, class _Policy>
+void dsa::deque<_Tp, _BlockBytes, _Policy>::__copy_blocks(const deque& __x) noexcept {
+    size_type __i = 0;
+    while (__i < __x.__size_) {
+        __block_pointer __b = __acquire_block();
+        __map_[__map_first_ + __map_size_++] = __b;
+        const size_type __fill = std::min(block_size, __x.__size_ - __i);
+        /* A destination block spans at most two source blocks */
+        for (size_type __done = 0; __done < __fill;) {
+            const size_type __p = __x.__start_ + __i + __done;
+            const size_type __off = __p % block_size;
+            const size_type __n = std::min(__fill - __done, block_size - __off);
+            std::memcpy(static_cast<void*>(__b + __done), __x.__map_[__x.__map_first_ + __p / block_size] + __off, __n * sizeof(_Tp));
+            __done += __n;
+        }
+        __i += __fill;
+    }
+    __size_ = __x.__size_;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Make sure that appending elements until size() == __n needs no allocation
+**
+** @note
+**       Missing blocks are allocated into the block cache.
+**       Complexity: O(number of blocks)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _BlockBytes, class _Policy>
+void dsa::deque<_Tp, _BlockBytes, _Policy>::reserve(size_type __n) {
+    if (__n <= __size_) return;
+    const size_type __blocks = (__start_ + __n + block_size - 1) / block_size;
+    if (__blocks <= __map_size_) return;
+
+    const size_type __extra = __blocks - __map_size_;
+    if (__map_cap_ - __map_first_ - __map_size_ < __extra) __reorganize_map(0, __extra);
+
+    typename __block_alloc_traits::allocator_type __ba;
+    while (__free_count_ < __extra)
+        __release_block(__block_alloc_traits::allocate(__ba, block_size));
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Return the cached blocks to the allocator and shrink the map to the blocks in use
+**
+** @note
+**       Complexity: O(number of blocks)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _BlockBytes, class _Policy>
+void dsa::deque<_Tp, _BlockBytes, _Policy>::shrink_to_fit() noexcept {
+    __release_cache();
+    if (__map_size_ == 0) {
+        __deallocate_map(__map_, __map_cap_);
+        __map_ = nullptr;
+        __map_cap_ = __map_first_ = 0;
+        __start_ = 0;
+        return;
+    }
+    if (__map_cap_ <= __map_size_ + 2) return;
+
+    /* Keep one free entry at each end so that the next push does not reallocate at once */
+    const size_type __new_cap = __map_size_ + 2;
+    typename __map_alloc_traits::allocator_type __ma;
+    __block_pointer* __new_map;
+    try {
+        __new_map = __map_alloc_traits::allocate(__ma, __new_cap);
+    } catch (...) {
+        return;
+    }
+    std::memcpy(__new_map + 1, __map_ + __map_first_, __map_size_ * sizeof(__block_pointer));
+    __deallocate_map(__map_, __map_cap_);
+    __map_ = __new_map;
+    __map_cap_ = __new_cap;
+    __map_first_ = 1;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Report the memory held by the deque
+**
+** @return
+**       payload, unused block capacity (cached blocks included), block map and estimated allocator slack
+**
+** @note
+**       Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _BlockBytes, class _Policy>
+dsa::memory_footprint dsa::deque<_Tp, _BlockBytes, _Policy>::memory_usage() const noexcept {
+    const size_type __blocks = __map_size_ + __free_count_;
+    memory_footprint __m;
+    __m.payload_bytes = __size_ * sizeof(_Tp);
+    __m.overhead_bytes = sizeof(*this) + __blocks * block_size * sizeof(_Tp) - __m.payload_bytes;
+    __m.slack_bytes = __blocks * allocation_slack(block_size * sizeof(_Tp), alignof(_Tp));
+    __m.allocations = __blocks;
+    return __m += __heap_block(__map_cap_ * sizeof(__block_pointer));
+}
+#endif /* DEQUE_H */
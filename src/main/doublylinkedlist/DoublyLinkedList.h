@@ -10,28 +10,44 @@
 #ifndef D_LINKLIST_H
 #define D_LINKLIST_H
 
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
 #include <iostream>
 #include <sstream>
+#include <functional>
 #include <iterator>
 #include <memory>
-#include <iterator>
+#include <optional>
 #include <type_traits>
+#include <utility>
+#include <vector>
 // #include <__cxx_version>
 #include <assert.h>
 
+#include "ErrorPolicy.h"
+#include "MemoryUsage.h"
+#include "TypeTraits.h"
+
 #if defined(__GNUC__)
 #define _LIBCPP_TEMPLATE_VIS  _GLIBCXX_VISIBILITY(default)
 #define _LIBCPP_INLINE_VISIBILITY _GLIBCXX_VISIBILITY(hidden)
 #define _LIBCPP_NODISCARD_ATTRIBUTE _GLIBCXX_NODISCARD
+#define _DSA_PREFETCH(__p) __builtin_prefetch(__p)
+#else
+#define _DSA_PREFETCH(__p) ((void)(__p))
 #endif
 
 namespace dsa {
-    template < class _Tp>
+    template <class _Tp, class _Policy = checked_policy>
     class doubly_linked_list;
 
     template <class _Tp>
     class __list_const_iterator;
 
+    template <class _Tp>
+    struct __list_node_base;
+
     template <class _Tp>
     struct __list_node;
 
@@ -39,12 +55,13 @@ namespace dsa {
     template <class _Tp>
     class _LIBCPP_TEMPLATE_VIS __list_iterator
     {
-            friend class doubly_linked_list<_Tp>;       //!< Friend class of class doubly_linked_list
+            template <class, class> friend class doubly_linked_list;   //!< Friend class of class doubly_linked_list
             friend class __list_const_iterator<_Tp>;    //!< Friend class of __list_const_iterator
 
         private:
+            using __base_pointer = __list_node_base<_Tp>*;              //!< typename pointer to __list_node_base
             using __node_pointer = __list_node<_Tp>*;                   //!< typename pointer to __list_node
-            __node_pointer __ptr_;                                      //!< pointer to the nodes of the doubly_linked_list
+            __base_pointer __ptr_;                                      //!< pointer to the nodes of the doubly_linked_list
 
         public:
             using value_type = _Tp;                                     //!< _Tp
@@ -64,7 +81,7 @@ namespace dsa {
              * 
             */
             _LIBCPP_INLINE_VISIBILITY
-            explicit __list_iterator(__node_pointer __p) noexcept : __ptr_{__p} {}
+            explicit __list_iterator(__base_pointer __p) noexcept : __ptr_{__p} {}
 
             /**
              * @brief 
@@ -85,6 +102,14 @@ namespace dsa {
             _LIBCPP_INLINE_VISIBILITY
             __list_iterator(const __list_iterator& __p) : __ptr_{__p.__ptr_} {}
 
+            /**
+             * @brief
+             *      Copy assignment operator
+             *
+            */
+            _LIBCPP_INLINE_VISIBILITY
+            __list_iterator& operator=(const __list_iterator& __p) = default;
+
             /**
              * @brief 
              *      return the rvalue-reference to the current element
@@ -95,7 +120,7 @@ namespace dsa {
             */
             _LIBCPP_INLINE_VISIBILITY
             reference operator*() const {
-                return __ptr_->__value_; 
+                return static_cast<__node_pointer>(__ptr_)->__value_; 
             }
             
             /**
@@ -108,7 +133,7 @@ namespace dsa {
             */
             _LIBCPP_INLINE_VISIBILITY
             pointer operator->() const {
-                return std::pointer_traits<pointer>::pointer_to(__ptr_->__value_);
+                return std::pointer_traits<pointer>::pointer_to(static_cast<__node_pointer>(__ptr_)->__value_);
             }
 
             /**
@@ -208,11 +233,12 @@ namespace dsa {
     template <class _Tp>
     class _LIBCPP_TEMPLATE_VIS __list_const_iterator
     {
-            friend class doubly_linked_list<_Tp>;       //!< Friend class of doubly_linked_list
+            template <class, class> friend class doubly_linked_list;   //!< Friend class of doubly_linked_list
             
         private:
+            using __base_pointer = __list_node_base<_Tp>*;
             using __node_pointer = __list_node<_Tp>*;
-            __node_pointer __ptr_;
+            __base_pointer __ptr_;
 
         public:
             using value_type = _Tp;                                     //!< _Tp
@@ -233,11 +259,11 @@ namespace dsa {
              *      Constructor
              * 
              * @param[in]
-             *      __p: __node_pointer
+             *      __p: __base_pointer
              * 
             */
             _LIBCPP_INLINE_VISIBILITY
-            explicit __list_const_iterator(__node_pointer __p) noexcept : __ptr_{__p} {}
+            explicit __list_const_iterator(__base_pointer __p) noexcept : __ptr_{__p} {}
 
             /**
              * @brief
@@ -259,7 +285,7 @@ namespace dsa {
             */
             _LIBCPP_INLINE_VISIBILITY
             reference operator*() const {
-                return __ptr_->__value_;
+                return static_cast<__node_pointer>(__ptr_)->__value_;
             }
 
             /**
@@ -272,7 +298,7 @@ namespace dsa {
             */
             _LIBCPP_INLINE_VISIBILITY
             pointer operator->() const {
-                return std::pointer_traits<pointer>::pointer_to(__ptr_->__value_);
+                return std::pointer_traits<pointer>::pointer_to(static_cast<__node_pointer>(__ptr_)->__value_);
             }
 
             /**
@@ -368,14 +394,21 @@ namespace dsa {
             }
     };
 
+    /** 
+     * @brief Links of a __list_node. The list embeds one as its sentinel: the ring
+     *      end <-> first <-> ... <-> last <-> end never has a null link.
+    */
+    template <class _Tp>
+    struct __list_node_base {
+        __list_node_base * __prev_;  //!< pointer to the previous node
+        __list_node_base * __next_;  //!< pointer to the next node
+    };
+
     /** @brief Class __list_node */
     template <class _Tp>
-    struct __list_node {
+    struct __list_node : __list_node_base<_Tp> {
         _Tp __value_;           //!< data
 
-        __list_node * __prev_;  //!< pointer to the previous node
-        __list_node * __next_;  //!< pointer to the next node
-
         // _LIBCPP_INLINE_VISIBILITY
         // __list_node() = default;
 
@@ -386,9 +419,27 @@ namespace dsa {
         // __list_node& operator=(const __list_node<_Tp>& ) = delete; 
     };
 
-    /** @brief class doubly_linked_list */
-    template <class _Tp>
+    /**
+     * @brief what erase(first, last) and clear() do with the removed nodes
+     *
+     * immediate: destroy and deallocate them before returning.
+     * deferred: detach them to a retired chain; they are destroyed by reclaim_some(), reused
+     *      by later insertions, or released with the list.
+    */
+    enum class reclaim_mode { immediate, deferred };
+
+    /**
+     * @brief class doubly_linked_list
+     *
+     * @tparam
+     *      _Tp the type of stored element
+     * @tparam
+     *      _Policy what pop_back/pop_front/front/back on an empty list and erase(end()) do,
+     *      see ErrorPolicy.h; checked_policy throws std::runtime_error
+    */
+    template <class _Tp, class _Policy>
     class doubly_linked_list {
+        static_assert(dsa::error_policy<_Policy>, "_Policy must be an error policy");
         private: 
             using _Alloc = std::allocator_traits<std::allocator<__list_node<_Tp>>>;                 //!< allocator_type
 
@@ -405,13 +456,63 @@ namespace dsa {
             using reference = typename iterator::reference;                                         //!< reference
             using const_reference = typename const_iterator::reference;                             //!< const_reference
             using value_type = _Tp;                                                                 //!< value_type
+            using error_policy = _Policy;                                                           //!< precondition policy
 
             /** @brief default constructor */
-            doubly_linked_list() : __size_{0}, __head_{nullptr}, __tail_{nullptr} {}
+            doubly_linked_list() : __size_{0} {
+                __end_.__prev_ = __end_.__next_ = __end_as_link();
+            }
+
+            /**
+             * @brief construct the list with the contents of the range [first, last)
+             *
+             * @param[in]
+             *      first, last: range to copy the elements from
+            */
+            template <class _InputIt>
+                requires std::input_iterator<_InputIt>
+            doubly_linked_list(_InputIt first, _InputIt last) : doubly_linked_list() {
+                insert(cend(), first, last);
+            }
+
+            /** @brief construct the list with the contents of the initializer list */
+            doubly_linked_list(std::initializer_list<_Tp> __il) : doubly_linked_list(__il.begin(), __il.end()) {}
+
+            /* The sentinel is part of the object, so copies and moves relink the nodes rather than
+             * copying the links */
+
+            /** @brief copy constructor, allocates all nodes in one slab */
+            doubly_linked_list(const doubly_linked_list& __x) : doubly_linked_list(__x.cbegin(), __x.cend()) {}
+
+            /** @brief move constructor, takes over the nodes and slabs of __x */
+            doubly_linked_list(doubly_linked_list&& __x) noexcept : doubly_linked_list() { __steal(__x); }
+
+            /** @brief copy assignment operator, reuses the existing nodes */
+            doubly_linked_list& operator=(const doubly_linked_list& __x) {
+                if (this != &__x) assign(__x.cbegin(), __x.cend());
+                return *this;
+            }
+
+            /** @brief move assignment operator */
+            doubly_linked_list& operator=(doubly_linked_list&& __x) noexcept {
+                if (this != &__x) {
+                    clear();
+                    __release_slabs();
+                    __steal(__x);
+                }
+                return *this;
+            }
+
+            /** @brief replace the contents with the elements of the initializer list */
+            doubly_linked_list& operator=(std::initializer_list<_Tp> __il) {
+                assign(__il.begin(), __il.end());
+                return *this;
+            }
         
             /** @brief default destructor */
             ~doubly_linked_list() {
                 erase(begin(), end());
+                __release_slabs();
             }
             
             /** @brief return the list size 
@@ -435,16 +536,16 @@ namespace dsa {
              *      an iterator to the beginning
             */
             _LIBCPP_NODISCARD_ATTRIBUTE
-            iterator begin() const noexcept { return iterator{__head_}; }
+            iterator begin() const noexcept { return iterator{__end_.__next_}; }
 
             /**
-             * @brief return an iterator to the end (nullptr)
+             * @brief return an iterator to the end (the sentinel node)
              * 
              * @return
              *      an iterator to the end
             */
             _LIBCPP_NODISCARD_ATTRIBUTE
-            iterator end() const noexcept { return __size_ == 0 ? begin() : iterator{nullptr}; }
+            iterator end() const noexcept { return iterator{__end_as_link()}; }
             
             /**
              * @brief
@@ -454,17 +555,17 @@ namespace dsa {
              *      a constant iterator to the beginning of the list
             */
             _LIBCPP_NODISCARD_ATTRIBUTE
-            const_iterator cbegin() const noexcept { return const_iterator{__head_}; }
+            const_iterator cbegin() const noexcept { return const_iterator{__end_.__next_}; }
 
             /**
              * @brief
-             *      return a constant iterator to the end of the list (nullptr)
+             *      return a constant iterator to the end of the list (the sentinel node)
              * 
              * @return
              *      a constant iterator to the end of the list
             */
             _LIBCPP_NODISCARD_ATTRIBUTE
-            const_iterator cend() const noexcept { return __size_ == 0 ? cbegin() : const_iterator{nullptr}; }
+            const_iterator cend() const noexcept { return const_iterator{__end_as_link()}; }
 
             /**
              * @brief
@@ -473,7 +574,10 @@ namespace dsa {
              * @return
              *      reference to the first element
             */
-            inline reference front() { return __head_->__value_; }
+            inline reference front() noexcept(_Policy::is_nothrow) {
+                _Policy::require(!empty(), "Empty list");
+                return static_cast<__node_pointer>(__end_.__next_)->__value_;
+            }
 
             /**
              * @brief
@@ -482,7 +586,10 @@ namespace dsa {
              * @return
              *      constant reference to the first element
             */
-            inline const_reference front() const { return __head_->__value_; }
+            inline const_reference front() const noexcept(_Policy::is_nothrow) {
+                _Policy::require(!empty(), "Empty list");
+                return static_cast<__node_pointer>(__end_.__next_)->__value_;
+            }
 
             /**
              * @brief
@@ -491,7 +598,10 @@ namespace dsa {
              * @return
              *      reference to the last element
             */
-            reference back() { return __tail_->__value_; }
+            reference back() noexcept(_Policy::is_nothrow) {
+                _Policy::require(!empty(), "Empty list");
+                return static_cast<__node_pointer>(__end_.__prev_)->__value_;
+            }
 
             /**
              * @brief
@@ -500,7 +610,10 @@ namespace dsa {
              * @return
              *      constant reference to the last element
             */
-            const_reference back() const {return __tail_->__value_;}
+            const_reference back() const noexcept(_Policy::is_nothrow) {
+                _Policy::require(!empty(), "Empty list");
+                return static_cast<__node_pointer>(__end_.__prev_)->__value_;
+            }
 
             void push_back(const _Tp& value);
             void push_back(_Tp&& value);
@@ -513,17 +626,96 @@ namespace dsa {
             template <class... _Args>
             void emplace_front(_Args&&... __args);
 
-            void pop_back(void);
-            void pop_front(void);
+            void pop_back(void) noexcept(_Policy::is_nothrow);
+            void pop_front(void) noexcept(_Policy::is_nothrow);
+
+            /**
+             * @brief
+             *      remove the last element and return it, whatever the error policy
+             *
+             * @return
+             *      the removed element, or std::nullopt if the list is empty
+            */
+            std::optional<_Tp> try_pop_back() noexcept(std::is_nothrow_move_constructible_v<_Tp>) {
+                if (empty()) return std::nullopt;
+                __node_pointer __n = static_cast<__node_pointer>(__end_.__prev_);
+                std::optional<_Tp> __v{std::move(__n->__value_)};
+                __erase_node(__n);
+                return __v;
+            }
+
+            /**
+             * @brief
+             *      remove the first element and return it, whatever the error policy
+             *
+             * @return
+             *      the removed element, or std::nullopt if the list is empty
+            */
+            std::optional<_Tp> try_pop_front() noexcept(std::is_nothrow_move_constructible_v<_Tp>) {
+                if (empty()) return std::nullopt;
+                __node_pointer __n = static_cast<__node_pointer>(__end_.__next_);
+                std::optional<_Tp> __v{std::move(__n->__value_)};
+                __erase_node(__n);
+                return __v;
+            }
 
-            iterator erase(iterator pos);
-            iterator erase(const_iterator pos);
+            iterator erase(iterator pos) noexcept(_Policy::is_nothrow);
+            iterator erase(const_iterator pos) noexcept(_Policy::is_nothrow);
             iterator erase(iterator first, iterator last);
 
+            /** @brief remove every element, O(1) in reclaim_mode::deferred */
+            void clear() noexcept { erase(begin(), end()); }
+
+            template <class _InputIt>
+                requires std::input_iterator<_InputIt>
+            iterator insert(const_iterator pos, _InputIt first, _InputIt last);
+
+            /** @brief insert the elements of the initializer list before pos */
+            iterator insert(const_iterator pos, std::initializer_list<_Tp> __il) { return insert(pos, __il.begin(), __il.end()); }
+
+            template <class _InputIt>
+                requires std::input_iterator<_InputIt>
+            void assign(_InputIt first, _InputIt last);
+
+            /** @brief replace the contents with the elements of the initializer list */
+            void assign(std::initializer_list<_Tp> __il) { assign(__il.begin(), __il.end()); }
+
+            void splice(const_iterator pos, doubly_linked_list& other);
+            void splice(const_iterator pos, doubly_linked_list& other, const_iterator it);
+
+            template <class _Fn>
+            void for_each_prefetch(_Fn&& __fn, size_type __distance = 4);
+
+            void defragment();
+
+            memory_footprint memory_usage() const noexcept;
+
+            /** @brief select how erase(first, last) and clear() release nodes, see reclaim_mode */
+            void set_reclaim_mode(reclaim_mode __mode) noexcept { __mode_ = __mode; }
+
+            /** @brief return the current reclaim_mode */
+            reclaim_mode get_reclaim_mode() const noexcept { return __mode_; }
+
+            /** @brief return the number of removed nodes waiting for reclaim_some() */
+            size_type retired_size() const noexcept { return __retired_size_; }
+
+            size_type reclaim_some(size_type __budget) noexcept;
+
         private:
+            using __base_pointer = __list_node_base<_Tp>*;                                          //!< pointer to the links of a node
+
             std::size_t __size_;
-            __list_node<_Tp> * __head_;
-            __list_node<_Tp> * __tail_;
+            __list_node_base<_Tp> __end_;                                                           //!< sentinel, __end_.__next_ is the first node and __end_.__prev_ the last
+            std::vector<std::pair<__node_pointer, size_type>> __slabs_;                             //!< contiguous node blocks owned by the list, see defragment()
+            __base_pointer __free_nodes_ = nullptr;                                                 //!< unused nodes inside __slabs_, linked through __next_
+            __base_pointer __retired_ = nullptr;                                                    //!< removed nodes whose values are still alive, linked through __next_
+            size_type __retired_size_ = 0;                                                          //!< length of __retired_
+            reclaim_mode __mode_ = reclaim_mode::immediate;
+
+            _LIBCPP_INLINE_VISIBILITY
+            __base_pointer __end_as_link() const noexcept {
+                return const_cast<__base_pointer>(std::addressof(__end_));
+            }
             // std::__compressed_pair<size_type, __node_allocator> __size_alloc; 
             
             // _LIBCPP_INLINE_VISIBILITY
@@ -538,9 +730,22 @@ namespace dsa {
             //     return __hold_pointer(__p, __node_destructor(__na, 1));
             // }
 
-            inline void __link_nodes_as_back(__node_pointer __f, __node_pointer __l);
-            inline void __link_nodes_as_front(__node_pointer __f, __node_pointer __l);
-            inline void __unlink_nodes(__node_pointer __f, __node_pointer __l);
+            inline __node_pointer __allocate_node();
+            inline void __deallocate_node(__node_pointer __p) noexcept;
+
+            template <class... _Args>
+            inline __node_pointer __create_node(_Args&&... __args);
+            inline void __destroy_node(__node_pointer __p) noexcept;
+            inline void __erase_node(__node_pointer __p) noexcept;
+            bool __in_slab(__node_pointer __p) const noexcept;
+            void __add_slab(__node_pointer __slab, size_type __n);
+            void __release_slabs() noexcept;
+            void __steal(doubly_linked_list& __x) noexcept;
+
+            inline void __link_nodes_as_back(__base_pointer __f, __base_pointer __l);
+            inline void __link_nodes_as_front(__base_pointer __f, __base_pointer __l);
+            static inline void __link_nodes(__base_pointer __p, __base_pointer __f, __base_pointer __l) noexcept;
+            static inline void __unlink_nodes(__base_pointer __f, __base_pointer __l) noexcept;
     };
 };      /* namespace dsa  */
 
@@ -563,28 +768,68 @@ namespace dsa {
 **
 ** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
 */
-template <class _Tp>
-inline void dsa::doubly_linked_list<_Tp>::__link_nodes_as_back(__node_pointer __f, __node_pointer __l) {
-    if (empty()) {
-        __head_ = __f; 
-    } else {
-        __f->__prev_ = __tail_;
-        __l->__next_ = __tail_->__next_;
-        __tail_->__next_ = __f;
-    }
-
-    __tail_ = __l; 
+template <class _Tp, class _Policy>
+inline void dsa::doubly_linked_list<_Tp, _Policy>::__link_nodes_as_back(__base_pointer __f, __base_pointer __l) {
+    __f->__prev_ = __end_.__prev_;
+    __f->__prev_->__next_ = __f;
+    __l->__next_ = __end_as_link();
+    __end_.__prev_ = __l;
     ++__size_;
 }
 
-template <class _Tp>
-inline void dsa::doubly_linked_list<_Tp>::__unlink_nodes(__node_pointer __f, __node_pointer __l) {
-    if (__f == __head_) {
-        __head_ = __l->__next_;
-    } else {
-        __f->__prev_->__next_ = __l->__next_;
-        __l->__next_->__prev_ = __f->__prev_;
-    }
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Unlink nodes [__f, __l] from the list. The nodes are neither destroyed nor counted.
+**
+** @param [in]
+**      __f: first node
+**
+** @param [in]
+**      __l: last node
+**
+** @return
+**       None
+** @note
+**       Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+inline void dsa::doubly_linked_list<_Tp, _Policy>::__unlink_nodes(__base_pointer __f, __base_pointer __l) noexcept {
+    __f->__prev_->__next_ = __l->__next_;
+    __l->__next_->__prev_ = __f->__prev_;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Link in nodes [__f, __l] before __p. The nodes are not counted.
+**
+** @param [in]
+**      __p: node to insert before, may be the sentinel
+**
+** @param [in]
+**      __f: first node
+**
+** @param [in]
+**      __l: last node
+**
+** @return
+**       None
+** @note
+**       Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+inline void dsa::doubly_linked_list<_Tp, _Policy>::__link_nodes(__base_pointer __p, __base_pointer __f, __base_pointer __l) noexcept {
+    __p->__prev_->__next_ = __f;
+    __f->__prev_ = __p->__prev_;
+    __p->__prev_ = __l;
+    __l->__next_ = __p;
 }
 
 /**
@@ -606,16 +851,12 @@ inline void dsa::doubly_linked_list<_Tp>::__unlink_nodes(__node_pointer __f, __n
 **
 ** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
 */
-template <class _Tp>
-inline void dsa::doubly_linked_list<_Tp>::__link_nodes_as_front(__node_pointer __f, __node_pointer __l) {
-    if (empty()) {
-        __tail_ = __l;
-    } else {
-        __head_->__prev_ = __l;
-        __l->__next_ = __head_;
-        __f->__prev_ = __head_->__prev_;
-    }
-    __head_ = __f;
+template <class _Tp, class _Policy>
+inline void dsa::doubly_linked_list<_Tp, _Policy>::__link_nodes_as_front(__base_pointer __f, __base_pointer __l) {
+    __l->__next_ = __end_.__next_;
+    __l->__next_->__prev_ = __l;
+    __f->__prev_ = __end_as_link();
+    __end_.__next_ = __f;
     ++__size_;
 }
 
@@ -635,15 +876,9 @@ inline void dsa::doubly_linked_list<_Tp>::__link_nodes_as_front(__node_pointer _
 **
 ** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
 */
-template <class _Tp>
-void dsa::doubly_linked_list<_Tp>::push_back(_Tp&& __x) {
-    typename _Alloc::allocator_type __na;
-    typename _Alloc::pointer hold = _Alloc::allocate(__na, 1);
-    memset(hold, 0x00, sizeof(typename _Alloc::value_type));
-    
-    typename std::allocator_traits<std::allocator<_Tp>>::allocator_type __nodeAlloc;
-    std::allocator_traits<std::allocator<_Tp>>::construct(__nodeAlloc, std::addressof(hold->__value_), std::move(__x));
-
+template <class _Tp, class _Policy>
+void dsa::doubly_linked_list<_Tp, _Policy>::push_back(_Tp&& __x) {
+    __node_pointer hold = __create_node(std::move(__x));
     __link_nodes_as_back(hold, hold);
 }
 
@@ -663,15 +898,9 @@ void dsa::doubly_linked_list<_Tp>::push_back(_Tp&& __x) {
 **
 ** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
 */
-template <class _Tp>
-void dsa::doubly_linked_list<_Tp>::push_back(const _Tp& __x) {
-    typename _Alloc::allocator_type __na;
-    typename _Alloc::pointer hold = _Alloc::allocate(__na, 1);
-    memset(hold, 0x00, sizeof(typename _Alloc::value_type));
-    
-    typename std::allocator_traits<std::allocator<_Tp>>::allocator_type __nodeAlloc;
-    std::allocator_traits<std::allocator<_Tp>>::construct(__nodeAlloc, std::addressof(hold->__value_), __x);
-
+template <class _Tp, class _Policy>
+void dsa::doubly_linked_list<_Tp, _Policy>::push_back(const _Tp& __x) {
+    __node_pointer hold = __create_node(__x);
     __link_nodes_as_back(hold, hold);
 }
 
@@ -691,15 +920,9 @@ void dsa::doubly_linked_list<_Tp>::push_back(const _Tp& __x) {
 **
 ** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
 */
-template <class _Tp>
-void dsa::doubly_linked_list<_Tp>::push_front(_Tp&& __x) {
-    typename _Alloc::allocator_type __na;
-    typename _Alloc::pointer hold = _Alloc::allocate(__na, 1);
-    memset(hold, 0x00, sizeof(typename _Alloc::value_type));
-    
-    typename std::allocator_traits<std::allocator<_Tp>>::allocator_type __nodeAlloc;
-    std::allocator_traits<std::allocator<_Tp>>::construct(__nodeAlloc, std::addressof(hold->__value_), std::move(__x));
-
+template <class _Tp, class _Policy>
+void dsa::doubly_linked_list<_Tp, _Policy>::push_front(_Tp&& __x) {
+    __node_pointer hold = __create_node(std::move(__x));
     __link_nodes_as_front(hold, hold);
 }
 
@@ -719,15 +942,9 @@ void dsa::doubly_linked_list<_Tp>::push_front(_Tp&& __x) {
 **
 ** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
 */
-template <class _Tp>
-void dsa::doubly_linked_list<_Tp>::push_front(const _Tp& __x) {
-    typename _Alloc::allocator_type __na;
-    typename _Alloc::pointer hold = _Alloc::allocate(__na, 1);
-    memset(hold, 0x00, sizeof(typename _Alloc::value_type));
-    
-    typename std::allocator_traits<std::allocator<_Tp>>::allocator_type __nodeAlloc;
-    std::allocator_traits<std::allocator<_Tp>>::construct(__nodeAlloc, std::addressof(hold->__value_), __x);
-
+template <class _Tp, class _Policy>
+void dsa::doubly_linked_list<_Tp, _Policy>::push_front(const _Tp& __x) {
+    __node_pointer hold = __create_node(__x);
     __link_nodes_as_front(hold, hold);
 }
 
@@ -747,16 +964,10 @@ void dsa::doubly_linked_list<_Tp>::push_front(const _Tp& __x) {
 **
 ** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
 */
-template<class _Tp>
+template <class _Tp, class _Policy>
 template<class... _Args>
-void dsa::doubly_linked_list<_Tp>::emplace_back(_Args&&... args) {
-    typename _Alloc::allocator_type __na;
-    typename _Alloc::pointer hold = _Alloc::allocate(__na, 1);
-    memset(hold, 0x00, sizeof(typename _Alloc::value_type));
-    
-    typename std::allocator_traits<std::allocator<_Tp>>::allocator_type __nodeAlloc;
-    std::allocator_traits<std::allocator<_Tp>>::construct(__nodeAlloc, std::addressof(hold->__value_), std::forward<_Args>(args)...);
-
+void dsa::doubly_linked_list<_Tp, _Policy>::emplace_back(_Args&&... args) {
+    __node_pointer hold = __create_node(std::forward<_Args>(args)...);
     __link_nodes_as_back(hold, hold);
 }
 
@@ -776,16 +987,10 @@ void dsa::doubly_linked_list<_Tp>::emplace_back(_Args&&... args) {
 **
 ** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
 */
-template<class _Tp>
+template <class _Tp, class _Policy>
 template<class... _Args>
-void dsa::doubly_linked_list<_Tp>::emplace_front(_Args&&... args) {
-    typename _Alloc::allocator_type __na;
-    typename _Alloc::pointer hold = _Alloc::allocate(__na, 1);
-    memset(hold, 0x00, sizeof(typename _Alloc::value_type));
-    
-    typename std::allocator_traits<std::allocator<_Tp>>::allocator_type __nodeAlloc;
-    std::allocator_traits<std::allocator<_Tp>>::construct(__nodeAlloc, std::addressof(hold->__value_), std::forward<_Args>(args)...);
-
+void dsa::doubly_linked_list<_Tp, _Policy>::emplace_front(_Args&&... args) {
+    __node_pointer hold = __create_node(std::forward<_Args>(args)...);
     __link_nodes_as_front(hold, hold);
 }
 
@@ -801,30 +1006,14 @@ void dsa::doubly_linked_list<_Tp>::emplace_front(_Args&&... args) {
 ** @note
 **       Complexity: O(1).
 **       References and iterators to the erased elements are invalidated.
-**       Throw runtime_error exception when the list is empty. 
+**       On an empty list: throw runtime_error with checked_policy, see _Policy.
 **
 ** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
 */
-template <class _Tp>
-void dsa::doubly_linked_list<_Tp>::pop_back() {
-    if (empty()) throw std::runtime_error("Empty list");
-    
-    __tail_ = __tail_->__prev_;
-    --__size_;
-
-    /* Release memory */
-    typename _Alloc::pointer hold;
-    if (empty()) {
-        hold = __head_;
-        __head_ = nullptr;
-    } else {
-        hold = __tail_->__next_; 
-    }
-    typename std::allocator_traits<std::allocator<_Tp>>::allocator_type __nodeAlloc;
-    std::allocator_traits<std::allocator<_Tp>>::destroy(__nodeAlloc, std::addressof(hold->__value_)); 
-
-    typename _Alloc::allocator_type __na;
-    _Alloc::deallocate(__na, hold, 1);
+template <class _Tp, class _Policy>
+void dsa::doubly_linked_list<_Tp, _Policy>::pop_back() noexcept(_Policy::is_nothrow) {
+    _Policy::require(!empty(), "Empty list");
+    __erase_node(static_cast<__node_pointer>(__end_.__prev_));
 }
 
 /**
@@ -838,31 +1027,40 @@ void dsa::doubly_linked_list<_Tp>::pop_back() {
 ** @note
 **       Complexity: O(1).
 **       References and iterators to the erased elements are invalidated.
-**       Throw runtime_error exception when the list is empty. 
+**       On an empty list: throw runtime_error with checked_policy, see _Policy.
 **
 ** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
 */
-template <class _Tp>
-void dsa::doubly_linked_list<_Tp>::pop_front() {
-    if (empty()) throw std::runtime_error("Empty list");
-
-    __head_ = __head_->__next_;
-    --__size_;
-
-    /* Release memory */
-    typename _Alloc::pointer hold;
-    if (empty()) {
-        hold = __tail_;
-        __tail_ = nullptr;
-    }else {
-        hold = __head_->__prev_;
-    }
+template <class _Tp, class _Policy>
+void dsa::doubly_linked_list<_Tp, _Policy>::pop_front() noexcept(_Policy::is_nothrow) {
+    _Policy::require(!empty(), "Empty list");
+    __erase_node(static_cast<__node_pointer>(__end_.__next_));
+}
 
-    typename std::allocator_traits<std::allocator<_Tp>>::allocator_type __nodeAlloc;
-    std::allocator_traits<std::allocator<_Tp>>::destroy(__nodeAlloc, std::addressof(hold->__value_));
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Remove the element at pos. The iterator pos must be valid and dereferenceable.
+**
+** @param [in]
+**      pos: iterator to the removed element
+**
+** @return
+**       iterator to the next of the removed element. If pos refers to the last element, then the end() iterator is returned.
+**
+** @note
+**       Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+typename dsa::doubly_linked_list<_Tp, _Policy>::iterator dsa::doubly_linked_list<_Tp, _Policy>::erase(iterator pos) noexcept(_Policy::is_nothrow) {
+    _Policy::require(pos != end(), "Non-dereferenceable iterator");
 
-    typename _Alloc::allocator_type __na;
-    _Alloc::deallocate(__na, hold, 1);
+    __base_pointer __r = pos.__ptr_->__next_;
+    __erase_node(static_cast<__node_pointer>(pos.__ptr_));
+    return iterator(__r);
 }
 
 /**
@@ -882,31 +1080,65 @@ void dsa::doubly_linked_list<_Tp>::pop_front() {
 **
 ** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
 */
-template <class _Tp>
-typename dsa::doubly_linked_list<_Tp>::iterator dsa::doubly_linked_list<_Tp>::erase(iterator pos) {
-    if (pos == end()) throw std::runtime_error("Non-dereferenceable iterator");
+template <class _Tp, class _Policy>
+typename dsa::doubly_linked_list<_Tp, _Policy>::iterator dsa::doubly_linked_list<_Tp, _Policy>::erase(const_iterator pos) noexcept(_Policy::is_nothrow) {
+    _Policy::require(pos != cend(), "Non-dereferenceable iterator");
 
-    if (pos == begin()) {
-        pop_front();
-        return begin();
-    }
+    __base_pointer __r = pos.__ptr_->__next_;
+    __erase_node(static_cast<__node_pointer>(pos.__ptr_));
+    return iterator(__r);
+}
 
-    if (pos == iterator(__tail_)) {
-        pop_back();
-        return end();
-    }
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Remove the element in the range [first, last). If first == last, do nothing.
+**
+** @param [in]
+**      first, last: range of elements to remove
+**
+** @return
+**       iterator to the last element
+**
+** @note
+**       Complexity: linear in the distance between first and last, O(n).
+**       In reclaim_mode::deferred the range is detached to the retired chain instead: O(1)
+**       for the whole list, otherwise a single counting pass with no destructor or
+**       deallocation. size() and iteration reflect the removal right away.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+typename dsa::doubly_linked_list<_Tp, _Policy>::iterator dsa::doubly_linked_list<_Tp, _Policy>::erase(iterator first, iterator last) {
+    if (first == last) return last;
 
-    __node_pointer __n = pos.__ptr_;
-    __node_pointer __r = __n->__next_;
+    __base_pointer __f = first.__ptr_;
+    __base_pointer __r = last.__ptr_;
+    __base_pointer __l = __r->__prev_;
 
-    /* Release memory referred by pos */
-    __unlink_nodes(__n, __n);
-    --__size_;
+    __unlink_nodes(__f, __l);
 
-    typename _Alloc::allocator_type __na;
-    typename std::allocator_traits<std::allocator<_Tp>>::allocator_type __nodeAlloc;
-    std::allocator_traits<std::allocator<_Tp>>::destroy(__nodeAlloc, std::addressof(__n->__value_));
-    _Alloc::deallocate(__na, __n, 1);
+    if (__mode_ == reclaim_mode::deferred) {
+        size_type __n = __size_;
+        if (__f->__prev_ != __end_as_link() || __r != __end_as_link()) {
+            __n = 1;
+            for (__base_pointer __p = __f; __p != __l; __p = __p->__next_) ++__n;
+        }
+        __l->__next_ = __retired_;
+        __retired_ = __f;
+        __retired_size_ += __n;
+        __size_ -= __n;
+        return iterator(__r);
+    }
+
+    /* O(n) where n is the n. No destructor runs for a trivially destructible _Tp. */
+    while (__f != __r) {
+        __node_pointer ptr = static_cast<__node_pointer>(__f);
+        __f = __f->__next_;
+        __destroy_node(ptr);
+        --__size_;
+    }
 
     return iterator(__r);
 }
@@ -915,93 +1147,569 @@ typename dsa::doubly_linked_list<_Tp>::iterator dsa::doubly_linked_list<_Tp>::er
 ** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
 **
 ** @brief
-**      Remove the element at pos. The iterator pos must be valid and dereferenceable.
+**      Insert the elements of the range [first, last) before pos
 **
 ** @param [in]
-**      pos: iterator to the removed element
+**      pos: element before which the content is inserted
+**
+** @param [in]
+**      first, last: range of elements to insert, must not point into *this
 **
 ** @return
-**       iterator to the next of the removed element. If pos refers to the last element, then the end() iterator is returned.
+**       iterator to the first inserted element, or pos if the range is empty
 **
 ** @note
-**       Complexity: O(1)
+**       The new nodes are built into a detached chain and linked in with one splice, so the
+**       list is left untouched if a constructor throws.
+**       For forward iterators the count is known up front: idle slab nodes are reused first
+**       and the remaining nodes come from one new slab (one allocation), so repeated
+**       insert/clear cycles hold no more slab nodes than the largest size reached.
+**       The size is updated once. Complexity: O(distance(first, last)).
 **
 ** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
 */
-template <class _Tp>
-typename dsa::doubly_linked_list<_Tp>::iterator dsa::doubly_linked_list<_Tp>::erase(const_iterator pos) {
-    if (pos == cend()) throw std::runtime_error("Non-dereferenceable iterator");
+template <class _Tp, class _Policy>
+template <class _InputIt>
+    requires std::input_iterator<_InputIt>
+typename dsa::doubly_linked_list<_Tp, _Policy>::iterator
+dsa::doubly_linked_list<_Tp, _Policy>::insert(const_iterator pos, _InputIt first, _InputIt last) {
+    __list_node_base<_Tp> __chain;                   /* sentinel of the detached chain */
+    __base_pointer __tail = &__chain;
+    size_type __n = 0;
+
+    if constexpr (std::forward_iterator<_InputIt>) {
+        const size_type __count = static_cast<size_type>(std::distance(first, last));
+        if (__count == 0) return iterator{pos.__ptr_};
+
+        /* Idle slab nodes are used up by the loop below before a new slab is allocated */
+        size_type __idle = 0;
+        for (__base_pointer __p = __free_nodes_; __p != nullptr && __idle < __count; __p = __p->__next_) ++__idle;
+        const size_type __fresh = __count - __idle;
+        if (__fresh > 1) {
+            __slabs_.reserve(__slabs_.size() + 1);
+            typename _Alloc::allocator_type __na;
+            __node_pointer __slab = _Alloc::allocate(__na, __fresh);
+            try {
+                for (; __n < __fresh; ++__n, ++first)
+                    ::new (static_cast<void*>(std::addressof(__slab[__n].__value_))) _Tp(*first);
+            } catch (...) {
+                if constexpr (!std::is_trivially_destructible_v<_Tp>)
+                    while (__n != 0) std::destroy_at(std::addressof(__slab[--__n].__value_));
+                _Alloc::deallocate(__na, __slab, __fresh);
+                throw;
+            }
+            for (size_type __i = 0; __i < __fresh; ++__i) {
+                __slab[__i].__prev_ = __tail;
+                __tail->__next_ = __slab + __i;
+                __tail = __slab + __i;
+            }
+            __add_slab(__slab, __fresh);             /* cannot throw after the reserve above */
+        }
+    }
 
-    if (pos == cbegin()) {
-        pop_front();
-        return begin();
+    try {
+        for (; first != last; ++first, ++__n) {
+            __node_pointer __p = __create_node(*first);
+            __p->__prev_ = __tail;
+            __tail->__next_ = __p;
+            __tail = __p;
+        }
+    } catch (...) {
+        for (__base_pointer __p = __tail; __p != &__chain;) {
+            __base_pointer __prev = __p->__prev_;
+            __destroy_node(static_cast<__node_pointer>(__p));
+            __p = __prev;
+        }
+        throw;
     }
+    if (__n == 0) return iterator{pos.__ptr_};
+
+    __base_pointer __f = __chain.__next_;
+    __link_nodes(pos.__ptr_, __f, __tail);
+    __size_ += __n;
+    return iterator{__f};
+}
 
-    if (pos == const_iterator(__tail_)) {
-        pop_back();
-        return end();
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Replace the contents with the elements of the range [first, last)
+**
+** @param [in]
+**      first, last: range of elements to copy, must not point into *this
+**
+** @return
+**       None
+**
+** @note
+**       Existing elements are assigned in place; the surplus is erased and the rest is
+**       appended with one insert(). Complexity: O(size() + distance(first, last)).
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+template <class _InputIt>
+    requires std::input_iterator<_InputIt>
+void dsa::doubly_linked_list<_Tp, _Policy>::assign(_InputIt first, _InputIt last) {
+    iterator __i = begin();
+    const iterator __e = end();
+    for (; first != last && __i != __e; ++first, ++__i) *__i = *first;
+    if (__i == __e)
+        insert(cend(), first, last);
+    else
+        erase(__i, __e);
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Move all elements of other before pos. No element is copied or moved and other becomes empty.
+**
+** @param [in]
+**      pos: element before which the content is inserted
+**
+** @param [in]
+**      other: another list to transfer the content from
+**
+** @return
+**       None
+**
+** @note
+**       Complexity: O(1), plus the number of slabs of other if it was defragmented; those
+**       slabs change owner together with the nodes.
+**       Iterators and references to the transferred elements stay valid and now refer into *this.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+void dsa::doubly_linked_list<_Tp, _Policy>::splice(const_iterator pos, doubly_linked_list& other) {
+    if (other.empty() || &other == this) return;
+
+    if (!other.__slabs_.empty()) {
+        other.reclaim_some(other.__retired_size_);
+        __slabs_.reserve(__slabs_.size() + other.__slabs_.size());
+        for (const auto& __slab : other.__slabs_) __add_slab(__slab.first, __slab.second);
+        other.__slabs_.clear();
+        while (other.__free_nodes_ != nullptr) {
+            __base_pointer __p = other.__free_nodes_;
+            other.__free_nodes_ = __p->__next_;
+            __p->__next_ = __free_nodes_;
+            __free_nodes_ = __p;
+        }
     }
 
-    __node_pointer __n = pos.__ptr_;
-    __node_pointer __r = __n->__next_;
+    __base_pointer __f = other.__end_.__next_;
+    __base_pointer __l = other.__end_.__prev_;
+    __unlink_nodes(__f, __l);
+    __link_nodes(pos.__ptr_, __f, __l);
+    __size_ += other.__size_;
+    other.__size_ = 0;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Move the element pointed to by it from other before pos. other may be *this.
+**
+** @param [in]
+**      pos: element before which the element is inserted
+**
+** @param [in]
+**      other: list that owns it
+**
+** @param [in]
+**      it: dereferenceable iterator into other
+**
+** @return
+**       None
+**
+** @note
+**       Complexity: O(1). The node is relinked, so iterators and references to the element stay
+**       valid. The one exception is a node that lives in a slab of another defragmented list:
+**       its value is moved into a fresh node instead and the old iterator is invalidated.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+void dsa::doubly_linked_list<_Tp, _Policy>::splice(const_iterator pos, doubly_linked_list& other, const_iterator it) {
+    __base_pointer __n = it.__ptr_;
+    if (__n == pos.__ptr_ || __n->__next_ == pos.__ptr_) return;
+
+    if (&other != this && !other.__slabs_.empty() && other.__in_slab(static_cast<__node_pointer>(__n))) {
+        __node_pointer __hold = __create_node(std::move(static_cast<__node_pointer>(__n)->__value_));
+        __link_nodes(pos.__ptr_, __hold, __hold);
+        ++__size_;
+        other.erase(it);
+        return;
+    }
 
-    /* Release memory referred by pos */
     __unlink_nodes(__n, __n);
-    --__size_;
+    __link_nodes(pos.__ptr_, __n, __n);
+    --other.__size_;
+    ++__size_;
+}
 
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Get storage for one node, from the slab free list first, then from the retired chain,
+**      then from the allocator
+**
+** @return
+**       uninitialized node
+**
+** @note
+**       Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+inline typename dsa::doubly_linked_list<_Tp, _Policy>::__node_pointer dsa::doubly_linked_list<_Tp, _Policy>::__allocate_node() {
+    if (__free_nodes_ != nullptr) {
+        __node_pointer __p = static_cast<__node_pointer>(__free_nodes_);
+        __free_nodes_ = __free_nodes_->__next_;
+        return __p;
+    }
+    if (__retired_ != nullptr) {
+        /* Recycling a retired node pays for its destructor instead of an allocation */
+        __node_pointer __p = static_cast<__node_pointer>(__retired_);
+        __retired_ = __retired_->__next_;
+        --__retired_size_;
+        if constexpr (!std::is_trivially_destructible_v<_Tp>) std::destroy_at(std::addressof(__p->__value_));
+        return __p;
+    }
     typename _Alloc::allocator_type __na;
-    typename std::allocator_traits<std::allocator<_Tp>>::allocator_type __nodeAlloc;
-    std::allocator_traits<std::allocator<_Tp>>::destroy(__nodeAlloc, std::addressof(__n->__value_));
-    _Alloc::deallocate(__na, __n, 1);
+    return _Alloc::allocate(__na, 1);
+}
 
-    return iterator(__r);
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Give back the storage of a node whose value is already destroyed. Nodes that live in
+**      a slab go to the free list, the others go back to the allocator.
+**
+** @note
+**       Complexity: O(number of slabs), O(1) for a list that was never defragmented
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+inline void dsa::doubly_linked_list<_Tp, _Policy>::__deallocate_node(__node_pointer __p) noexcept {
+    if (!__slabs_.empty() && __in_slab(__p)) {
+        __p->__next_ = __free_nodes_;
+        __free_nodes_ = __p;
+        return;
+    }
+    typename _Alloc::allocator_type __na;
+    _Alloc::deallocate(__na, __p, 1);
 }
 
 /**
 ** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
 **
 ** @brief
-**      Remove the element in the range [first, last). If first == last, do nothing.
+**      Destroy and deallocate up to __budget retired nodes
 **
 ** @param [in]
-**      first, last: range of elements to remove
+**      __budget: maximum number of nodes to release
 **
 ** @return
-**       iterator to the last element
+**       number of nodes released
 **
 ** @note
-**       Complexity: linear in the distance between first and last, O(n).
+**       Complexity: O(__budget). Call it from an idle point of the owning thread to spread
+**       the cost of a large deferred erase or clear over several slices.
 **
 ** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
 */
-template <class _Tp>
-typename dsa::doubly_linked_list<_Tp>::iterator dsa::doubly_linked_list<_Tp>::erase(iterator first, iterator last) {
-    if (first == last) return last;
+template <class _Tp, class _Policy>
+typename dsa::doubly_linked_list<_Tp, _Policy>::size_type dsa::doubly_linked_list<_Tp, _Policy>::reclaim_some(size_type __budget) noexcept {
+    size_type __n = 0;
+    for (; __n < __budget && __retired_ != nullptr; ++__n) {
+        __node_pointer __p = static_cast<__node_pointer>(__retired_);
+        __retired_ = __retired_->__next_;
+        __destroy_node(__p);
+    }
+    __retired_size_ -= __n;
+    return __n;
+}
 
-    __node_pointer __f = first.__ptr_;
-    __node_pointer __l, __r;
-    if (last == end()) {
-        __l = __tail_;
-        __r = end().__ptr_;
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Get a node and construct its value from __args. The links are left for the caller to set.
+**
+** @param [in]
+**      __args: the arguments forwarded to the constructor of the value
+**
+** @return
+**       the new node
+**
+** @note
+**       Complexity: O(1). The node is given back if the constructor throws.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+template <class... _Args>
+inline typename dsa::doubly_linked_list<_Tp, _Policy>::__node_pointer dsa::doubly_linked_list<_Tp, _Policy>::__create_node(_Args&&... __args) {
+    __node_pointer __p = __allocate_node();
+    if constexpr (std::is_nothrow_constructible_v<_Tp, _Args&&...>) {
+        ::new (static_cast<void*>(std::addressof(__p->__value_))) _Tp(std::forward<_Args>(__args)...);
     } else {
-        __l = last.__ptr_->__prev_;
-        __r = last.__ptr_;
+        try {
+            ::new (static_cast<void*>(std::addressof(__p->__value_))) _Tp(std::forward<_Args>(__args)...);
+        } catch (...) {
+            __deallocate_node(__p);
+            throw;
+        }
     }
+    return __p;
+}
 
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Destroy the value of an unlinked node and give back its storage
+**
+** @note
+**       Complexity: O(1). No destructor call is emitted for a trivially destructible _Tp.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+inline void dsa::doubly_linked_list<_Tp, _Policy>::__destroy_node(__node_pointer __p) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<_Tp>) std::destroy_at(std::addressof(__p->__value_));
+    __deallocate_node(__p);
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Unlink, uncount and destroy one node of the list, the common tail of pop and erase
+**
+** @note
+**       Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+inline void dsa::doubly_linked_list<_Tp, _Policy>::__erase_node(__node_pointer __p) noexcept {
+    __unlink_nodes(__p, __p);
+    --__size_;
+    __destroy_node(__p);
+}
+
+/* __slabs_ is sorted by address, see __add_slab() */
+template <class _Tp, class _Policy>
+bool dsa::doubly_linked_list<_Tp, _Policy>::__in_slab(__node_pointer __p) const noexcept {
+    std::less<const __list_node<_Tp>*> __less;
+    auto __it = std::upper_bound(__slabs_.begin(), __slabs_.end(), __p,
+                                 [&__less](__node_pointer __x, const auto& __slab) { return __less(__x, __slab.first); });
+    if (__it == __slabs_.begin()) return false;
+    --__it;
+    return __less(__p, __it->first + __it->second);
+}
+
+/* Strong guarantee: the slab is not recorded if the index cannot grow */
+template <class _Tp, class _Policy>
+void dsa::doubly_linked_list<_Tp, _Policy>::__add_slab(__node_pointer __slab, size_type __n) {
+    std::less<const __list_node<_Tp>*> __less;
+    auto __it = std::upper_bound(__slabs_.begin(), __slabs_.end(), __slab,
+                                 [&__less](__node_pointer __x, const auto& __s) { return __less(__x, __s.first); });
+    __slabs_.emplace(__it, __slab, __n);
+}
+
+/* Take over the nodes, slabs, free and retired nodes of __x. *this must be empty and own no slab. */
+template <class _Tp, class _Policy>
+void dsa::doubly_linked_list<_Tp, _Policy>::__steal(doubly_linked_list& __x) noexcept {
+    __slabs_ = std::move(__x.__slabs_);
+    __x.__slabs_.clear();
+    __free_nodes_ = __x.__free_nodes_;
+    __x.__free_nodes_ = nullptr;
+    __retired_ = __x.__retired_;
+    __retired_size_ = __x.__retired_size_;
+    __x.__retired_ = nullptr;
+    __x.__retired_size_ = 0;
+    if (__x.__size_ == 0) return;
+
+    __base_pointer __f = __x.__end_.__next_;
+    __base_pointer __l = __x.__end_.__prev_;
     __unlink_nodes(__f, __l);
-    
+    __link_nodes(__end_as_link(), __f, __l);
+    __size_ = __x.__size_;
+    __x.__size_ = 0;
+}
+
+template <class _Tp, class _Policy>
+void dsa::doubly_linked_list<_Tp, _Policy>::__release_slabs() noexcept {
+    /* Retired nodes may live in the slabs */
+    reclaim_some(__retired_size_);
     typename _Alloc::allocator_type __na;
-    typename std::allocator_traits<std::allocator<_Tp>>::allocator_type __nodeAlloc;
+    for (const auto& __slab : __slabs_) _Alloc::deallocate(__na, __slab.first, __slab.second);
+    __slabs_.clear();
+    __free_nodes_ = nullptr;
+}
 
-    /* O(n) where n is the n */
-    for (__node_pointer ptr = __f; ptr != __l->__next_; ptr = __f) {
-        __f = __f->__next_;
-        std::allocator_traits<std::allocator<_Tp>>::destroy(__nodeAlloc, std::addressof(ptr->__value_));
-        _Alloc::deallocate(__na, ptr, 1);
-        --__size_;
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Call __fn on every element in order while prefetching the node __distance hops ahead
+**
+** @param [in]
+**      __fn: callable invoked as __fn(reference)
+**
+** @param [in]
+**      __distance: number of nodes between the visited node and the prefetched one
+**
+** @return
+**       None
+**
+** @note
+**       The prefetch of a node overlaps with the work done on the __distance nodes before
+**       it, which hides most of the cache misses of a scattered list. __fn must not
+**       insert or erase elements.
+**       Complexity: O(n)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+template <class _Fn>
+void dsa::doubly_linked_list<_Tp, _Policy>::for_each_prefetch(_Fn&& __fn, size_type __distance) {
+    const __base_pointer __e = __end_as_link();
+    __base_pointer __ahead = __end_.__next_;
+    for (size_type __i = 0; __i < __distance && __ahead != __e; ++__i) {
+        _DSA_PREFETCH(__ahead);
+        __ahead = __ahead->__next_;
     }
 
-    return iterator(__r);
+    for (__base_pointer __p = __end_.__next_; __p != __e; __p = __p->__next_) {
+        if (__ahead != __e) {
+            _DSA_PREFETCH(__ahead->__next_);
+            __ahead = __ahead->__next_;
+        }
+        __fn(static_cast<__node_pointer>(__p)->__value_);
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Move every element into one contiguous block of nodes laid out in list order, so that
+**      a traversal walks memory sequentially again
+**
+** @return
+**       None
+**
+** @note
+**       Complexity: O(n). Invalidates all iterators and references.
+**       Values are moved when their move constructor is noexcept and copied otherwise, so
+**       the list is left untouched if an exception is thrown. Values of a trivially
+**       relocatable _Tp (see is_trivially_relocatable) are memcpy'd instead.
+**       Erased nodes of the block are recycled by later insertions; the block itself is
+**       released by the next defragment() or by the destructor. Retired nodes are
+**       reclaimed first.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+void dsa::doubly_linked_list<_Tp, _Policy>::defragment() {
+    reclaim_some(__retired_size_);
+    if (__size_ == 0) {
+        __release_slabs();
+        return;
+    }
+
+    __slabs_.reserve(__slabs_.size() + 1);
+    typename _Alloc::allocator_type __na;
+    __node_pointer __slab = _Alloc::allocate(__na, __size_);
+
+    size_type __n = 0;
+    if constexpr (is_trivially_relocatable_v<_Tp>) {
+        /* Relocation cannot fail: copy the bytes and forget the old values */
+        for (__base_pointer __p = __end_.__next_; __p != __end_as_link(); __p = __p->__next_, ++__n)
+            std::memcpy(static_cast<void*>(std::addressof(__slab[__n].__value_)),
+                        static_cast<const void*>(std::addressof(static_cast<__node_pointer>(__p)->__value_)), sizeof(_Tp));
+    } else {
+        try {
+            for (__base_pointer __p = __end_.__next_; __p != __end_as_link(); __p = __p->__next_, ++__n)
+                ::new (static_cast<void*>(std::addressof(__slab[__n].__value_)))
+                    _Tp(std::move_if_noexcept(static_cast<__node_pointer>(__p)->__value_));
+        } catch (...) {
+            while (__n != 0) std::destroy_at(std::addressof(__slab[--__n].__value_));
+            _Alloc::deallocate(__na, __slab, __size_);
+            throw;
+        }
+    }
+
+    /* Nodes from older slabs are released with their slab below */
+    for (__base_pointer __p = __end_.__next_, __next; __p != __end_as_link(); __p = __next) {
+        __next = __p->__next_;
+        __node_pointer __old = static_cast<__node_pointer>(__p);
+        if constexpr (!is_trivially_relocatable_v<_Tp>) std::destroy_at(std::addressof(__old->__value_));
+        if (__slabs_.empty() || !__in_slab(__old)) _Alloc::deallocate(__na, __old, 1);
+    }
+    __release_slabs();
+
+    __base_pointer __prev = __end_as_link();
+    for (size_type __i = 0; __i < __size_; ++__i) {
+        __slab[__i].__prev_ = __prev;
+        __prev->__next_ = __slab + __i;
+        __prev = __slab + __i;
+    }
+    __prev->__next_ = __end_as_link();
+    __end_.__prev_ = __prev;
+    __add_slab(__slab, __size_);
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Report the memory held by the list
+**
+** @return
+**       payload, link overhead (including idle slab nodes and retired nodes) and estimated allocator slack
+**
+** @note
+**       Complexity: O(number of slabs + idle slab nodes), O(1) for a list that was never defragmented
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+dsa::memory_footprint dsa::doubly_linked_list<_Tp, _Policy>::memory_usage() const noexcept {
+    constexpr std::size_t __node_bytes = sizeof(__list_node<_Tp>);
+    memory_footprint __m;
+    __m.payload_bytes = __size_ * sizeof(_Tp);
+    __m.overhead_bytes = sizeof(*this) + __size_ * (__node_bytes - sizeof(_Tp));
+
+    size_type __slab_nodes = 0;
+    for (const auto& __slab : __slabs_) {
+        __slab_nodes += __slab.second;
+        __m.slack_bytes += allocation_slack(__slab.second * __node_bytes);
+        ++__m.allocations;
+    }
+    size_type __idle = 0;
+    for (__base_pointer __p = __free_nodes_; __p != nullptr; __p = __p->__next_) ++__idle;
+    __m.overhead_bytes += (__idle + __retired_size_) * __node_bytes;
+
+    /* Every node outside the slabs is an allocation of its own */
+    const size_type __single = __size_ + __retired_size_ - (__slab_nodes - __idle);
+    __m.slack_bytes += __single * allocation_slack(__node_bytes);
+    __m.allocations += __single;
+
+    memory_footprint __index = __heap_block(__slabs_.capacity() * sizeof(typename decltype(__slabs_)::value_type));
+    return __m += __index;
 }
 
-#endif /* D_LINKLIST_H */
\ No newline at end of file
+#endif /* D_LINKLIST_H */
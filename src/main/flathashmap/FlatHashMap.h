@@ -0,0 +1,775 @@
+/**
+ * @file    FlatHashMap.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   An open-addressing hash map probed 16 control bytes at a time (Swiss table layout).
+*/
+
+#ifndef FLAT_HASH_MAP_H
+#define FLAT_HASH_MAP_H
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "MemoryUsage.h"
+#include "TypeTraits.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DSA_FLAT_HASH_MAP_SSE2 1
+#endif
+
+namespace dsa {
+    /** @brief Control byte of a slot: full slots hold the 7 low bits of the hash (H2) */
+    using __ctrl_t = std::int8_t;
+
+    inline constexpr __ctrl_t __ctrl_empty = -128;     //!< 0b10000000, never used since the last rehash
+    inline constexpr __ctrl_t __ctrl_deleted = -2;     //!< 0b11111110, tombstone
+    inline constexpr std::size_t __group_width = 16;   //!< slots matched per probe step
+
+    /**
+     * @brief A group of 16 control bytes. Each match returns a bitmask with bit i set
+     *      when slot i of the group satisfies the predicate.
+     *
+     * @note
+     *      SSE2 compares the whole group with one instruction; without SSE2 a scalar
+     *      loop builds the same mask.
+    */
+    struct __ctrl_group {
+#if defined(DSA_FLAT_HASH_MAP_SSE2)
+        __m128i __ctrl_;
+
+        explicit __ctrl_group(const __ctrl_t* __p) noexcept
+            : __ctrl_{_mm_loadu_si128(reinterpret_cast<const __m128i*>(__p))} {}
+
+        std::uint32_t match(__ctrl_t __h2) const noexcept {
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(__h2), __ctrl_)));
+        }
+
+        std::uint32_t match_empty() const noexcept { return match(__ctrl_empty); }
+
+        /* empty (-128) and deleted (-2) are the only control values below -1 */
+        std::uint32_t match_empty_or_deleted() const noexcept {
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), __ctrl_)));
+        }
+#else
+        const __ctrl_t* __ctrl_;
+
+        explicit __ctrl_group(const __ctrl_t* __p) noexcept : __ctrl_{__p} {}
+
+        std::uint32_t match(__ctrl_t __h2) const noexcept {
+            std::uint32_t __mask = 0;
+            for (std::size_t __i = 0; __i < __group_width; ++__i)
+                __mask |= static_cast<std::uint32_t>(__ctrl_[__i] == __h2) << __i;
+            return __mask;
+        }
+
+        std::uint32_t match_empty() const noexcept { return match(__ctrl_empty); }
+
+        std::uint32_t match_empty_or_deleted() const noexcept {
+            std::uint32_t __mask = 0;
+            for (std::size_t __i = 0; __i < __group_width; ++__i)
+                __mask |= static_cast<std::uint32_t>(__ctrl_[__i] < -1) << __i;
+            return __mask;
+        }
+#endif
+    };
+
+    template <class _Key, class _Tp, class _Hash, class _KeyEqual>
+    class flat_hash_map;
+
+    /**
+     * @brief
+     *      flat_hash_map iterator
+     *  @note
+     *      The iterator category is forward_iterator
+    */
+    template <class _Value, bool _Const>
+    class __flat_hash_map_iterator {
+            template <class, class, class, class>
+            friend class flat_hash_map;
+            friend class __flat_hash_map_iterator<_Value, !_Const>;
+
+            const __ctrl_t* __ctrl_;            //!< control byte of the current slot
+            const __ctrl_t* __ctrl_end_;        //!< one past the last control byte
+            _Value* __slot_;                    //!< current slot
+
+            void __skip_empty() noexcept {
+                while (__ctrl_ != __ctrl_end_ && *__ctrl_ < 0) {
+                    ++__ctrl_;
+                    ++__slot_;
+                }
+            }
+
+        public:
+            using value_type = _Value;                                              //!< value_type
+            using reference = std::conditional_t<_Const, const _Value&, _Value&>;   //!< reference
+            using pointer = std::conditional_t<_Const, const _Value*, _Value*>;     //!< pointer
+            using difference_type = std::ptrdiff_t;                                 //!< distance
+            using iterator_category = std::forward_iterator_tag;                    //!< category
+
+            __flat_hash_map_iterator() noexcept : __ctrl_{nullptr}, __ctrl_end_{nullptr}, __slot_{nullptr} {}
+
+            __flat_hash_map_iterator(const __ctrl_t* __ctrl, const __ctrl_t* __ctrl_end, _Value* __slot) noexcept
+                : __ctrl_{__ctrl}, __ctrl_end_{__ctrl_end}, __slot_{__slot} { __skip_empty(); }
+
+            /** @brief conversion from iterator to const_iterator */
+            template <bool _R, class = std::enable_if_t<_Const && !_R>>
+            __flat_hash_map_iterator(const __flat_hash_map_iterator<_Value, _R>& __x) noexcept
+                : __ctrl_{__x.__ctrl_}, __ctrl_end_{__x.__ctrl_end_}, __slot_{__x.__slot_} {}
+
+            reference operator*() const { return *__slot_; }
+            pointer operator->() const { return __slot_; }
+
+            __flat_hash_map_iterator& operator++() {
+                ++__ctrl_;
+                ++__slot_;
+                __skip_empty();
+                return *this;
+            }
+
+            __flat_hash_map_iterator operator++(int) {
+                __flat_hash_map_iterator __t{*this};
+                ++(*this);
+                return __t;
+            }
+
+            friend bool operator==(const __flat_hash_map_iterator& __x, const __flat_hash_map_iterator& __y) {
+                return __x.__ctrl_ == __y.__ctrl_;
+            }
+
+            friend bool operator!=(const __flat_hash_map_iterator& __x, const __flat_hash_map_iterator& __y) {
+                return !(__x == __y);
+            }
+    };
+
+    /**
+     * @brief flat_hash_map is an unordered map that stores its elements inline in a
+     *      single array (open addressing) next to an array of one-byte control words.
+     *
+     * @tparam
+     *      _Key the type of keys
+     * @tparam
+     *      _Tp the type of mapped values
+     * @tparam
+     *      _Hash hash function, heterogeneous lookup is enabled when both _Hash and
+     *      _KeyEqual define is_transparent
+     * @tparam
+     *      _KeyEqual key equality
+     *
+     * @note
+     *      A lookup hashes once, then compares the 7-bit fingerprint of the key against
+     *      16 control bytes per step and only touches the slots that match. Memory per
+     *      entry is sizeof(value_type) + 1 byte at a maximum load factor of 7/8.
+     *      Any insertion may invalidate iterators and references; erase invalidates
+     *      only the erased element.
+    */
+    template <class _Key, class _Tp, class _Hash = std::hash<_Key>, class _KeyEqual = std::equal_to<_Key>>
+    class flat_hash_map {
+        public:
+            using key_type = _Key;                                                  //!< key_type
+            using mapped_type = _Tp;                                                //!< mapped_type
+            using value_type = std::pair<const _Key, _Tp>;                          //!< value_type
+            using size_type = std::size_t;                                          //!< size_type
+            using hasher = _Hash;                                                   //!< hasher
+            using key_equal = _KeyEqual;                                            //!< key_equal
+            using reference = value_type&;                                          //!< reference
+            using const_reference = const value_type&;                              //!< const_reference
+            using iterator = __flat_hash_map_iterator<value_type, false>;           //!< iterator type
+            using const_iterator = __flat_hash_map_iterator<value_type, true>;      //!< const_iterator type
+
+        private:
+            static constexpr bool __is_transparent =
+                requires { typename _Hash::is_transparent; typename _KeyEqual::is_transparent; };
+
+        public:
+            /** @brief default constructor, does not allocate */
+            flat_hash_map() noexcept(std::is_nothrow_default_constructible_v<_Hash> &&
+                                     std::is_nothrow_default_constructible_v<_KeyEqual>)
+                : __ctrl_{nullptr}, __slots_{nullptr}, __capacity_{0}, __size_{0}, __growth_left_{0} {}
+
+            /** @brief constructor reserving room for __n elements */
+            explicit flat_hash_map(size_type __n, const _Hash& __hash = _Hash(), const _KeyEqual& __eq = _KeyEqual())
+                : __hash_{__hash}, __eq_{__eq}, __ctrl_{nullptr}, __slots_{nullptr}, __capacity_{0}, __size_{0}, __growth_left_{0} {
+                reserve(__n);
+            }
+
+            /** @brief copy constructor */
+            flat_hash_map(const flat_hash_map& __x);
+
+            /** @brief move constructor */
+            flat_hash_map(flat_hash_map&& __x) noexcept;
+
+            /** @brief copy assignment operator */
+            flat_hash_map& operator=(const flat_hash_map& __x) {
+                if (this != &__x) {
+                    flat_hash_map __t{__x};
+                    swap(__t);
+                }
+                return *this;
+            }
+
+            /** @brief move assignment operator */
+            flat_hash_map& operator=(flat_hash_map&& __x) noexcept {
+                flat_hash_map __t{std::move(__x)};
+                swap(__t);
+                return *this;
+            }
+
+            /** @brief default destructor */
+            ~flat_hash_map() {
+                __destroy_slots();
+                __deallocate_table(__ctrl_, __capacity_);
+            }
+
+            /** @brief return the number of elements */
+            size_type size() const noexcept { return __size_; }
+
+            /** @brief check whether the map is empty */
+            bool empty() const noexcept { return __size_ == 0; }
+
+            /** @brief return the number of slots */
+            size_type capacity() const noexcept { return __capacity_; }
+
+            /** @brief return size() / capacity() */
+            float load_factor() const noexcept { return __capacity_ == 0 ? 0.0f : static_cast<float>(__size_) / __capacity_; }
+
+            /** @brief return the maximum load factor, fixed to 7/8 */
+            static constexpr float max_load_factor() noexcept { return 0.875f; }
+
+            /** @brief return an iterator to the first element */
+            iterator begin() noexcept { return iterator{__ctrl_, __ctrl_ + __capacity_, __slots_}; }
+
+            /** @brief return an iterator to the end */
+            iterator end() noexcept { return iterator{__ctrl_ + __capacity_, __ctrl_ + __capacity_, __slots_ + __capacity_}; }
+
+            /** @brief return a constant iterator to the first element */
+            const_iterator begin() const noexcept { return cbegin(); }
+
+            /** @brief return a constant iterator to the end */
+            const_iterator end() const noexcept { return cend(); }
+
+            /** @brief return a constant iterator to the first element */
+            const_iterator cbegin() const noexcept { return const_iterator{__ctrl_, __ctrl_ + __capacity_, __slots_}; }
+
+            /** @brief return a constant iterator to the end */
+            const_iterator cend() const noexcept { return const_iterator{__ctrl_ + __capacity_, __ctrl_ + __capacity_, __slots_ + __capacity_}; }
+
+            template <class... _Args>
+            std::pair<iterator, bool> try_emplace(const _Key& __k, _Args&&... __args);
+
+            template <class... _Args>
+            std::pair<iterator, bool> try_emplace(_Key&& __k, _Args&&... __args);
+
+            /**
+             * @brief
+             *      construct an element in place if its key is not present
+             *
+             * @return
+             *      iterator to the element with that key and whether it was inserted
+            */
+            template <class... _Args>
+            std::pair<iterator, bool> emplace(_Args&&... __args) {
+                value_type __v(std::forward<_Args>(__args)...);
+                return try_emplace(std::move(const_cast<_Key&>(__v.first)), std::move(__v.second));
+            }
+
+            /** @brief insert __v if its key is not present */
+            std::pair<iterator, bool> insert(const value_type& __v) { return try_emplace(__v.first, __v.second); }
+
+            /** @brief insert __v if its key is not present */
+            std::pair<iterator, bool> insert(value_type&& __v) {
+                return try_emplace(std::move(const_cast<_Key&>(__v.first)), std::move(__v.second));
+            }
+
+            /** @brief return a reference to the value mapped to __k, default constructing it if needed */
+            _Tp& operator[](const _Key& __k) { return try_emplace(__k).first->second; }
+
+            /** @brief return a reference to the value mapped to __k, default constructing it if needed */
+            _Tp& operator[](_Key&& __k) { return try_emplace(std::move(__k)).first->second; }
+
+            /** @brief return a reference to the value mapped to __k, throw std::out_of_range if absent */
+            _Tp& at(const _Key& __k) { return __at(__k); }
+
+            /** @brief return a constant reference to the value mapped to __k, throw std::out_of_range if absent */
+            const _Tp& at(const _Key& __k) const { return const_cast<flat_hash_map*>(this)->__at(__k); }
+
+            /** @brief return an iterator to the element with key __k, end() if absent */
+            iterator find(const _Key& __k) { return __find(__k); }
+
+            /** @brief return a constant iterator to the element with key __k, end() if absent */
+            const_iterator find(const _Key& __k) const { return const_cast<flat_hash_map*>(this)->__find(__k); }
+
+            /** @brief check whether an element with key __k is present */
+            bool contains(const _Key& __k) const { return __find_index(__k) != __capacity_; }
+
+            /** @brief return the number of elements with key __k (0 or 1) */
+            size_type count(const _Key& __k) const { return contains(__k) ? 1 : 0; }
+
+            /** @brief remove the element with key __k, return the number of removed elements */
+            size_type erase(const _Key& __k) { return __erase_key(__k); }
+
+            /** @brief heterogeneous at(), enabled by a transparent hasher and key_equal */
+            template <class _K2> requires __is_transparent
+            _Tp& at(const _K2& __k) { return __at(__k); }
+
+            /** @brief heterogeneous at(), enabled by a transparent hasher and key_equal */
+            template <class _K2> requires __is_transparent
+            const _Tp& at(const _K2& __k) const { return const_cast<flat_hash_map*>(this)->__at(__k); }
+
+            /** @brief heterogeneous find(), enabled by a transparent hasher and key_equal */
+            template <class _K2> requires __is_transparent
+            iterator find(const _K2& __k) { return __find(__k); }
+
+            /** @brief heterogeneous find(), enabled by a transparent hasher and key_equal */
+            template <class _K2> requires __is_transparent
+            const_iterator find(const _K2& __k) const { return const_cast<flat_hash_map*>(this)->__find(__k); }
+
+            /** @brief heterogeneous contains(), enabled by a transparent hasher and key_equal */
+            template <class _K2> requires __is_transparent
+            bool contains(const _K2& __k) const { return __find_index(__k) != __capacity_; }
+
+            /** @brief heterogeneous count(), enabled by a transparent hasher and key_equal */
+            template <class _K2> requires __is_transparent
+            size_type count(const _K2& __k) const { return contains(__k) ? 1 : 0; }
+
+            /** @brief heterogeneous erase(), enabled by a transparent hasher and key_equal */
+            template <class _K2> requires __is_transparent
+            size_type erase(const _K2& __k) { return __erase_key(__k); }
+
+            /** @brief remove the element at __pos, return an iterator to the next element */
+            iterator erase(const_iterator __pos) {
+                size_type __i = static_cast<size_type>(__pos.__ctrl_ - __ctrl_);
+                __erase_at(__i);
+                return __iterator_at(__i);
+            }
+
+            /** @brief remove the element at __pos, return an iterator to the next element */
+            iterator erase(iterator __pos) { return erase(const_iterator{__pos}); }
+
+            void clear() noexcept;
+            void reserve(size_type __n);
+
+            memory_footprint memory_usage() const noexcept;
+
+            /** @brief exchange the contents with __x */
+            void swap(flat_hash_map& __x) noexcept {
+                using std::swap;
+                swap(__hash_, __x.__hash_);
+                swap(__eq_, __x.__eq_);
+                swap(__ctrl_, __x.__ctrl_);
+                swap(__slots_, __x.__slots_);
+                swap(__capacity_, __x.__capacity_);
+                swap(__size_, __x.__size_);
+                swap(__growth_left_, __x.__growth_left_);
+            }
+
+        private:
+            [[no_unique_address]] _Hash __hash_;
+            [[no_unique_address]] _KeyEqual __eq_;
+            __ctrl_t* __ctrl_;                  //!< __capacity_ control bytes, followed by the slots
+            value_type* __slots_;               //!< __capacity_ slots, in the same allocation as __ctrl_
+            size_type __capacity_;              //!< 0 or a power of two >= 16
+            size_type __size_;
+            size_type __growth_left_;           //!< insertions into empty slots left before a rehash
+
+            static constexpr std::size_t __slots_offset(size_type __cap) noexcept {
+                return (__cap + alignof(value_type) - 1) & ~(alignof(value_type) - 1);
+            }
+
+            static constexpr std::size_t __table_alignment() noexcept {
+                return alignof(value_type) > __group_width ? alignof(value_type) : __group_width;
+            }
+
+            static constexpr size_type __growth_for(size_type __cap) noexcept { return __cap - __cap / 8; }
+
+            /* std::hash is the identity for integers: mix it so that H1 and H2 both see every bit */
+            std::uint64_t __mixed_hash(std::uint64_t __h) const noexcept {
+                __h ^= __h >> 33;
+                __h *= 0xff51afd7ed558ccdULL;
+                __h ^= __h >> 33;
+                return __h;
+            }
+
+            template <class _K2>
+            std::uint64_t __hash_of(const _K2& __k) const { return __mixed_hash(static_cast<std::uint64_t>(__hash_(__k))); }
+
+            static __ctrl_t __h2(std::uint64_t __h) noexcept { return static_cast<__ctrl_t>(__h & 0x7F); }
+            static size_type __h1(std::uint64_t __h) noexcept { return static_cast<size_type>(__h >> 7); }
+
+            iterator __iterator_at(size_type __i) noexcept { return iterator{__ctrl_ + __i, __ctrl_ + __capacity_, __slots_ + __i}; }
+
+            template <class _K2>
+            size_type __find_index(const _K2& __k) const;
+
+            template <class _K2>
+            iterator __find(const _K2& __k) {
+                size_type __i = __find_index(__k);
+                return __i == __capacity_ ? end() : __iterator_at(__i);
+            }
+
+            template <class _K2>
+            _Tp& __at(const _K2& __k) {
+                size_type __i = __find_index(__k);
+                if (__i == __capacity_) throw std::out_of_range("Key not found");
+                return __slots_[__i].second;
+            }
+
+            template <class _K2>
+            size_type __erase_key(const _K2& __k) {
+                size_type __i = __find_index(__k);
+                if (__i == __capacity_) return 0;
+                __erase_at(__i);
+                return 1;
+            }
+            static size_type __find_insert_slot(const __ctrl_t* __ctrl, size_type __cap, std::uint64_t __h) noexcept;
+
+            template <class _K, class... _Args>
+            std::pair<iterator, bool> __try_emplace_impl(_K&& __k, _Args&&... __args);
+
+            void __erase_at(size_type __i) noexcept;
+            void __rehash(size_type __new_capacity);
+            void __destroy_slots() noexcept;
+
+            static __ctrl_t* __allocate_table(size_type __cap);
+            static void __deallocate_table(__ctrl_t* __ctrl, size_type __cap) noexcept;
+    };
+};      /* namespace dsa */
+
+template <class _Key, class _Tp, class _Hash, class _KeyEqual>
+dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::flat_hash_map(const flat_hash_map& __x)
+    : __hash_{__x.__hash_}, __eq_{__x.__eq_}, __ctrl_{nullptr}, __slots_{nullptr}, __capacity_{0}, __size_{0}, __growth_left_{0} {
+    if constexpr (std::is_trivially_copyable_v<_Key> && std::is_trivially_copyable_v<_Tp>) {
+        /* Same hasher, same capacity: the table is copied as it is, tombstones included */
+        if (__x.__capacity_ == 0) return;
+        __ctrl_ = __allocate_table(__x.__capacity_);
+        __slots_ = reinterpret_cast<value_type*>(reinterpret_cast<char*>(__ctrl_) + __slots_offset(__x.__capacity_));
+        std::memcpy(__ctrl_, __x.__ctrl_, __slots_offset(__x.__capacity_) + __x.__capacity_ * sizeof(value_type));
+        __capacity_ = __x.__capacity_;
+        __size_ = __x.__size_;
+        __growth_left_ = __x.__growth_left_;
+    } else {
+        reserve(__x.size());
+        for (const value_type& __v : __x) try_emplace(__v.first, __v.second);
+    }
+}
+
+template <class _Key, class _Tp, class _Hash, class _KeyEqual>
+dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::flat_hash_map(flat_hash_map&& __x) noexcept
+    : __hash_{std::move(__x.__hash_)}, __eq_{std::move(__x.__eq_)}, __ctrl_{__x.__ctrl_}, __slots_{__x.__slots_},
+      __capacity_{__x.__capacity_}, __size_{__x.__size_}, __growth_left_{__x.__growth_left_} {
+    __x.__ctrl_ = nullptr;
+    __x.__slots_ = nullptr;
+    __x.__capacity_ = __x.__size_ = __x.__growth_left_ = 0;
+}
+
+template <class _Key, class _Tp, class _Hash, class _KeyEqual>
+dsa::__ctrl_t* dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::__allocate_table(size_type __cap) {
+    void* __mem = ::operator new(__slots_offset(__cap) + __cap * sizeof(value_type), std::align_val_t{__table_alignment()});
+    std::memset(__mem, static_cast<unsigned char>(__ctrl_empty), __cap);
+    return static_cast<__ctrl_t*>(__mem);
+}
+
+template <class _Key, class _Tp, class _Hash, class _KeyEqual>
+void dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::__deallocate_table(__ctrl_t* __ctrl, size_type __cap) noexcept {
+    if (__ctrl != nullptr)
+        ::operator delete(static_cast<void*>(__ctrl), __slots_offset(__cap) + __cap * sizeof(value_type),
+                          std::align_val_t{__table_alignment()});
+}
+
+template <class _Key, class _Tp, class _Hash, class _KeyEqual>
+void dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::__destroy_slots() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+        for (size_type __i = 0; __i < __capacity_; ++__i)
+            if (__ctrl_[__i] >= 0) std::destroy_at(__slots_ + __i);
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Look up the slot holding key __k
+**
+** @param [in]
+**      __k: the key, or any type the transparent hasher and key_equal accept
+**
+** @return
+**       the slot index, __capacity_ if the key is absent
+**
+** @note
+**       Probes aligned groups of 16 slots in triangular order and stops at the first
+**       group that still has an empty slot. Complexity: O(1) average
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Hash, class _KeyEqual>
+template <class _K2>
+typename dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::size_type
+dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::__find_index(const _K2& __k) const {
+    if (__capacity_ == 0) return __capacity_;
+
+    const std::uint64_t __h = __hash_of(__k);
+    const size_type __group_mask = __capacity_ / __group_width - 1;
+    size_type __g = __h1(__h) & __group_mask;
+    for (size_type __step = 1; ; ++__step) {
+        __ctrl_group __group{__ctrl_ + __g * __group_width};
+        for (std::uint32_t __m = __group.match(__h2(__h)); __m != 0; __m &= __m - 1) {
+            size_type __i = __g * __group_width + std::countr_zero(__m);
+            if (__eq_(__slots_[__i].first, __k)) return __i;
+        }
+        if (__group.match_empty() != 0) return __capacity_;
+        __g = (__g + __step) & __group_mask;
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Return the first empty or deleted slot on the probe sequence of hash __h in the
+**      table of __cap slots whose control bytes start at __ctrl
+**
+** @note
+**       The table must not be full. Complexity: O(1) average
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Hash, class _KeyEqual>
+typename dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::size_type
+dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::__find_insert_slot(const __ctrl_t* __ctrl, size_type __cap, std::uint64_t __h) noexcept {
+    const size_type __group_mask = __cap / __group_width - 1;
+    size_type __g = __h1(__h) & __group_mask;
+    for (size_type __step = 1; ; ++__step) {
+        std::uint32_t __m = __ctrl_group{__ctrl + __g * __group_width}.match_empty_or_deleted();
+        if (__m != 0) return __g * __group_width + std::countr_zero(__m);
+        __g = (__g + __step) & __group_mask;
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Insert an element with key __k and a value constructed from __args if __k is absent
+**
+** @return
+**       iterator to the element with key __k and whether it was inserted
+**
+** @note
+**       Reusing a tombstone does not consume growth; filling an empty slot does, and
+**       rehashes the table once no growth is left. Complexity: O(1) amortized
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Hash, class _KeyEqual>
+template <class _K, class... _Args>
+std::pair<typename dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::iterator, bool>
+dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::__try_emplace_impl(_K&& __k, _Args&&... __args) {
+    size_type __i = __find_index(__k);
+    if (__i != __capacity_) return {__iterator_at(__i), false};
+
+    const std::uint64_t __h = __hash_of(__k);
+    if (__capacity_ == 0) __rehash(__group_width);
+    __i = __find_insert_slot(__ctrl_, __capacity_, __h);
+    if (__growth_left_ == 0 && __ctrl_[__i] == __ctrl_empty) {
+        /* Mostly tombstones: clean up in place. Otherwise double the table. */
+        __rehash(__size_ * 2 < __growth_for(__capacity_) ? __capacity_ : __capacity_ * 2);
+        __i = __find_insert_slot(__ctrl_, __capacity_, __h);
+    }
+
+    ::new (static_cast<void*>(__slots_ + __i)) value_type(std::piecewise_construct,
+                                                          std::forward_as_tuple(std::forward<_K>(__k)),
+                                                          std::forward_as_tuple(std::forward<_Args>(__args)...));
+    if (__ctrl_[__i] == __ctrl_empty) --__growth_left_;
+    __ctrl_[__i] = __h2(__h);
+    ++__size_;
+    return {__iterator_at(__i), true};
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Insert an element with key __k and a value constructed from __args if __k is absent.
+**      Nothing is constructed when the key is already present.
+**
+** @return
+**       iterator to the element with key __k and whether it was inserted
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Hash, class _KeyEqual>
+template <class... _Args>
+std::pair<typename dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::iterator, bool>
+dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::try_emplace(const _Key& __k, _Args&&... __args) {
+    return __try_emplace_impl(__k, std::forward<_Args>(__args)...);
+}
+
+template <class _Key, class _Tp, class _Hash, class _KeyEqual>
+template <class... _Args>
+std::pair<typename dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::iterator, bool>
+dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::try_emplace(_Key&& __k, _Args&&... __args) {
+    return __try_emplace_impl(std::move(__k), std::forward<_Args>(__args)...);
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Destroy the element in slot __i
+**
+** @note
+**       A probe only continues past a group that has no empty slot, and a group never
+**       regains an empty slot before the next rehash once it has been full. So if the
+**       group of __i still has an empty slot, no probe sequence ever passed through it
+**       and the slot can go straight back to empty without leaving a tombstone.
+**       Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Hash, class _KeyEqual>
+void dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::__erase_at(size_type __i) noexcept {
+    std::destroy_at(__slots_ + __i);
+    --__size_;
+    if (__ctrl_group{__ctrl_ + (__i & ~(__group_width - 1))}.match_empty() != 0) {
+        __ctrl_[__i] = __ctrl_empty;
+        ++__growth_left_;
+    } else {
+        __ctrl_[__i] = __ctrl_deleted;
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Move every element into a fresh table of __new_capacity slots, dropping tombstones
+**
+** @note
+**       The new table is filled on the side and only replaces the old one once every
+**       element is in it. Elements of a trivially relocatable value_type are memcpy'd and
+**       moved when the hash and the moves cannot throw; the old table is intact until the
+**       end in both cases. Otherwise elements are copied and the old ones destroyed at the
+**       end, so a throwing hash or copy leaves the map unchanged. Only a move-only
+**       value_type whose move or hash can throw is moved anyway, like std::vector does,
+**       and keeps its moved-from elements then.
+**       Complexity: O(n)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Hash, class _KeyEqual>
+void dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::__rehash(size_type __new_capacity) {
+    constexpr bool __nothrow_move = std::is_nothrow_invocable_v<const _Hash&, const _Key&> &&
+                                    std::is_nothrow_move_constructible_v<_Key> && std::is_nothrow_move_constructible_v<_Tp>;
+    constexpr bool __copy = !__nothrow_move && std::is_copy_constructible_v<value_type>;
+
+    __ctrl_t* __ctrl = __allocate_table(__new_capacity);
+    value_type* __slots = reinterpret_cast<value_type*>(reinterpret_cast<char*>(__ctrl) + __slots_offset(__new_capacity));
+    size_type __i = 0;
+    try {
+        for (; __i < __capacity_; ++__i) {
+            if (__ctrl_[__i] < 0) continue;
+            const std::uint64_t __h = __hash_of(__slots_[__i].first);
+            const size_type __j = __find_insert_slot(__ctrl, __new_capacity, __h);
+            if constexpr (is_trivially_relocatable_v<value_type>) {
+                std::memcpy(static_cast<void*>(__slots + __j), static_cast<const void*>(__slots_ + __i), sizeof(value_type));
+            } else if constexpr (__copy) {
+                ::new (static_cast<void*>(__slots + __j)) value_type(__slots_[__i]);
+            } else {
+                /* The old slot is destroyed afterwards, so moving out of its const key is safe */
+                ::new (static_cast<void*>(__slots + __j)) value_type(std::move(const_cast<_Key&>(__slots_[__i].first)),
+                                                                     std::move(__slots_[__i].second));
+                if constexpr (__nothrow_move) std::destroy_at(__slots_ + __i);
+            }
+            __ctrl[__j] = __h2(__h);
+        }
+    } catch (...) {
+        if constexpr (!is_trivially_relocatable_v<value_type> && !std::is_trivially_destructible_v<value_type>) {
+            for (size_type __j = 0; __j < __new_capacity; ++__j)
+                if (__ctrl[__j] >= 0) std::destroy_at(__slots + __j);
+        }
+        __deallocate_table(__ctrl, __new_capacity);
+        throw;
+    }
+
+    if constexpr (!is_trivially_relocatable_v<value_type> && !__nothrow_move) __destroy_slots();
+    __deallocate_table(__ctrl_, __capacity_);
+    __ctrl_ = __ctrl;
+    __slots_ = __slots;
+    __capacity_ = __new_capacity;
+    __growth_left_ = __growth_for(__new_capacity) - __size_;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Remove every element, keep the allocated slots
+**
+** @note
+**       Complexity: O(capacity)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Hash, class _KeyEqual>
+void dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::clear() noexcept {
+    __destroy_slots();
+    if (__ctrl_ != nullptr) std::memset(__ctrl_, static_cast<unsigned char>(__ctrl_empty), __capacity_);
+    __size_ = 0;
+    __growth_left_ = __growth_for(__capacity_);
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Make room for at least __n elements without further rehashing
+**
+** @note
+**       Complexity: O(n) if a rehash happens, O(1) otherwise
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Hash, class _KeyEqual>
+void dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::reserve(size_type __n) {
+    size_type __cap = __group_width;
+    while (__growth_for(__cap) < __n) __cap *= 2;
+    if (__cap > __capacity_ || (__capacity_ != 0 && __growth_left_ < __n - std::min(__n, __size_)))
+        __rehash(std::max(__cap, __capacity_));
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Report the memory held by the map
+**
+** @return
+**       payload, control bytes and empty slots, and estimated allocator slack of the table
+**
+** @note
+**       Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Hash, class _KeyEqual>
+dsa::memory_footprint dsa::flat_hash_map<_Key, _Tp, _Hash, _KeyEqual>::memory_usage() const noexcept {
+    const std::size_t __table = __capacity_ == 0 ? 0 : __slots_offset(__capacity_) + __capacity_ * sizeof(value_type);
+    memory_footprint __m = __heap_block(__table, __table_alignment());
+    __m.payload_bytes = __size_ * sizeof(value_type);
+    __m.overhead_bytes += sizeof(*this) - __m.payload_bytes;
+    return __m;
+}
+#endif /* FLAT_HASH_MAP_H */
@@ -0,0 +1,228 @@
+/**
+ * @file    LaneQueue.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A fixed set of FIFO lanes served by strict priority or deficit round robin
+*/
+
+#ifndef LANE_QUEUE_H
+#define LANE_QUEUE_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include "Deque.h"
+#include "ErrorPolicy.h"
+#include "MemoryUsage.h"
+#include "queue.h"
+
+namespace dsa {
+    /**
+     * @brief how lane_queue::pop() picks a lane
+     *
+     * strict_priority: always the lowest-numbered non-empty lane; lane 0 is the most urgent.
+     * deficit_round_robin: non-empty lanes take turns, each turn serving up to the lane's
+     *      weight in elements (Shreedhar and Varghese's DRR with unit cost), so a lane gets
+     *      weight / sum of weights of the busy lanes of the throughput and none starves.
+    */
+    enum class lane_schedule { strict_priority, deficit_round_robin };
+
+    /** @brief counters of one lane, see lane_queue::stats() */
+    struct lane_stats {
+        std::size_t depth = 0;              //!< queued elements
+        std::size_t high_water = 0;         //!< largest depth seen
+        std::uint64_t pushed = 0;           //!< elements pushed
+        std::uint64_t popped = 0;           //!< elements popped
+    };
+
+    /**
+     * @brief lane_queue is a queue made of _Lanes FIFO lanes, e.g. one for interactive and one
+     *      for batch traffic. A bitmap of the non-empty lanes lets push() and pop() find a lane
+     *      with one find-first-set, in O(1) whatever the number of lanes.
+     *
+     * @tparam
+     *      _Tp the type of stored element
+     * @tparam
+     *      _Lanes number of lanes, 1 to 64
+     * @tparam
+     *      _Container the type of underlying container of each lane, see dsa::queue
+     * @tparam
+     *      _Policy what top_lane() on an empty queue does, see ErrorPolicy.h
+     *
+     * @note
+     *      Elements of one lane leave in FIFO order. push() to a lane number not below _Lanes
+     *      throws std::out_of_range. Not thread-safe.
+    */
+    template <class _Tp, std::size_t _Lanes, class _Container = deque<_Tp>, class _Policy = checked_policy>
+    class lane_queue {
+            static_assert(_Lanes >= 1 && _Lanes <= 64, "lane_queue: 1 to 64 lanes");
+            static_assert(dsa::error_policy<_Policy>, "_Policy must be an error policy");
+
+        public:
+            using error_policy = _Policy;                       //!< precondition policy
+            using value_type = _Tp;                             //!< value_type
+            using size_type = std::size_t;                      //!< size_type
+            using lane_type = queue<_Tp, _Container>;           //!< lane_type
+
+            /** @brief construct an empty queue; every lane has weight 1 */
+            explicit lane_queue(lane_schedule __schedule = lane_schedule::strict_priority) noexcept : __schedule_{__schedule} {
+                __weight_.fill(1);
+            }
+
+            /** @brief push a copy of __x to __lane */
+            void push(size_type __lane, const _Tp& __x) { emplace(__lane, __x); }
+
+            /** @brief push __x to __lane */
+            void push(size_type __lane, _Tp&& __x) { emplace(__lane, std::move(__x)); }
+
+            /** @brief construct an element from __args at the back of __lane */
+            template <class... _Args>
+            void emplace(size_type __lane, _Args&&... __args) {
+                __check(__lane);
+                __lanes_[__lane].emplace(std::forward<_Args>(__args)...);
+                __occupied_ |= std::uint64_t{1} << __lane;
+                ++__size_;
+                lane_stats& __s = __stats_[__lane];
+                ++__s.pushed;
+                __s.high_water = std::max(__s.high_water, __lanes_[__lane].size());
+            }
+
+            std::optional<_Tp> pop();
+
+            /** @brief remove and return the first element of __lane, std::nullopt if it is empty */
+            std::optional<_Tp> pop(size_type __lane) {
+                __check(__lane);
+                if (__lanes_[__lane].empty()) return std::nullopt;
+                return __take(__lane);
+            }
+
+            /** @brief return the lane pop() under strict priority would serve */
+            size_type top_lane() const noexcept(_Policy::is_nothrow) {
+                _Policy::require(__occupied_ != 0, "Empty lane_queue");
+                return __next_occupied(0);
+            }
+
+            /** @brief return the total number of elements */
+            size_type size() const noexcept { return __size_; }
+
+            /** @brief return the number of elements in __lane */
+            size_type size(size_type __lane) const {
+                __check(__lane);
+                return __lanes_[__lane].size();
+            }
+
+            /** @brief check whether every lane is empty */
+            bool empty() const noexcept { return __size_ == 0; }
+
+            /** @brief return the number of lanes */
+            static constexpr size_type lanes() noexcept { return _Lanes; }
+
+            /** @brief return the bitmap of non-empty lanes, bit i for lane i */
+            std::uint64_t occupied() const noexcept { return __occupied_; }
+
+            /** @brief return the schedule */
+            lane_schedule schedule() const noexcept { return __schedule_; }
+
+            /** @brief set the number of elements __lane may send per round robin turn, at least 1 */
+            void set_weight(size_type __lane, size_type __weight) {
+                __check(__lane);
+                if (__weight == 0) throw std::invalid_argument("lane_queue: weight must be positive");
+                __weight_[__lane] = __weight;
+            }
+
+            /** @brief return the weight of __lane */
+            size_type weight(size_type __lane) const {
+                __check(__lane);
+                return __weight_[__lane];
+            }
+
+            /** @brief return the counters of __lane */
+            lane_stats stats(size_type __lane) const {
+                __check(__lane);
+                lane_stats __s = __stats_[__lane];
+                __s.depth = __lanes_[__lane].size();
+                return __s;
+            }
+
+            /** @brief return the memory held by the queue */
+            memory_footprint memory_usage() const
+                requires requires(const _Container& __c) { __c.memory_usage(); }
+            {
+                memory_footprint __m;
+                for (const lane_type& __l : __lanes_) __m += __l.memory_usage();
+                __m.overhead_bytes += sizeof(*this) - sizeof(__lanes_);
+                return __m;
+            }
+
+        private:
+            std::array<lane_type, _Lanes> __lanes_;
+            std::array<lane_stats, _Lanes> __stats_{};
+            std::array<size_type, _Lanes> __weight_;            //!< DRR quantum of each lane
+            std::array<size_type, _Lanes> __deficit_{};         //!< elements a lane may still send this turn
+            std::uint64_t __occupied_ = 0;                      //!< bit i set if lane i is not empty
+            size_type __size_ = 0;
+            size_type __cursor_ = 0;                            //!< lane whose turn it is under DRR
+            lane_schedule __schedule_;
+
+            static void __check(size_type __lane) {
+                if (__lane >= _Lanes) throw std::out_of_range("lane_queue: no such lane");
+            }
+
+            /* First non-empty lane at or after __from, wrapping around; the queue must not be empty */
+            size_type __next_occupied(size_type __from) const noexcept {
+                const std::uint64_t __ahead = __from < 64 ? __occupied_ & (~std::uint64_t{0} << __from) : 0;
+                return static_cast<size_type>(std::countr_zero(__ahead != 0 ? __ahead : __occupied_));
+            }
+
+            _Tp __take(size_type __lane) {
+                lane_type& __l = __lanes_[__lane];
+                _Tp __v = std::move(__l.front());
+                __l.pop();
+                --__size_;
+                ++__stats_[__lane].popped;
+                if (__l.empty()) {
+                    __occupied_ &= ~(std::uint64_t{1} << __lane);
+                    __deficit_[__lane] = 0;                     /* an idle lane does not bank credit */
+                }
+                return __v;
+            }
+    };
+}   /* namespace dsa */
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Remove and return the next element according to the schedule
+**
+** @return
+**       the element, or std::nullopt if every lane is empty
+**
+** @note
+**       Under deficit round robin a lane receives its weight as credit when its turn starts,
+**       spends one unit per element and hands the turn on when the credit is spent or the lane
+**       runs dry. Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _Lanes, class _Container, class _Policy>
+std::optional<_Tp> dsa::lane_queue<_Tp, _Lanes, _Container, _Policy>::pop() {
+    if (__occupied_ == 0) return std::nullopt;
+    if (__schedule_ == lane_schedule::strict_priority) return __take(__next_occupied(0));
+
+    const size_type __lane = __next_occupied(__cursor_);
+    if (__deficit_[__lane] == 0) __deficit_[__lane] = __weight_[__lane];     /* only the lane on its turn holds credit */
+    --__deficit_[__lane];
+    std::optional<_Tp> __v{__take(__lane)};
+    __cursor_ = __deficit_[__lane] == 0 ? (__lane + 1) % _Lanes : __lane;
+    return __v;
+}
+
+#endif /* LANE_QUEUE_H */
@@ -0,0 +1,239 @@
+/**
+ * @file    ManagedQueue.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A FIFO queue that measures how long elements wait and sheds them with CoDel
+*/
+
+#ifndef MANAGED_QUEUE_H
+#define MANAGED_QUEUE_H
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+
+#include "Deque.h"
+#include "LatencyHistogram.h"
+#include "MemoryUsage.h"
+#include "queue.h"
+
+namespace dsa {
+    /**
+     * @brief parameters of the CoDel policy of managed_queue, named as in RFC 8289
+     *
+     * @note
+     *      A target of duration::max() never drops, leaving only the sojourn-time tracking.
+     *      max_sojourn is not part of CoDel: the control law slows down senders that react to
+     *      drops, but cannot bound the delay of a queue fed faster than it is drained no matter
+     *      what. While dropping, elements older than max_sojourn are therefore dropped as well.
+    */
+    struct codel_options {
+        std::chrono::nanoseconds target = std::chrono::milliseconds(5);        //!< acceptable standing delay
+        std::chrono::nanoseconds interval = std::chrono::milliseconds(100);    //!< how long the delay may stay above target
+        std::chrono::nanoseconds max_sojourn = std::chrono::milliseconds(100); //!< oldest element served while dropping
+    };
+
+    /** @brief an element with the time it was pushed */
+    template <class _Tp, class _TimePoint>
+    struct __stamped {
+        _TimePoint __enqueued_;
+        _Tp __value_;
+    };
+
+    /**
+     * @brief managed_queue is a FIFO queue that keeps its latency bounded under overload. Every
+     *      element is stamped on push; pop() measures its sojourn time and applies CoDel
+     *      (Nichols and Jacobson, RFC 8289): once the sojourn time has stayed above target for
+     *      a whole interval, pop() drops elements from the head at a rate that grows with the
+     *      square root of the number of drops until the delay is back under target.
+     *
+     * Dropped elements go to the drop handler, if any, together with their sojourn time, so they
+     * can be diverted to a slower path instead of lost. The sojourn times of the elements pop()
+     * returns are kept in a latency_histogram.
+     *
+     * @tparam
+     *      _Tp the type of stored element
+     * @tparam
+     *      _Clock the clock used for stamps, std::chrono::steady_clock by default
+     * @tparam
+     *      _Container the type of underlying container, see dsa::queue
+     *
+     * @note
+     *      Not thread-safe, like dsa::queue. Elements are dropped only inside pop(), so the
+     *      policy reacts to how fast the consumer really drains the queue.
+    */
+    template <class _Tp, class _Clock = std::chrono::steady_clock,
+              class _Container = deque<__stamped<_Tp, typename _Clock::time_point>>>
+    class managed_queue {
+        public:
+            using value_type = _Tp;                                                 //!< value_type
+            using size_type = std::size_t;                                          //!< size_type
+            using clock = _Clock;                                                   //!< clock
+            using time_point = typename _Clock::time_point;                         //!< time_point
+            using duration = std::chrono::nanoseconds;                              //!< duration
+            using drop_handler = std::function<void(_Tp&&, duration)>;             //!< called with each dropped element
+
+            /** @brief construct an empty queue with the given policy and drop handler */
+            explicit managed_queue(codel_options __options = {}, drop_handler __on_drop = {})
+                : __options_{__options}, __on_drop_{std::move(__on_drop)} {}
+
+            /** @brief push a copy of __x, stamped now */
+            void push(const _Tp& __x) { __items_.push(__item{_Clock::now(), __x}); }
+
+            /** @brief push __x, stamped now */
+            void push(_Tp&& __x) { __items_.push(__item{_Clock::now(), std::move(__x)}); }
+
+            /** @brief construct an element from __args at the back, stamped now */
+            template <class... _Args>
+            void emplace(_Args&&... __args) { __items_.push(__item{_Clock::now(), _Tp(std::forward<_Args>(__args)...)}); }
+
+            std::optional<_Tp> pop();
+
+            /** @brief return the number of queued elements */
+            size_type size() const noexcept { return __items_.size(); }
+
+            /** @brief check whether the queue is empty */
+            bool empty() const noexcept { return __items_.empty(); }
+
+            /** @brief return how long the oldest element has waited, 0 for an empty queue */
+            duration head_sojourn() const {
+                if (__items_.empty()) return duration{0};
+                return std::chrono::duration_cast<duration>(_Clock::now() - __items_.front().__enqueued_);
+            }
+
+            /** @brief return the sojourn times of the elements pop() has returned */
+            const latency_histogram& sojourn() const noexcept { return __sojourn_; }
+
+            /** @brief forget the recorded sojourn times */
+            void reset_sojourn() noexcept { __sojourn_.reset(); }
+
+            /** @brief return the number of elements dropped so far */
+            std::uint64_t dropped() const noexcept { return __dropped_; }
+
+            /** @brief check whether CoDel is currently in its dropping state */
+            bool dropping() const noexcept { return __dropping_; }
+
+            /** @brief return the policy */
+            const codel_options& options() const noexcept { return __options_; }
+
+            /** @brief replace the drop handler */
+            void set_drop_handler(drop_handler __on_drop) { __on_drop_ = std::move(__on_drop); }
+
+            /** @brief return the memory held by the queue, stamps counted as overhead */
+            memory_footprint memory_usage() const
+                requires requires(const _Container& __c) { __c.memory_usage(); }
+            {
+                memory_footprint __m = __items_.memory_usage();
+                const size_type __stamps = __items_.size() * (sizeof(__item) - sizeof(_Tp));
+                __m.payload_bytes -= __stamps;
+                __m.overhead_bytes += __stamps + sizeof(*this) - sizeof(__items_);
+                return __m;
+            }
+
+        private:
+            using __item = __stamped<_Tp, time_point>;
+
+            queue<__item, _Container> __items_;
+            codel_options __options_;
+            drop_handler __on_drop_;
+            latency_histogram __sojourn_;
+            std::optional<time_point> __first_above_;       //!< when the delay will have been above target for an interval
+            time_point __drop_next_{};                      //!< time of the next drop while dropping
+            std::uint32_t __count_ = 0;                     //!< drops since entering the dropping state
+            std::uint32_t __lastcount_ = 0;                 //!< __count_ when the dropping state was last entered
+            bool __dropping_ = false;
+            std::uint64_t __dropped_ = 0;
+
+            std::optional<__item> __dodequeue(time_point __now, bool& __ok_to_drop);
+
+            /* The CoDel control law: the next drop comes interval / sqrt(count) after __t */
+            time_point __control_law(time_point __t, std::uint32_t __count) const noexcept {
+                const double __gap = static_cast<double>(__options_.interval.count()) / std::sqrt(static_cast<double>(__count));
+                return __t + std::chrono::duration_cast<typename _Clock::duration>(duration{static_cast<duration::rep>(__gap)});
+            }
+
+            void __drop(__item&& __x, time_point __now) {
+                ++__dropped_;
+                if (__on_drop_) __on_drop_(std::move(__x.__value_), std::chrono::duration_cast<duration>(__now - __x.__enqueued_));
+            }
+    };
+}   /* namespace dsa */
+
+/* Take the head and decide whether its sojourn time has been above target for an interval */
+template <class _Tp, class _Clock, class _Container>
+std::optional<typename dsa::managed_queue<_Tp, _Clock, _Container>::__item>
+dsa::managed_queue<_Tp, _Clock, _Container>::__dodequeue(time_point __now, bool& __ok_to_drop) {
+    __ok_to_drop = false;
+    std::optional<__item> __r = __items_.try_pop();
+    if (!__r) {
+        __first_above_.reset();
+        return __r;
+    }
+    /* An element that leaves the queue empty was not delayed by a standing queue */
+    if (__now - __r->__enqueued_ < __options_.target || __items_.empty()) {
+        __first_above_.reset();
+    } else if (!__first_above_) {
+        __first_above_ = __now + std::chrono::duration_cast<typename _Clock::duration>(__options_.interval);
+    } else if (__now >= *__first_above_) {
+        __ok_to_drop = true;
+    }
+    return __r;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Remove and return the oldest element that CoDel does not drop
+**
+** @return
+**       the element, or std::nullopt if the queue is or becomes empty
+**
+** @note
+**       Follows the dequeue routine of RFC 8289, then, while dropping, also drops the
+**       elements older than max_sojourn. Dropped elements are passed to the drop
+**       handler, which may push to another queue but not to this one. Complexity: O(1) per
+**       element removed.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Clock, class _Container>
+std::optional<_Tp> dsa::managed_queue<_Tp, _Clock, _Container>::pop() {
+    const time_point __now = _Clock::now();
+    bool __ok_to_drop;
+    std::optional<__item> __r = __dodequeue(__now, __ok_to_drop);
+    if (__dropping_) {
+        if (!__ok_to_drop) __dropping_ = false;
+        while (__dropping_ && __now >= __drop_next_) {
+            __drop(std::move(*__r), __now);
+            ++__count_;
+            __r = __dodequeue(__now, __ok_to_drop);
+            if (!__ok_to_drop) __dropping_ = false;
+            else __drop_next_ = __control_law(__drop_next_, __count_);
+        }
+    } else if (__ok_to_drop) {
+        __drop(std::move(*__r), __now);
+        __r = __dodequeue(__now, __ok_to_drop);
+        __dropping_ = true;
+        /* Re-entering soon after leaving resumes near the previous drop rate */
+        const std::uint32_t __delta = __count_ - __lastcount_;
+        __count_ = __delta > 1 && __now - __drop_next_ < 16 * __options_.interval ? __delta : 1;
+        __drop_next_ = __control_law(__now, __count_);
+        __lastcount_ = __count_;
+    }
+    while (__dropping_ && __r && __now - __r->__enqueued_ > __options_.max_sojourn) {
+        __drop(std::move(*__r), __now);
+        __r = __dodequeue(__now, __ok_to_drop);
+        if (!__ok_to_drop) __dropping_ = false;
+    }
+    if (!__r) return std::nullopt;
+    __sojourn_.record(std::chrono::duration_cast<duration>(__now - __r->__enqueued_));
+    return std::optional<_Tp>{std::move(__r->__value_)};
+}
+
+#endif /* MANAGED_QUEUE_H */
@@ -0,0 +1,572 @@
+/**
+ * @file    MmapQueue.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A durable FIFO queue of byte records kept in memory-mapped segment files
+*/
+
+#ifndef MMAP_QUEUE_H
+#define MMAP_QUEUE_H
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "Checksum.h"
+#include "Deque.h"
+#include "ErrorPolicy.h"
+#include "MappedRegion.h"
+#include "MemoryUsage.h"
+
+namespace dsa {
+    /**
+     * @brief when an mmap_queue forces its writes to stable storage
+     *
+     * none: leave it to the kernel's writeback; a power loss may drop recent records.
+     * batch: msync once per push_batch(), at flush() and when the queue is closed.
+     * every_push: msync after every push() and every pop().
+    */
+    enum class sync_policy { none, batch, every_push };
+
+    /** @brief construction parameters of an mmap_queue */
+    struct mmap_queue_options {
+        std::size_t segment_bytes = std::size_t{64} << 20;     //!< size of one segment file, a multiple of 4096
+        sync_policy sync = sync_policy::batch;                  //!< durability of pushes and pops
+    };
+
+    /**
+     * @brief basic_mmap_queue is a FIFO queue of byte records that survives restarts. Records
+     *      are appended to fixed-size segment files mapped into memory; a segment is deleted
+     *      once every record in it has been popped.
+     *
+     * @tparam
+     *      _Policy what front() and pop() on an empty queue do, see ErrorPolicy.h
+     *
+     * @note
+     *      On disk, a segment is a 16-byte header (magic, segment number) followed by records:
+     *      a 4-byte length field holding the payload size + 1, a 4-byte CRC-32 of the length
+     *      field and the payload, the payload, and padding to 8 bytes. A zero length field
+     *      ends the data; 0xFFFFFFFF means the rest of the segment is unused. The consumer
+     *      position lives in a separate "head" file with two checksummed slots that are
+     *      written alternately.
+     *      Opening a directory recovers the queue: it reads the newest valid head slot, then
+     *      walks the records from there, and the tail is the first record that is missing or
+     *      fails its checksum. Anything after it is erased.
+     *      Pops are at-least-once: a record popped shortly before a crash may be delivered
+     *      again unless the head was synced.
+     *      Not thread-safe, and only one process may open a directory at a time.
+    */
+    template <class _Policy = checked_policy>
+    class basic_mmap_queue {
+        static_assert(dsa::error_policy<_Policy>, "_Policy must be an error policy");
+
+        public:
+            using size_type = std::size_t;                                  //!< size_type
+            using value_type = std::span<const std::byte>;                  //!< a view of one record
+            using error_policy = _Policy;                                   //!< precondition policy
+
+            explicit basic_mmap_queue(std::filesystem::path __dir, mmap_queue_options __options = {});
+
+            basic_mmap_queue(const basic_mmap_queue&) = delete;
+            basic_mmap_queue& operator=(const basic_mmap_queue&) = delete;
+
+            /** @brief sync unless the policy is none; the segments are unmapped with __segments_ */
+            ~basic_mmap_queue() {
+                if (__options_.sync != sync_policy::none) {
+                    try { flush(); } catch (...) {}
+                }
+            }
+
+            /** @brief return the number of records */
+            size_type size() const noexcept { return __count_; }
+
+            /** @brief check whether the queue is empty */
+            bool empty() const noexcept { return __count_ == 0; }
+
+            /** @brief return the number of segment files in use */
+            size_type segments() const noexcept { return __segments_.size(); }
+
+            /** @brief return the largest payload a record can hold */
+            size_type max_record_size() const noexcept { return __options_.segment_bytes - __segment_header - __record_header - 8; }
+
+            /** @brief return the directory of the queue */
+            const std::filesystem::path& directory() const noexcept { return __dir_; }
+
+            /**
+             * @brief
+             *      return a view of the first record, straight into the mapping
+             *
+             * @note
+             *      The view stays valid until the record is popped.
+            */
+            value_type front() const noexcept(_Policy::is_nothrow) {
+                _Policy::require(__count_ != 0, "Empty queue");
+                const std::byte* __r = __segments_.front().__base() + __head_off_;
+                return value_type{__r + __record_header, __load32(__r) - 1};
+            }
+
+            /** @brief append a copy of the bytes __record */
+            void push(std::span<const std::byte> __record) {
+                __append(__record);
+                if (__options_.sync == sync_policy::every_push) flush();
+            }
+
+            /** @brief append a copy of the characters of __record */
+            void push(std::string_view __record) { push(std::as_bytes(std::span<const char>{__record.data(), __record.size()})); }
+
+            /**
+             * @brief
+             *      append every record of __records, then sync once unless the policy is none
+             *
+             * @param[in]
+             *      __records: range of objects convertible to std::string_view or to
+             *      std::span<const std::byte>
+            */
+            template <class _Range>
+            void push_batch(const _Range& __records) {
+                for (const auto& __r : __records) {
+                    if constexpr (std::is_convertible_v<const decltype(__r)&, std::string_view>) {
+                        const std::string_view __sv = __r;
+                        __append(std::as_bytes(std::span<const char>{__sv.data(), __sv.size()}));
+                    } else {
+                        __append(std::span<const std::byte>{__r});
+                    }
+                }
+                if (__options_.sync != sync_policy::none) flush();
+            }
+
+            void pop();
+            void flush();
+
+            memory_footprint memory_usage() const noexcept;
+
+        private:
+            struct __segment {
+                std::uint64_t __id_;            //!< segment number, in the file name and header
+                mapped_region __map_;           //!< mapping of the whole segment file
+
+                std::byte* __base() const noexcept { return __map_.data(); }
+            };
+
+            static constexpr std::uint64_t __segment_magic = 0x3147455351415344ull;    //!< "DSAQSEG1"
+            static constexpr size_type __segment_header = 16;
+            static constexpr size_type __record_header = 8;
+            static constexpr std::uint32_t __end_of_segment = 0xFFFFFFFFu;
+            static constexpr size_type __head_file_bytes = 64;
+            static constexpr size_type __page = 4096;
+
+            std::filesystem::path __dir_;
+            mmap_queue_options __options_;
+            deque<__segment> __segments_;       //!< live segments, the head's first and the tail's last
+            size_type __head_off_ = __segment_header;   //!< offset of the first record in the first segment
+            size_type __tail_off_ = __segment_header;   //!< offset of the next record in the last segment
+            size_type __count_ = 0;             //!< number of records
+            size_type __payload_ = 0;           //!< bytes of the records' payloads
+            mapped_region __head_;              //!< mapping of the head file
+            std::uint64_t __head_seq_ = 0;      //!< sequence number of the newest head slot
+            std::uint64_t __sync_id_ = 0;       //!< first segment with writes not yet synced
+            size_type __sync_off_ = 0;          //!< offset of those writes in it
+
+            static std::uint32_t __load32(const std::byte* __p) noexcept {
+                std::uint32_t __v;
+                std::memcpy(&__v, __p, 4);
+                return __v;
+            }
+            static std::uint64_t __load64(const std::byte* __p) noexcept {
+                std::uint64_t __v;
+                std::memcpy(&__v, __p, 8);
+                return __v;
+            }
+            static void __store32(std::byte* __p, std::uint32_t __v) noexcept { std::memcpy(__p, &__v, 4); }
+            static void __store64(std::byte* __p, std::uint64_t __v) noexcept { std::memcpy(__p, &__v, 8); }
+            static size_type __record_bytes(size_type __payload) noexcept { return (__record_header + __payload + 7) & ~size_type{7}; }
+
+            [[noreturn]] static void __throw_errno(const char* __what) {
+                throw std::system_error(errno, std::generic_category(), __what);
+            }
+
+            std::filesystem::path __segment_path(std::uint64_t __id) const {
+                char __name[40];
+                std::snprintf(__name, sizeof(__name), "segment-%020llu.dat", static_cast<unsigned long long>(__id));
+                return __dir_ / __name;
+            }
+
+            void __sync_directory() const;
+            void __append(std::span<const std::byte> __record);
+            void __add_segment(std::uint64_t __id);
+            void __drop_front_segment();
+            void __store_head();
+            const std::byte* __valid_record(const std::byte* __base, size_type __off) const noexcept;
+            void __recover();
+    };
+
+    /** @brief the durable queue with checked preconditions */
+    using mmap_queue = basic_mmap_queue<>;
+}   /* namespace dsa */
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Open the queue stored in __dir, creating the directory if needed, and recover its
+**      head and tail
+**
+** @param [in]
+**      __dir: directory holding the segment files and the head file
+**
+** @param [in]
+**      __options: segment size and sync policy; the segment size must match the one the
+**      directory was written with
+**
+** @note
+**       Throws std::system_error on an I/O failure and std::invalid_argument for a segment
+**       size that is not a multiple of 4096. Complexity: O(size of the live records)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Policy>
+dsa::basic_mmap_queue<_Policy>::basic_mmap_queue(std::filesystem::path __dir, mmap_queue_options __options)
+    : __dir_{std::move(__dir)}, __options_{__options} {
+    if (__options_.segment_bytes % __page != 0 || __options_.segment_bytes < __page)
+        throw std::invalid_argument("mmap_queue: segment size must be a multiple of 4096");
+    std::filesystem::create_directories(__dir_);
+    __head_ = mapped_region::open_file(__dir_ / "head", __head_file_bytes);
+    __recover();                            /* on failure the members unmap what was mapped */
+}
+
+template <class _Policy>
+void dsa::basic_mmap_queue<_Policy>::__sync_directory() const {
+    const int __fd = ::open(__dir_.c_str(), O_RDONLY | O_DIRECTORY);
+    if (__fd < 0) __throw_errno("mmap_queue: open directory");
+    ::fsync(__fd);
+    ::close(__fd);
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Return the record at __off of a segment if it is complete and its checksum matches
+**
+** @return
+**       pointer to the record, nullptr at the end of the data, on a torn record or on the
+**       end-of-segment marker
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Policy>
+const std::byte* dsa::basic_mmap_queue<_Policy>::__valid_record(const std::byte* __base, size_type __off) const noexcept {
+    if (__off + __record_header > __options_.segment_bytes) return nullptr;
+    const std::byte* __r = __base + __off;
+    const std::uint32_t __len = __load32(__r);
+    if (__len == 0 || __len == __end_of_segment) return nullptr;
+    if (__off + __record_bytes(__len - 1) > __options_.segment_bytes) return nullptr;
+    const std::uint32_t __crc = crc32(__r + __record_header, __len - 1, crc32(__r, 4));
+    return __crc == __load32(__r + 4) ? __r : nullptr;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Rebuild head, tail and count from the files of the directory
+**
+** @note
+**       Segments before the head's are leftovers of an interrupted pop and are deleted, as
+**       are segments after the one where the scan stops. A missing head segment was deleted
+**       by a pop whose head update was lost; the scan then starts at the next segment. The bytes after the tail are
+**       zeroed, so a torn record cannot reappear once new records are written over it.
+**       Complexity: O(size of the live records)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Policy>
+void dsa::basic_mmap_queue<_Policy>::__recover() {
+    /* Newest valid head slot */
+    bool __have_head = false;
+    std::uint64_t __head_id = 0;
+    for (size_type __slot = 0; __slot < 2; ++__slot) {
+        const std::byte* __h = __head_.data() + 32 * __slot;
+        if (crc32(__h, 24) != __load32(__h + 24)) continue;
+        const std::uint64_t __seq = __load64(__h);
+        if (__seq == 0 || (__have_head && __seq <= __head_seq_)) continue;
+        __have_head = true;
+        __head_seq_ = __seq;
+        __head_id = __load64(__h + 8);
+        __head_off_ = __load64(__h + 16);
+    }
+
+    std::vector<std::uint64_t> __ids;
+    for (const auto& __entry : std::filesystem::directory_iterator(__dir_)) {
+        unsigned long long __id;
+        char __tail;
+        if (std::sscanf(__entry.path().filename().c_str(), "segment-%20llu.da%c", &__id, &__tail) == 2 && __tail == 't')
+            __ids.push_back(__id);
+    }
+    std::sort(__ids.begin(), __ids.end());
+
+    /* The head's segment can be gone when its unlink reached the disk before the head did:
+     * every record in it was popped, so the queue starts at the next segment left */
+    if (__have_head && !std::binary_search(__ids.begin(), __ids.end(), __head_id)) {
+        auto __next = std::upper_bound(__ids.begin(), __ids.end(), __head_id);
+        if (__next != __ids.end()) {
+            __head_id = *__next;
+            __head_off_ = __segment_header;
+        }
+    }
+
+    std::uint64_t __expected = __have_head ? __head_id : (__ids.empty() ? 0 : __ids.front());
+    if (!__have_head) __head_off_ = __segment_header;
+    bool __broken = false;
+    for (std::uint64_t __id : __ids) {
+        if (__id < __expected || __broken) {
+            std::filesystem::remove(__segment_path(__id));
+            continue;
+        }
+        mapped_region __map;
+        if (__id == __expected) __map = mapped_region::open_file(__segment_path(__id), __options_.segment_bytes, false);
+        if (__map.data() == nullptr || __load64(__map.data()) != __segment_magic || __load64(__map.data() + 8) != __id) {
+            __map = mapped_region{};
+            std::filesystem::remove(__segment_path(__id));
+            __broken = true;
+            continue;
+        }
+        __segments_.push_back(__segment{__id, std::move(__map)});
+        ++__expected;
+    }
+    if (__segments_.empty()) {
+        /* A new queue, or the head's segment is gone and nothing after it is reachable */
+        __add_segment(__have_head ? __head_id : 0);
+        __head_off_ = __tail_off_ = __segment_header;
+        __store_head();
+        return;
+    }
+
+    /* Walk the records from the head */
+    size_type __seg = 0;
+    size_type __off = __head_off_;
+    for (;;) {
+        const std::byte* __base = __segments_[__seg].__base();
+        if (const std::byte* __r = __valid_record(__base, __off)) {
+            const size_type __len = __load32(__r) - 1;
+            ++__count_;
+            __payload_ += __len;
+            __off += __record_bytes(__len);
+            continue;
+        }
+        const bool __rollover = __off >= __options_.segment_bytes || __load32(__base + __off) == __end_of_segment;
+        if (!__rollover || __seg + 1 == __segments_.size()) break;
+        ++__seg;
+        __off = __segment_header;
+    }
+    while (__segments_.size() > __seg + 1) {
+        const std::uint64_t __id = __segments_.back().__id_;
+        __segments_.pop_back();
+        std::filesystem::remove(__segment_path(__id));
+    }
+    __tail_off_ = std::min(__off, __options_.segment_bytes);
+
+    /* Leave segments whose records were all popped before the restart */
+    while (__segments_.size() > 1 && (__head_off_ + 4 > __options_.segment_bytes ||
+                                      __load32(__segments_.front().__base() + __head_off_) == __end_of_segment)) {
+        __head_off_ = __segment_header;
+        __drop_front_segment();
+    }
+
+    /* Erase what lies past the tail, a page at a time, skipping pages that are already zero */
+    std::byte* __base = __segments_.back().__base();
+    for (size_type __p = __tail_off_; __p < __options_.segment_bytes;) {
+        const size_type __end = std::min(__options_.segment_bytes, (__p / __page + 1) * __page);
+        if (std::any_of(__base + __p, __base + __end, [](std::byte __b) { return __b != std::byte{0}; }))
+            std::memset(__base + __p, 0, __end - __p);
+        __p = __end;
+    }
+    __sync_id_ = __segments_.back().__id_;
+    __sync_off_ = __tail_off_;
+}
+
+/* Create, map and initialize segment __id, and make it the tail segment */
+template <class _Policy>
+void dsa::basic_mmap_queue<_Policy>::__add_segment(std::uint64_t __id) {
+    mapped_region __map = mapped_region::open_file(__segment_path(__id), __options_.segment_bytes);
+    std::byte* __base = __map.data();
+    __store64(__base, __segment_magic);
+    __store64(__base + 8, __id);
+    __segments_.push_back(__segment{__id, std::move(__map)});
+    __tail_off_ = __segment_header;
+    if (__options_.sync != sync_policy::none) {
+        ::msync(__base, __page, MS_SYNC);
+        __sync_directory();
+    }
+}
+
+/* Unmap and delete the first segment once __head_off_ points into the next one. The new head
+ * is stored, and synced unless the policy is none, before the file goes. */
+template <class _Policy>
+void dsa::basic_mmap_queue<_Policy>::__drop_front_segment() {
+    const std::uint64_t __id = __segments_.front().__id_;
+    __segments_.pop_front();
+    __store_head();
+    if (__options_.sync != sync_policy::none) __head_.flush();
+    std::filesystem::remove(__segment_path(__id));
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Write the head position to the older of the two head slots
+**
+** @note
+**       A torn slot fails its checksum and recovery falls back to the other one.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Policy>
+void dsa::basic_mmap_queue<_Policy>::__store_head() {
+    ++__head_seq_;
+    std::byte* __h = __head_.data() + 32 * (__head_seq_ % 2);
+    __store64(__h, __head_seq_);
+    __store64(__h + 8, __segments_.front().__id_);
+    __store64(__h + 16, __head_off_);
+    __store32(__h + 24, crc32(__h, 24));
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Write one record at the tail, rolling over to a new segment when it does not fit
+**
+** @note
+**       Throws std::length_error for a record longer than max_record_size().
+**       Complexity: O(record size)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Policy>
+void dsa::basic_mmap_queue<_Policy>::__append(std::span<const std::byte> __record) {
+    if (__record.size() > max_record_size()) throw std::length_error("mmap_queue: record larger than a segment");
+    const size_type __bytes = __record_bytes(__record.size());
+    if (__tail_off_ + __bytes > __options_.segment_bytes) {
+        std::byte* __old = __segments_.back().__base();
+        const size_type __old_off = __tail_off_;
+        __add_segment(__segments_.back().__id_ + 1);
+        if (__old_off + 4 <= __options_.segment_bytes) __store32(__old + __old_off, __end_of_segment);
+        if (__count_ == 0) {
+            /* Nothing left to read in the old segment */
+            __head_off_ = __segment_header;
+            __drop_front_segment();
+        }
+    }
+
+    std::byte* __r = __segments_.back().__base() + __tail_off_;
+    const std::uint32_t __len = static_cast<std::uint32_t>(__record.size() + 1);
+    if (!__record.empty()) std::memcpy(__r + __record_header, __record.data(), __record.size());
+    __store32(__r + 4, crc32(__record.data(), __record.size(), crc32(&__len, 4)));
+    __store32(__r, __len);
+    __tail_off_ += __bytes;
+    ++__count_;
+    __payload_ += __record.size();
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Remove the first record. A segment is deleted when the head leaves it.
+**
+** @note
+**       The new head is written to the head file, and synced with sync_policy::every_push.
+**       When the head leaves a segment it is synced under any policy but none before the
+**       segment file is deleted.
+**       Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Policy>
+void dsa::basic_mmap_queue<_Policy>::pop() {
+    _Policy::require(__count_ != 0, "Empty queue");
+    const std::byte* __base = __segments_.front().__base();
+    const size_type __len = __load32(__base + __head_off_) - 1;
+    __head_off_ += __record_bytes(__len);
+    --__count_;
+    __payload_ -= __len;
+
+    const bool __leave = __segments_.size() > 1 &&
+        (__head_off_ + 4 > __options_.segment_bytes || __load32(__base + __head_off_) == __end_of_segment);
+    if (__leave) {
+        __head_off_ = __segment_header;
+        __drop_front_segment();     /* the head names the next segment before the old one goes */
+        return;
+    }
+    __store_head();
+    if (__options_.sync == sync_policy::every_push) __head_.flush();
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Force the records written since the last flush, and the head, to stable storage
+**
+** @note
+**       Syncs only the pages written since the previous flush. Throws std::system_error if
+**       msync fails.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Policy>
+void dsa::basic_mmap_queue<_Policy>::flush() {
+    for (const __segment& __s : __segments_) {
+        if (__s.__id_ < __sync_id_) continue;
+        const size_type __from = __s.__id_ == __sync_id_ ? __sync_off_ / __page * __page : 0;
+        const size_type __to = __s.__id_ == __segments_.back().__id_ ? __tail_off_ : __options_.segment_bytes;
+        if (__to > __from && ::msync(__s.__base() + __from, __to - __from, MS_SYNC) != 0) __throw_errno("mmap_queue: msync");
+    }
+    __head_.flush();
+    __sync_id_ = __segments_.back().__id_;
+    __sync_off_ = __tail_off_;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Report the memory held by the queue
+**
+** @return
+**       payload of the live records; the mapped segments and head file as overhead; the
+**       segment index as a heap block
+**
+** @note
+**       The mappings are file-backed page cache, not heap: they count toward total() but
+**       not toward allocations. Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Policy>
+dsa::memory_footprint dsa::basic_mmap_queue<_Policy>::memory_usage() const noexcept {
+    memory_footprint __m = __segments_.memory_usage();
+    __m.overhead_bytes += __m.payload_bytes + sizeof(*this) - sizeof(__segments_);
+    __m.payload_bytes = __payload_;
+    __m.overhead_bytes += __segments_.size() * __options_.segment_bytes + __head_file_bytes - __payload_;
+    return __m;
+}
+#endif /* MMAP_QUEUE_H */
@@ -0,0 +1,299 @@
+/**
+ * @file    OffsetList.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A doubly linked list with self-relative links, for file mappings and shared memory
+*/
+
+#ifndef OFFSET_LIST_H
+#define OFFSET_LIST_H
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "ErrorPolicy.h"
+#include "MemoryUsage.h"
+#include "OffsetPtr.h"
+#include "SegmentArena.h"
+
+namespace dsa {
+    /** @brief links of an offset_list node and of its sentinel */
+    struct __offset_node_base {
+        offset_ptr<__offset_node_base> __prev_;     //!< previous node
+        offset_ptr<__offset_node_base> __next_;     //!< next node
+    };
+
+    /** @brief node of an offset_list */
+    template <class _Tp>
+    struct __offset_node : __offset_node_base {
+        _Tp __value_;                               //!< stored value
+    };
+
+    /** @brief bidirectional iterator of offset_list, valid in the process that created it */
+    template <class _Tp, bool _Const>
+    class __offset_list_iterator {
+            template <class, class> friend class offset_list;
+            friend class __offset_list_iterator<_Tp, !_Const>;
+
+            __offset_node_base* __ptr_ = nullptr;
+
+            explicit __offset_list_iterator(const __offset_node_base* __p) noexcept
+                : __ptr_{const_cast<__offset_node_base*>(__p)} {}
+
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;                  //!< iterator_category
+            using value_type = _Tp;                                                     //!< value_type
+            using difference_type = std::ptrdiff_t;                                     //!< difference_type
+            using reference = std::conditional_t<_Const, const _Tp&, _Tp&>;             //!< reference
+            using pointer = std::conditional_t<_Const, const _Tp*, _Tp*>;               //!< pointer
+
+            __offset_list_iterator() noexcept = default;
+
+            /** @brief convert an iterator to a constant iterator */
+            template <bool _C = _Const>
+                requires _C
+            __offset_list_iterator(const __offset_list_iterator<_Tp, false>& __x) noexcept : __ptr_{__x.__ptr_} {}
+
+            reference operator*() const noexcept { return static_cast<__offset_node<_Tp>*>(__ptr_)->__value_; }
+            pointer operator->() const noexcept { return &**this; }
+
+            __offset_list_iterator& operator++() noexcept { __ptr_ = __ptr_->__next_.get(); return *this; }
+            __offset_list_iterator operator++(int) noexcept { auto __t = *this; ++*this; return __t; }
+            __offset_list_iterator& operator--() noexcept { __ptr_ = __ptr_->__prev_.get(); return *this; }
+            __offset_list_iterator operator--(int) noexcept { auto __t = *this; --*this; return __t; }
+
+            friend bool operator==(const __offset_list_iterator& __x, const __offset_list_iterator& __y) noexcept {
+                return __x.__ptr_ == __y.__ptr_;
+            }
+    };
+
+    /**
+     * @brief offset_list is a doubly linked list whose nodes and links live in a
+     *      segment_arena. Links are offset_ptr, so the list can be built once into a
+     *      mapped file and later mapped at any address with no deserialization, or shared by
+     *      processes that map the same memory at different addresses.
+     *
+     * The list object itself must be placed in the arena, usually with
+     * arena.construct<offset_list<T>>(arena), and is found again after mapping through
+     * segment_arena::root().
+     *
+     * @tparam
+     *      _Tp the type of stored element; trivially copyable, since a value holding an
+     *      ordinary pointer would be meaningless in another mapping
+     * @tparam
+     *      _Policy what front/back/pop on an empty list do, see ErrorPolicy.h
+     *
+     * @note
+     *      Iterators hold addresses of the current mapping and do not survive remapping.
+     *      Operations are not synchronized; processes sharing a list hold the arena's lock()
+     *      around them. A producer pushing at the back and a consumer popping at the front make
+     *      an inter-process queue.
+    */
+    template <class _Tp, class _Policy = checked_policy>
+    class offset_list {
+            static_assert(std::is_trivially_copyable_v<_Tp>, "offset_list: element type must be trivially copyable");
+            static_assert(dsa::error_policy<_Policy>, "offset_list: _Policy must model dsa::error_policy");
+
+        public:
+            using value_type = _Tp;                                             //!< value_type
+            using size_type = std::size_t;                                      //!< size_type
+            using reference = _Tp&;                                             //!< reference
+            using const_reference = const _Tp&;                                 //!< const_reference
+            using iterator = __offset_list_iterator<_Tp, false>;                //!< iterator type
+            using const_iterator = __offset_list_iterator<_Tp, true>;           //!< const_iterator type
+            using error_policy = _Policy;                                       //!< error_policy
+
+            /**
+             * @brief construct an empty list allocating from __arena
+             *
+             * @note
+             *      Throws std::invalid_argument if this object is not inside __arena.
+             */
+            explicit offset_list(segment_arena __arena) : __arena_{static_cast<__arena_header*>(__arena.base())} {
+                if (!__arena.contains(this)) throw std::invalid_argument("offset_list: the list must live in its arena");
+                __end_.__prev_ = &__end_;
+                __end_.__next_ = &__end_;
+            }
+
+            offset_list(const offset_list&) = delete;
+            offset_list& operator=(const offset_list&) = delete;
+
+            /** @brief destructor, returns every node to the arena */
+            ~offset_list() { clear(); }
+
+            /** @brief return the arena the nodes are allocated from */
+            segment_arena arena() const noexcept { return segment_arena{__arena_.get()}; }
+
+            /** @brief return the number of elements */
+            size_type size() const noexcept { return __size_; }
+
+            /** @brief check whether the list is empty */
+            bool empty() const noexcept { return __size_ == 0; }
+
+            /** @brief return an iterator to the first element */
+            iterator begin() noexcept { return iterator{__end_.__next_.get()}; }
+
+            /** @brief return an iterator past the last element */
+            iterator end() noexcept { return iterator{&__end_}; }
+
+            /** @brief return a constant iterator to the first element */
+            const_iterator begin() const noexcept { return const_iterator{__end_.__next_.get()}; }
+
+            /** @brief return a constant iterator past the last element */
+            const_iterator end() const noexcept { return const_iterator{&__end_}; }
+
+            /** @brief return a reference to the first element */
+            reference front() noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "List is empty");
+                return *begin();
+            }
+
+            /** @brief return a constant reference to the first element */
+            const_reference front() const noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "List is empty");
+                return *begin();
+            }
+
+            /** @brief return a reference to the last element */
+            reference back() noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "List is empty");
+                return *std::prev(end());
+            }
+
+            /** @brief return a constant reference to the last element */
+            const_reference back() const noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "List is empty");
+                return *std::prev(end());
+            }
+
+            /** @brief append a copy of __x */
+            void push_back(const _Tp& __x) { emplace(end(), __x); }
+
+            /** @brief prepend a copy of __x */
+            void push_front(const _Tp& __x) { emplace(begin(), __x); }
+
+            /** @brief construct an element at the back from __args */
+            template <class... _Args>
+            reference emplace_back(_Args&&... __args) { return *emplace(end(), std::forward<_Args>(__args)...); }
+
+            /** @brief construct an element at the front from __args */
+            template <class... _Args>
+            reference emplace_front(_Args&&... __args) { return *emplace(begin(), std::forward<_Args>(__args)...); }
+
+            template <class... _Args>
+            iterator emplace(const_iterator __pos, _Args&&... __args);
+
+            /** @brief remove the last element */
+            void pop_back() noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "List is empty");
+                __erase_node(__end_.__prev_.get());
+            }
+
+            /** @brief remove the first element */
+            void pop_front() noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "List is empty");
+                __erase_node(__end_.__next_.get());
+            }
+
+            /** @brief remove and return the first element, std::nullopt if the list is empty */
+            std::optional<_Tp> try_pop_front() noexcept {
+                if (__size_ == 0) return std::nullopt;
+                std::optional<_Tp> __v{*begin()};
+                __erase_node(__end_.__next_.get());
+                return __v;
+            }
+
+            /** @brief remove the element at __pos and return an iterator to the next one */
+            iterator erase(const_iterator __pos) noexcept {
+                __offset_node_base* __next = __pos.__ptr_->__next_.get();
+                __erase_node(__pos.__ptr_);
+                return iterator{__next};
+            }
+
+            /** @brief remove every element */
+            void clear() noexcept {
+                while (__size_ != 0) __erase_node(__end_.__next_.get());
+            }
+
+            memory_footprint memory_usage() const noexcept;
+
+        private:
+            using __node = __offset_node<_Tp>;
+
+            offset_ptr<__arena_header> __arena_;    //!< arena the nodes come from
+            __offset_node_base __end_;              //!< sentinel, prev is the last node and next the first
+            size_type __size_ = 0;                  //!< number of elements
+
+            void __erase_node(__offset_node_base* __p) noexcept {
+                __p->__prev_->__next_ = __p->__next_;
+                __p->__next_->__prev_ = __p->__prev_;
+                --__size_;
+                arena().destroy(static_cast<__node*>(__p));
+            }
+    };
+}   /* namespace dsa */
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Construct an element from __args in a node allocated from the arena and link it
+**      before __pos
+**
+** @param [in]
+**      __pos: iterator before which the element is inserted
+**
+** @return
+**       iterator to the new element
+**
+** @note
+**       Throws std::bad_alloc when the arena is full; the list is then unchanged.
+**       Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+template <class... _Args>
+typename dsa::offset_list<_Tp, _Policy>::iterator
+dsa::offset_list<_Tp, _Policy>::emplace(const_iterator __pos, _Args&&... __args) {
+    __node* __n = arena().template construct<__node>(__offset_node_base{}, _Tp(std::forward<_Args>(__args)...));
+    __offset_node_base* __next = __pos.__ptr_;
+    __n->__prev_ = __next->__prev_;
+    __n->__next_ = __next;
+    __next->__prev_->__next_ = __n;
+    __next->__prev_ = __n;
+    ++__size_;
+    return iterator{__n};
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Return the memory held by the list
+**
+** @return
+**       payload, links and sentinel as overhead, and the arena's rounding of each node to
+**       16 bytes as slack; no heap allocations
+**
+** @note
+**       Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+dsa::memory_footprint dsa::offset_list<_Tp, _Policy>::memory_usage() const noexcept {
+    constexpr size_type __a = segment_arena::alignment;
+    memory_footprint __f;
+    __f.payload_bytes = __size_ * sizeof(_Tp);
+    __f.overhead_bytes = sizeof(*this) + __size_ * (sizeof(__node) - sizeof(_Tp));
+    __f.slack_bytes = __size_ * (((sizeof(__node) + __a - 1) & ~(__a - 1)) - sizeof(__node));
+    return __f;
+}
+
+#endif /* OFFSET_LIST_H */
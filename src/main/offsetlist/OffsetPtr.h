@@ -0,0 +1,107 @@
+/**
+ * @file    OffsetPtr.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A pointer stored as the distance from itself, valid wherever its memory is mapped
+*/
+
+#ifndef OFFSET_PTR_H
+#define OFFSET_PTR_H
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace dsa {
+    /**
+     * @brief offset_ptr holds the address of its target as an offset from its own address.
+     *      A structure linked with offset_ptr keeps working when its bytes are copied or
+     *      mapped at another address, as long as the pointer and its target move together,
+     *      e.g. both inside one segment_arena.
+     *
+     * @tparam
+     *      _Tp the pointed-to type
+     *
+     * @note
+     *      Copying an offset_ptr recomputes the offset for the destination, so the type is
+     *      not trivially copyable. The offset 1 encodes nullptr, as in Boost.Interprocess.
+    */
+    template <class _Tp>
+    class offset_ptr {
+        public:
+            using element_type = _Tp;                           //!< element_type
+            using pointer = _Tp*;                               //!< pointer
+            using difference_type = std::ptrdiff_t;             //!< difference_type
+
+            /** @brief construct a null pointer */
+            offset_ptr() noexcept = default;
+
+            /** @brief construct a null pointer */
+            offset_ptr(std::nullptr_t) noexcept {}
+
+            /** @brief point to __p */
+            offset_ptr(_Tp* __p) noexcept : __off_{__offset_to(__p)} {}
+
+            /** @brief point to the target of __x, relative to this object's address */
+            offset_ptr(const offset_ptr& __x) noexcept : __off_{__offset_to(__x.get())} {}
+
+            /** @brief converting constructor */
+            template <class _Up>
+                requires std::convertible_to<_Up*, _Tp*>
+            offset_ptr(const offset_ptr<_Up>& __x) noexcept : __off_{__offset_to(__x.get())} {}
+
+            /** @brief copy assignment operator */
+            offset_ptr& operator=(const offset_ptr& __x) noexcept {
+                __off_ = __offset_to(__x.get());
+                return *this;
+            }
+
+            /** @brief point to __p */
+            offset_ptr& operator=(_Tp* __p) noexcept {
+                __off_ = __offset_to(__p);
+                return *this;
+            }
+
+            /** @brief return the target address in this mapping */
+            _Tp* get() const noexcept {
+                if (__off_ == __null_offset) return nullptr;
+                return reinterpret_cast<_Tp*>(const_cast<char*>(reinterpret_cast<const char*>(this)) + __off_);
+            }
+
+            /** @brief dereference */
+            std::add_lvalue_reference_t<_Tp> operator*() const noexcept
+                requires (!std::is_void_v<_Tp>)
+            { return *get(); }
+
+            /** @brief member access */
+            _Tp* operator->() const noexcept { return get(); }
+
+            /** @brief check whether the pointer is not null */
+            explicit operator bool() const noexcept { return __off_ != __null_offset; }
+
+            /** @brief compare the targets */
+            friend bool operator==(const offset_ptr& __x, const offset_ptr& __y) noexcept { return __x.get() == __y.get(); }
+
+            /** @brief compare the target with __p */
+            friend bool operator==(const offset_ptr& __x, const _Tp* __p) noexcept { return __x.get() == __p; }
+
+            /** @brief order the targets */
+            friend std::strong_ordering operator<=>(const offset_ptr& __x, const offset_ptr& __y) noexcept {
+                return std::compare_three_way{}(__x.get(), __y.get());
+            }
+
+        private:
+            static constexpr std::ptrdiff_t __null_offset = 1;
+            std::ptrdiff_t __off_ = __null_offset;     //!< target address minus this object's address
+
+            std::ptrdiff_t __offset_to(const _Tp* __p) const noexcept {
+                if (__p == nullptr) return __null_offset;
+                return reinterpret_cast<const char*>(__p) - reinterpret_cast<const char*>(this);
+            }
+    };
+}   /* namespace dsa */
+
+#endif /* OFFSET_PTR_H */
@@ -0,0 +1,248 @@
+/**
+ * @file    SegmentArena.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   An allocator whose whole state lives inside the byte range it manages
+*/
+
+#ifndef SEGMENT_ARENA_H
+#define SEGMENT_ARENA_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "MemoryUsage.h"
+
+namespace dsa {
+    template <class, class> class offset_list;
+
+    /** @brief bookkeeping at the start of an arena; every position is an offset from it */
+    struct __arena_header {
+        static constexpr std::uint64_t __magic = 0x414E455241415344ull;  // "DSAARENA"
+        static constexpr std::uint32_t __version = 1;
+        static constexpr std::size_t __granule = 16;
+        static constexpr std::size_t __classes = 64;                     // free lists for 16 .. 1024 bytes
+
+        std::uint64_t __magic_;                 //!< __magic once formatted
+        std::uint32_t __version_;               //!< layout version
+        std::atomic<std::uint32_t> __lock_;     //!< spin lock, see segment_arena::lock()
+        std::uint64_t __size_;                  //!< bytes in the arena, header included
+        std::uint64_t __used_;                  //!< offset of the first never-allocated byte
+        std::uint64_t __live_;                  //!< bytes in allocated blocks
+        std::uint64_t __root_;                  //!< offset of the root object, 0 for none
+        std::uint64_t __free_[__classes];       //!< offset of the first free block per size class
+    };
+
+    /**
+     * @brief segment_arena hands out blocks of a caller-provided byte range, such as a
+     *      mapped_region. Its free lists, its root object and its lock are stored in the range
+     *      as offsets, so the arena and everything built in it with offset_ptr links can be
+     *      mapped at another address, by another process or after a restart, and used as is.
+     *
+     * Blocks are rounded up to 16 bytes and aligned to 16. Freed blocks of up to 1024 bytes
+     * go to a free list per size and are reused for the next block of that size; larger
+     * blocks are not reused.
+     *
+     * @note
+     *      segment_arena is a handle: copies refer to the same arena. allocate() and
+     *      deallocate() are not synchronized; when several processes share the arena they
+     *      must hold lock() around every change to it and to the containers in it.
+    */
+    class segment_arena {
+        public:
+            using size_type = std::size_t;                                  //!< size_type
+
+            static constexpr size_type alignment = __arena_header::__granule;   //!< alignment of every block
+
+            /**
+             * @brief format __bytes at __base as an empty arena
+             *
+             * @note
+             *      Throws std::invalid_argument if __base is not 16-byte aligned or the range
+             *      cannot hold the header.
+             */
+            static segment_arena create(void* __base, size_type __bytes);
+
+            /**
+             * @brief open the arena formatted at __base by create(), possibly at another address
+             *
+             * @note
+             *      Throws std::runtime_error if the range holds no arena or one of another size.
+             */
+            static segment_arena attach(void* __base, size_type __bytes);
+
+            /**
+             * @brief return a block of at least __bytes bytes
+             *
+             * @note
+             *      Throws std::bad_alloc when the arena is full. Complexity: O(1)
+             */
+            void* allocate(size_type __bytes);
+
+            /** @brief return the block __p of __bytes bytes obtained from allocate() */
+            void deallocate(void* __p, size_type __bytes) noexcept;
+
+            /** @brief allocate a _Tp in the arena and construct it from __args */
+            template <class _Tp, class... _Args>
+            _Tp* construct(_Args&&... __args) {
+                static_assert(alignof(_Tp) <= alignment, "segment_arena: over-aligned type");
+                void* __p = allocate(sizeof(_Tp));
+                try {
+                    return ::new (__p) _Tp(std::forward<_Args>(__args)...);
+                } catch (...) {
+                    deallocate(__p, sizeof(_Tp));
+                    throw;
+                }
+            }
+
+            /** @brief destroy and deallocate an object made by construct() */
+            template <class _Tp>
+            void destroy(_Tp* __p) noexcept {
+                __p->~_Tp();
+                deallocate(__p, sizeof(_Tp));
+            }
+
+            /** @brief remember __p, an object in the arena or nullptr, as the root object */
+            void set_root(const void* __p) noexcept { __h_->__root_ = __p == nullptr ? 0 : __offset(__p); }
+
+            /** @brief return the root object, nullptr if none was set */
+            template <class _Tp>
+            _Tp* root() const noexcept { return __h_->__root_ == 0 ? nullptr : static_cast<_Tp*>(__at(__h_->__root_)); }
+
+            /** @brief check whether __p points into the arena */
+            bool contains(const void* __p) const noexcept {
+                const std::byte* __b = reinterpret_cast<const std::byte*>(__h_);
+                return __b <= static_cast<const std::byte*>(__p) && static_cast<const std::byte*>(__p) < __b + __h_->__size_;
+            }
+
+            /** @brief return the first byte of the arena */
+            void* base() const noexcept { return __h_; }
+
+            /** @brief return the bytes in the arena, header included */
+            size_type capacity() const noexcept { return __h_->__size_; }
+
+            /** @brief return the bytes handed out at least once, header included */
+            size_type used() const noexcept { return __h_->__used_; }
+
+            /** @brief return the bytes in allocated blocks */
+            size_type live() const noexcept { return __h_->__live_; }
+
+            /** @brief acquire the arena lock, spinning; works across processes */
+            void lock() noexcept {
+                while (!try_lock()) std::this_thread::yield();
+            }
+
+            /** @brief try to acquire the arena lock */
+            bool try_lock() noexcept {
+                std::uint32_t __expected = 0;
+                return __h_->__lock_.compare_exchange_strong(__expected, 1, std::memory_order_acquire, std::memory_order_relaxed);
+            }
+
+            /** @brief release the arena lock */
+            void unlock() noexcept { __h_->__lock_.store(0, std::memory_order_release); }
+
+            /** @brief return how the arena's bytes are spent; it owns no heap memory */
+            memory_footprint memory_usage() const noexcept {
+                memory_footprint __f;
+                __f.payload_bytes = __h_->__live_;
+                __f.overhead_bytes = __h_->__size_ - __h_->__live_;
+                return __f;
+            }
+
+        private:
+            template <class, class> friend class offset_list;
+
+            static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "the arena lock must be address-free");
+
+            static constexpr size_type __header_bytes = (sizeof(__arena_header) + alignment - 1) & ~(alignment - 1);
+
+            __arena_header* __h_;               //!< header at the start of the arena
+
+            explicit segment_arena(__arena_header* __h) noexcept : __h_{__h} {}
+
+            static size_type __round(size_type __bytes) noexcept {
+                return __bytes == 0 ? alignment : (__bytes + alignment - 1) & ~(alignment - 1);
+            }
+
+            void* __at(std::uint64_t __off) const noexcept { return reinterpret_cast<std::byte*>(__h_) + __off; }
+
+            std::uint64_t __offset(const void* __p) const noexcept {
+                return static_cast<std::uint64_t>(static_cast<const std::byte*>(__p) - reinterpret_cast<const std::byte*>(__h_));
+            }
+    };
+}   /* namespace dsa */
+
+inline dsa::segment_arena dsa::segment_arena::create(void* __base, size_type __bytes) {
+    if (reinterpret_cast<std::uintptr_t>(__base) % alignment != 0)
+        throw std::invalid_argument("segment_arena: base must be 16-byte aligned");
+    if (__bytes < __header_bytes) throw std::invalid_argument("segment_arena: range too small");
+    std::memset(__base, 0, __header_bytes);
+    __arena_header* __h = static_cast<__arena_header*>(__base);
+    __h->__version_ = __arena_header::__version;
+    __h->__size_ = __bytes;
+    __h->__used_ = __header_bytes;
+    __h->__magic_ = __arena_header::__magic;
+    return segment_arena{__h};
+}
+
+inline dsa::segment_arena dsa::segment_arena::attach(void* __base, size_type __bytes) {
+    __arena_header* __h = static_cast<__arena_header*>(__base);
+    if (reinterpret_cast<std::uintptr_t>(__base) % alignment != 0 || __bytes < __header_bytes
+        || __h->__magic_ != __arena_header::__magic || __h->__version_ != __arena_header::__version)
+        throw std::runtime_error("segment_arena: no arena at this address");
+    if (__h->__size_ != __bytes) throw std::runtime_error("segment_arena: size mismatch");
+    return segment_arena{__h};
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Return a block of at least __bytes bytes, reusing a freed block of the same size class
+**      when there is one
+**
+** @param [in]
+**      __bytes: requested size
+**
+** @return
+**       16-byte aligned block inside the arena
+**
+** @note
+**       Throws std::bad_alloc when the arena is full. Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+inline void* dsa::segment_arena::allocate(size_type __bytes) {
+    const size_type __n = __round(__bytes);
+    const size_type __class = __n / alignment - 1;
+    if (__class < __arena_header::__classes && __h_->__free_[__class] != 0) {
+        void* __p = __at(__h_->__free_[__class]);
+        std::memcpy(&__h_->__free_[__class], __p, sizeof(std::uint64_t));
+        __h_->__live_ += __n;
+        return __p;
+    }
+    if (__n > __h_->__size_ - __h_->__used_) throw std::bad_alloc();
+    void* __p = __at(__h_->__used_);
+    __h_->__used_ += __n;
+    __h_->__live_ += __n;
+    return __p;
+}
+
+/* Push the block on its size-class free list; the link is stored in the block itself */
+inline void dsa::segment_arena::deallocate(void* __p, size_type __bytes) noexcept {
+    const size_type __n = __round(__bytes);
+    const size_type __class = __n / alignment - 1;
+    __h_->__live_ -= __n;
+    if (__class >= __arena_header::__classes) return;
+    std::memcpy(__p, &__h_->__free_[__class], sizeof(std::uint64_t));
+    __h_->__free_[__class] = __offset(__p);
+}
+
+#endif /* SEGMENT_ARENA_H */
@@ -0,0 +1,343 @@
+/**
+ * @file    PersistentList.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   An immutable, structurally shared cons list and the stack built on it
+*/
+
+#ifndef PERSISTENT_LIST_H
+#define PERSISTENT_LIST_H
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "ErrorPolicy.h"
+#include "MemoryUsage.h"
+
+namespace dsa {
+    /**
+     * @brief Cell of a persistent_list, modelled on Node<T> of SinglyLinkedList.h with an
+     *      intrusive reference count. A node owns one reference to __next_.
+    */
+    template <class _Tp>
+    struct __persistent_node {
+        std::atomic<std::size_t> __refs_;       //!< number of lists and nodes pointing here
+        __persistent_node* __next_;             //!< tail, nullptr at the end
+        std::size_t __length_;                  //!< number of nodes from this one to the end
+        _Tp __value_;                           //!< data
+
+        template <class... _Args>
+        __persistent_node(__persistent_node* __next, std::size_t __length, _Args&&... __args)
+            : __refs_{1}, __next_{__next}, __length_{__length}, __value_(std::forward<_Args>(__args)...) {}
+    };
+
+    /**
+     * @brief forward iterator over a persistent_list, always constant
+    */
+    template <class _Tp>
+    class __persistent_list_iterator {
+            const __persistent_node<_Tp>* __ptr_ = nullptr;
+
+        public:
+            using value_type = _Tp;                                     //!< value_type
+            using reference = const _Tp&;                               //!< reference
+            using pointer = const _Tp*;                                 //!< pointer
+            using difference_type = std::ptrdiff_t;                     //!< distance
+            using iterator_category = std::forward_iterator_tag;        //!< category
+
+            __persistent_list_iterator() noexcept = default;
+            explicit __persistent_list_iterator(const __persistent_node<_Tp>* __p) noexcept : __ptr_{__p} {}
+
+            reference operator*() const noexcept { return __ptr_->__value_; }
+            pointer operator->() const noexcept { return std::addressof(__ptr_->__value_); }
+
+            __persistent_list_iterator& operator++() noexcept { __ptr_ = __ptr_->__next_; return *this; }
+            __persistent_list_iterator operator++(int) noexcept { __persistent_list_iterator __t{*this}; ++*this; return __t; }
+
+            friend bool operator==(const __persistent_list_iterator&, const __persistent_list_iterator&) = default;
+    };
+
+    /**
+     * @brief persistent_list is an immutable singly linked list. push_front() and
+     *      pop_front() leave the list unchanged and return a new version that shares its
+     *      tail with the old one, so copying a list (a snapshot) is O(1).
+     *
+     * @tparam
+     *      _Tp the type of stored element
+     * @tparam
+     *      _Policy what front() and pop_front() on an empty list do, see ErrorPolicy.h
+     *
+     * @note
+     *      Nodes are reference counted with atomics and never modified after construction,
+     *      so versions can be read from any number of threads without locks. A single
+     *      persistent_list object is a value like std::shared_ptr: copying it while another
+     *      thread assigns to that same object is a data race. Hand each reader its own copy.
+     *      Releasing the last version of a long list frees the nodes iteratively.
+    */
+    template <class _Tp, class _Policy = checked_policy>
+    class persistent_list {
+        static_assert(dsa::error_policy<_Policy>, "_Policy must be an error policy");
+
+        public:
+            using value_type = _Tp;                                     //!< value_type
+            using size_type = std::size_t;                              //!< size_type
+            using const_reference = const _Tp&;                         //!< const_reference
+            using reference = const_reference;                          //!< elements are never mutable
+            using const_iterator = __persistent_list_iterator<_Tp>;     //!< const_iterator type
+            using iterator = const_iterator;                            //!< iterator type
+            using error_policy = _Policy;                               //!< precondition policy
+
+            /** @brief construct an empty list */
+            persistent_list() noexcept = default;
+
+            /** @brief construct the list with the elements of the range [first, last), in order */
+            template <class _BidirIt>
+                requires std::bidirectional_iterator<_BidirIt>
+            persistent_list(_BidirIt first, _BidirIt last) {
+                while (first != last) *this = push_front(*--last);
+            }
+
+            /** @brief construct the list with the elements of the initializer list */
+            persistent_list(std::initializer_list<_Tp> __il) : persistent_list(__il.begin(), __il.end()) {}
+
+            /** @brief copy constructor, O(1): both lists share every node */
+            persistent_list(const persistent_list& __x) noexcept : __head_{__retain(__x.__head_)} {}
+
+            /** @brief move constructor */
+            persistent_list(persistent_list&& __x) noexcept : __head_{std::exchange(__x.__head_, nullptr)} {}
+
+            /** @brief copy assignment operator, O(1) plus the release of the old version */
+            persistent_list& operator=(const persistent_list& __x) noexcept {
+                __node* __old = std::exchange(__head_, __retain(__x.__head_));
+                __release(__old);
+                return *this;
+            }
+
+            /** @brief move assignment operator */
+            persistent_list& operator=(persistent_list&& __x) noexcept {
+                if (this != &__x) __release(std::exchange(__head_, std::exchange(__x.__head_, nullptr)));
+                return *this;
+            }
+
+            /** @brief default destructor */
+            ~persistent_list() { __release(__head_); }
+
+            /** @brief return the number of elements, O(1) */
+            size_type size() const noexcept { return __head_ == nullptr ? 0 : __head_->__length_; }
+
+            /** @brief check whether the list is empty */
+            bool empty() const noexcept { return __head_ == nullptr; }
+
+            /** @brief return a constant iterator to the first element */
+            const_iterator begin() const noexcept { return const_iterator{__head_}; }
+
+            /** @brief return a constant iterator to the end */
+            const_iterator end() const noexcept { return const_iterator{}; }
+
+            /** @brief return a constant iterator to the first element */
+            const_iterator cbegin() const noexcept { return begin(); }
+
+            /** @brief return a constant iterator to the end */
+            const_iterator cend() const noexcept { return end(); }
+
+            /** @brief return a constant reference to the first element */
+            const_reference front() const noexcept(_Policy::is_nothrow) {
+                _Policy::require(__head_ != nullptr, "Empty list");
+                return __head_->__value_;
+            }
+
+            /**
+             * @brief
+             *      return a new version with __args constructed in front of this one
+             *
+             * @return
+             *      a list that shares every node of *this
+             *
+             * @note
+             *      Complexity: O(1), one allocation
+            */
+            template <class... _Args>
+            [[nodiscard]] persistent_list emplace_front(_Args&&... __args) const {
+                __node_alloc __a;
+                __node* __p = __node_traits::allocate(__a, 1);
+                try {
+                    __node_traits::construct(__a, __p, __head_, size() + 1, std::forward<_Args>(__args)...);
+                } catch (...) {
+                    __node_traits::deallocate(__a, __p, 1);
+                    throw;
+                }
+                __retain(__head_);
+                return persistent_list{__p};
+            }
+
+            /** @brief return a new version with a copy of __x in front, O(1) */
+            [[nodiscard]] persistent_list push_front(const _Tp& __x) const { return emplace_front(__x); }
+
+            /** @brief return a new version with __x in front, O(1) */
+            [[nodiscard]] persistent_list push_front(_Tp&& __x) const { return emplace_front(std::move(__x)); }
+
+            /** @brief return the version without the first element, O(1); see _Policy for an empty list */
+            [[nodiscard]] persistent_list pop_front() const noexcept(_Policy::is_nothrow) {
+                _Policy::require(__head_ != nullptr, "Empty list");
+                return persistent_list{__retain(__head_->__next_)};
+            }
+
+            /** @brief check whether both lists are the same version, O(1) */
+            bool same_version(const persistent_list& __x) const noexcept { return __head_ == __x.__head_; }
+
+            /**
+             * @brief
+             *      compare two lists element by element
+             *
+             * @note
+             *      Stops early at the first shared node, so comparing two versions that share
+             *      a tail only walks the parts in front of it.
+            */
+            friend bool operator==(const persistent_list& __x, const persistent_list& __y) {
+                if (__x.size() != __y.size()) return false;
+                for (const __node *__p = __x.__head_, *__q = __y.__head_; __p != __q; __p = __p->__next_, __q = __q->__next_) {
+                    if (!(__p->__value_ == __q->__value_)) return false;
+                }
+                return true;
+            }
+
+            memory_footprint memory_usage() const noexcept;
+
+        private:
+            using __node = __persistent_node<_Tp>;
+            using __node_alloc = std::allocator<__node>;
+            using __node_traits = std::allocator_traits<__node_alloc>;
+
+            __node* __head_ = nullptr;          //!< first node, owns one reference
+
+            /** @brief adopt a reference to __p */
+            explicit persistent_list(__node* __p) noexcept : __head_{__p} {}
+
+            static __node* __retain(__node* __p) noexcept {
+                if (__p != nullptr) __p->__refs_.fetch_add(1, std::memory_order_relaxed);
+                return __p;
+            }
+
+            static void __release(__node* __p) noexcept;
+    };
+
+    /**
+     * @brief persistent_stack is a LIFO view of a persistent_list: push() and pop() return
+     *      new versions and snapshots are O(1) copies
+     *
+     * @tparam
+     *      _Tp the type of stored element
+     * @tparam
+     *      _Policy what top() and pop() on an empty stack do, see ErrorPolicy.h
+    */
+    template <class _Tp, class _Policy = checked_policy>
+    class persistent_stack {
+        public:
+            using container_type = persistent_list<_Tp, _Policy>;                   //!< container_type
+            using value_type = _Tp;                                                 //!< value_type
+            using size_type = typename container_type::size_type;                   //!< size_type
+            using const_reference = typename container_type::const_reference;       //!< const_reference
+
+            /** @brief construct an empty stack */
+            persistent_stack() noexcept = default;
+
+            /** @brief return the number of elements, O(1) */
+            size_type size() const noexcept { return __c_.size(); }
+
+            /** @brief check whether the stack is empty */
+            bool empty() const noexcept { return __c_.empty(); }
+
+            /** @brief return a constant reference to the top element */
+            const_reference top() const noexcept(_Policy::is_nothrow) { return __c_.front(); }
+
+            /** @brief return a new version with a copy of __x on top, O(1) */
+            [[nodiscard]] persistent_stack push(const _Tp& __x) const { return persistent_stack{__c_.push_front(__x)}; }
+
+            /** @brief return a new version with __x on top, O(1) */
+            [[nodiscard]] persistent_stack push(_Tp&& __x) const { return persistent_stack{__c_.push_front(std::move(__x))}; }
+
+            /** @brief return a new version with an element constructed from __args on top, O(1) */
+            template <class... _Args>
+            [[nodiscard]] persistent_stack emplace(_Args&&... __args) const {
+                return persistent_stack{__c_.emplace_front(std::forward<_Args>(__args)...)};
+            }
+
+            /** @brief return the version without the top element, O(1) */
+            [[nodiscard]] persistent_stack pop() const noexcept(_Policy::is_nothrow) { return persistent_stack{__c_.pop_front()}; }
+
+            /** @brief return the elements as a list, top first */
+            const container_type& as_list() const noexcept { return __c_; }
+
+            /** @brief compare two stacks element by element */
+            friend bool operator==(const persistent_stack& __x, const persistent_stack& __y) { return __x.__c_ == __y.__c_; }
+
+            /** @brief return the memory reachable from this version */
+            memory_footprint memory_usage() const noexcept { return __c_.memory_usage(); }
+
+        private:
+            container_type __c_;                //!< elements, top first
+
+            explicit persistent_stack(container_type __c) noexcept : __c_{std::move(__c)} {}
+    };
+}   /* namespace dsa */
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Drop one reference to __p, freeing the nodes whose count reaches zero
+**
+** @param [in]
+**      __p: node to release, may be nullptr
+**
+** @note
+**       Iterative: freeing a node drops its reference to the next one, and the loop stops at
+**       the first node that is still shared, so a long list never recurses.
+**       The acquire-release decrement orders every reader's accesses before the delete.
+**       Complexity: O(number of freed nodes)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+void dsa::persistent_list<_Tp, _Policy>::__release(__node* __p) noexcept {
+    __node_alloc __a;
+    while (__p != nullptr && __p->__refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        __node* __next = __p->__next_;
+        __node_traits::destroy(__a, __p);
+        __node_traits::deallocate(__a, __p, 1);
+        __p = __next;
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Report the memory reachable from this version
+**
+** @return
+**       payload, links and counts of every node, and estimated allocator slack
+**
+** @note
+**       Nodes shared with other versions are counted in each of them, so the footprints of
+**       several versions do not add up. Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Policy>
+dsa::memory_footprint dsa::persistent_list<_Tp, _Policy>::memory_usage() const noexcept {
+    const size_type __n = size();
+    memory_footprint __m;
+    __m.payload_bytes = __n * sizeof(_Tp);
+    __m.overhead_bytes = sizeof(*this) + __n * (sizeof(__node) - sizeof(_Tp));
+    __m.slack_bytes = __n * allocation_slack(sizeof(__node), alignof(__node));
+    __m.allocations = __n;
+    return __m;
+}
+#endif /* PERSISTENT_LIST_H */
@@ -0,0 +1,336 @@
+/**
+ * @file    BoundedQueue.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A blocking FIFO queue with a fixed capacity, the link between pipeline stages
+*/
+
+#ifndef BOUNDED_QUEUE_H
+#define BOUNDED_QUEUE_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Deque.h"
+#include "ErrorPolicy.h"
+#include "MemoryUsage.h"
+#include "queue.h"
+
+namespace dsa {
+    /**
+     * @brief bounded_queue is a thread-safe FIFO queue holding at most capacity() elements.
+     *      push() blocks while the queue is full, so a fast producer is held back to the pace
+     *      of its consumer instead of growing the queue; pop() blocks while it is empty.
+     *
+     * @tparam
+     *      _Tp the type of stored element
+     * @tparam
+     *      _Container the type of underlying container, see dsa::queue
+     *
+     * @note
+     *      The batch operations move up to a whole batch under one lock acquisition. After
+     *      close(), push() fails and pop() returns the remaining elements, then std::nullopt.
+     *      The counters report the deepest the queue has been and how many pushes had to wait,
+     *      the two signs of a consumer that cannot keep up.
+    */
+    template <class _Tp, class _Container = deque<_Tp>>
+    class bounded_queue {
+        public:
+            using value_type = _Tp;                                     //!< value_type
+            using size_type = std::size_t;                              //!< size_type
+
+            /**
+             * @brief construct an empty queue holding at most __capacity elements
+             *
+             * @note
+             *      Throws std::invalid_argument for a capacity of 0.
+             */
+            explicit bounded_queue(size_type __capacity) : __capacity_{__capacity} {
+                if (__capacity == 0) throw std::invalid_argument("bounded_queue: capacity must be positive");
+            }
+
+            bounded_queue(const bounded_queue&) = delete;
+            bounded_queue& operator=(const bounded_queue&) = delete;
+
+            /** @brief push a copy of __x, waiting for room; return false if the queue is closed */
+            bool push(const _Tp& __x) { return emplace(__x); }
+
+            /** @brief push __x, waiting for room; return false if the queue is closed */
+            bool push(_Tp&& __x) { return emplace(std::move(__x)); }
+
+            template <class... _Args>
+            bool emplace(_Args&&... __args);
+
+            template <class _Make>
+            bool push_with(_Make&& __make);
+
+            /** @brief push __x if there is room, without waiting */
+            bool try_push(_Tp&& __x) {
+                {
+                    std::lock_guard<std::mutex> __guard{__lock_};
+                    if (__closed_ || __items_.size() == __capacity_) return false;
+                    __items_.push(std::move(__x));
+                    __note_depth();
+                }
+                __not_empty_.notify_one();
+                return true;
+            }
+
+            bool push_batch(std::vector<_Tp>& __batch);
+
+            std::optional<_Tp> pop();
+
+            bool pop_batch(std::vector<_Tp>& __out, size_type __max);
+
+            /** @brief remove and return the first element without waiting, std::nullopt if there is none */
+            std::optional<_Tp> try_pop() {
+                std::optional<_Tp> __v;
+                {
+                    std::lock_guard<std::mutex> __guard{__lock_};
+                    __v = __items_.try_pop();
+                }
+                if (__v) __not_full_.notify_one();
+                return __v;
+            }
+
+            /** @brief refuse further pushes and wake every waiting thread; idempotent */
+            void close() {
+                {
+                    std::lock_guard<std::mutex> __guard{__lock_};
+                    __closed_ = true;
+                }
+                __not_full_.notify_all();
+                __not_empty_.notify_all();
+            }
+
+            /** @brief check whether close() was called */
+            bool closed() const {
+                std::lock_guard<std::mutex> __guard{__lock_};
+                return __closed_;
+            }
+
+            /** @brief return the number of queued elements */
+            size_type size() const {
+                std::lock_guard<std::mutex> __guard{__lock_};
+                return __items_.size();
+            }
+
+            /** @brief check whether no element is queued */
+            bool empty() const { return size() == 0; }
+
+            /** @brief return the maximum number of queued elements */
+            size_type capacity() const noexcept { return __capacity_; }
+
+            /** @brief return the largest size() seen so far */
+            size_type high_water() const {
+                std::lock_guard<std::mutex> __guard{__lock_};
+                return __high_water_;
+            }
+
+            /** @brief return the number of pushes that had to wait for room */
+            std::uint64_t stalls() const {
+                std::lock_guard<std::mutex> __guard{__lock_};
+                return __stalls_;
+            }
+
+            /** @brief return the memory held by the queue */
+            memory_footprint memory_usage() const
+                requires requires(const _Container& __c) { __c.memory_usage(); }
+            {
+                std::lock_guard<std::mutex> __guard{__lock_};
+                memory_footprint __m = __items_.memory_usage();
+                __m.overhead_bytes += sizeof(*this) - sizeof(__items_);
+                return __m;
+            }
+
+        private:
+            mutable std::mutex __lock_;
+            std::condition_variable __not_full_;        //!< signalled when an element leaves
+            std::condition_variable __not_empty_;       //!< signalled when an element arrives
+            queue<_Tp, _Container, unchecked_policy> __items_;      //!< only read after an emptiness check
+            const size_type __capacity_;
+            size_type __high_water_ = 0;                //!< largest size seen
+            std::uint64_t __stalls_ = 0;                //!< pushes that found the queue full
+            bool __closed_ = false;
+
+            /* Wait for room, counting the wait; return false if the queue was closed */
+            bool __wait_for_room(std::unique_lock<std::mutex>& __guard) {
+                if (!__closed_ && __items_.size() == __capacity_) {
+                    ++__stalls_;
+                    __not_full_.wait(__guard, [this] { return __closed_ || __items_.size() < __capacity_; });
+                }
+                return !__closed_;
+            }
+
+            void __note_depth() noexcept { __high_water_ = std::max(__high_water_, __items_.size()); }
+    };
+}   /* namespace dsa */
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Wait until the queue has room, then construct an element from __args at the back
+**
+** @param [in]
+**      args: the arguments args... are forwarded to the constructor as std::forward<_Args>(args)...
+**
+** @return
+**       false if the queue is or gets closed before there is room; nothing is constructed then
+**
+** @note
+**       Complexity: O(1) plus the wait
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Container>
+template <class... _Args>
+bool dsa::bounded_queue<_Tp, _Container>::emplace(_Args&&... __args) {
+    {
+        std::unique_lock<std::mutex> __guard{__lock_};
+        if (!__wait_for_room(__guard)) return false;
+        __items_.push(_Tp(std::forward<_Args>(__args)...));
+        __note_depth();
+    }
+    __not_empty_.notify_one();
+    return true;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Wait until the queue has room, then push the element returned by __make(), which is
+**      called under the queue's lock
+**
+** @param [in]
+**      __make: callable returning a _Tp, not called if the queue is closed
+**
+** @return
+**       false if the queue is or gets closed before there is room
+**
+** @note
+**       Lets a producer tie something to the position of its element, such as a sequence
+**       number that must not be taken by a push that fails. Complexity: O(1) plus the wait
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Container>
+template <class _Make>
+bool dsa::bounded_queue<_Tp, _Container>::push_with(_Make&& __make) {
+    {
+        std::unique_lock<std::mutex> __guard{__lock_};
+        if (!__wait_for_room(__guard)) return false;
+        __items_.push(std::forward<_Make>(__make)());
+        __note_depth();
+    }
+    __not_empty_.notify_one();
+    return true;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Move every element of __batch to the back of the queue, in order, waiting for room as
+**      needed, and clear __batch
+**
+** @param [in]
+**      __batch: elements to push
+**
+** @return
+**       false if the queue was closed before all of them were pushed; the elements not pushed
+**       are dropped
+**
+** @note
+**       Takes the lock once per run of elements that fit, not once per element. Batches from
+**       concurrent producers may interleave when the queue fills up.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Container>
+bool dsa::bounded_queue<_Tp, _Container>::push_batch(std::vector<_Tp>& __batch) {
+    bool __ok = true;
+    for (size_type __i = 0; __i < __batch.size();) {
+        {
+            std::unique_lock<std::mutex> __guard{__lock_};
+            if (!__wait_for_room(__guard)) {
+                __ok = false;
+                break;
+            }
+            for (; __i < __batch.size() && __items_.size() < __capacity_; ++__i) __items_.push(std::move(__batch[__i]));
+            __note_depth();
+        }
+        __not_empty_.notify_all();
+    }
+    __batch.clear();
+    return __ok;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Wait for an element and remove it
+**
+** @return
+**       the first element, or std::nullopt once the queue is closed and empty
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Container>
+std::optional<_Tp> dsa::bounded_queue<_Tp, _Container>::pop() {
+    std::optional<_Tp> __v;
+    {
+        std::unique_lock<std::mutex> __guard{__lock_};
+        __not_empty_.wait(__guard, [this] { return __closed_ || !__items_.empty(); });
+        __v = __items_.try_pop();
+    }
+    if (__v) __not_full_.notify_one();
+    return __v;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Wait for at least one element, then move up to __max elements to __out
+**
+** @param [out]
+**      __out: cleared, then receives the elements in FIFO order
+**
+** @param [in]
+**      __max: largest number of elements to take, at least 1
+**
+** @return
+**       false once the queue is closed and empty, true otherwise
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, class _Container>
+bool dsa::bounded_queue<_Tp, _Container>::pop_batch(std::vector<_Tp>& __out, size_type __max) {
+    __out.clear();
+    if (__max == 0) __max = 1;
+    {
+        std::unique_lock<std::mutex> __guard{__lock_};
+        __not_empty_.wait(__guard, [this] { return __closed_ || !__items_.empty(); });
+        while (__out.size() < __max && !__items_.empty()) {
+            __out.push_back(std::move(__items_.front()));
+            __items_.pop();
+        }
+    }
+    if (__out.empty()) return false;
+    if (__out.size() == 1) __not_full_.notify_one();
+    else __not_full_.notify_all();
+    return true;
+}
+
+#endif /* BOUNDED_QUEUE_H */
@@ -0,0 +1,423 @@
+/**
+ * @file    Pipeline.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   Multi-threaded processing stages connected by bounded queues
+*/
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "BoundedQueue.h"
+
+namespace dsa {
+    /** @brief how one stage of a pipeline runs */
+    struct stage_options {
+        std::size_t parallelism = 1;        //!< worker threads calling the stage function
+        std::size_t capacity = 1024;        //!< capacity of the queue between this stage and the next
+        std::size_t batch = 1;              //!< items a worker takes from its input and hands on at once
+        bool ordered = true;                //!< emit results in the order the pipeline received the items
+    };
+
+    /** @brief counters of one stage, see pipeline::stats() */
+    struct stage_stats {
+        std::string name;                   //!< name given to then()
+        std::size_t parallelism = 0;        //!< worker threads
+        std::uint64_t processed = 0;        //!< items the stage function has returned from
+        std::chrono::nanoseconds busy{0};   //!< time spent in the stage function, summed over the workers
+        double items_per_second = 0;        //!< processed items over the time since the stage started
+        double utilization = 0;             //!< busy time over parallelism times elapsed time, near 1 when saturated
+        std::size_t queue_depth = 0;        //!< items waiting in the input queue
+        std::size_t queue_capacity = 0;     //!< capacity of the input queue
+        std::size_t queue_high_water = 0;   //!< deepest the input queue has been
+        std::uint64_t upstream_stalls = 0;  //!< pushes into the input queue that waited for room
+    };
+
+    /** @brief the type carried between stages, std::monostate after a stage returning void */
+    template <class _Tp>
+    using __pipeline_value_t = std::conditional_t<std::is_void_v<_Tp>, std::monostate, _Tp>;
+
+    /** @brief an item in flight with its position in the input order */
+    template <class _Tp>
+    struct __pipeline_item {
+        std::uint64_t __seq_;               //!< index of the input item it came from
+        _Tp __value_;
+    };
+
+    /** @brief type-independent interface of a stage */
+    class __pipeline_stage_base {
+        public:
+            virtual ~__pipeline_stage_base() = default;
+            virtual void __join() = 0;
+            virtual stage_stats __stats() const = 0;
+    };
+
+    /** @brief state shared by the stages of one pipeline */
+    struct __pipeline_control {
+        std::mutex __lock_;
+        std::exception_ptr __error_;                        //!< first exception thrown by a stage function
+        std::atomic<bool> __failed_{false};
+        std::vector<std::function<void()>> __closers_;      //!< close() of every queue
+        std::atomic<std::uint64_t> __next_seq_{0};          //!< sequence number of the next pushed item, taken under the input queue's lock
+        std::vector<std::unique_ptr<__pipeline_stage_base>> __stages_;  //!< destroyed, and so joined, first
+
+        /* Record the first error and close every queue so that all workers and producers return */
+        void __abort(std::exception_ptr __e) {
+            std::lock_guard<std::mutex> __guard{__lock_};
+            if (__e && !__error_) __error_ = __e;
+            __failed_ = true;
+            for (const auto& __close : __closers_) __close();
+        }
+    };
+
+    /** @brief the workers of one stage, turning _In items from one queue into _Out items in the next */
+    template <class _In, class _Out, class _Fn>
+    class __pipeline_stage final : public __pipeline_stage_base {
+        public:
+            using __value = __pipeline_value_t<_Out>;
+            using __in_queue = bounded_queue<__pipeline_item<_In>>;
+            using __out_queue = bounded_queue<__pipeline_item<__value>>;
+
+            __pipeline_stage(std::string __name, _Fn __fn, stage_options __options, __pipeline_control* __control,
+                             std::shared_ptr<__in_queue> __input, std::shared_ptr<__out_queue> __output)
+                : __name_{std::move(__name)}, __fn_{std::move(__fn)}, __options_{__options}, __control_{__control},
+                  __input_{std::move(__input)}, __output_{std::move(__output)}, __active_{__options.parallelism} {
+                {
+                    /* Registered before the workers start, so no abort can miss a waiting worker */
+                    std::lock_guard<std::mutex> __guard{__control_->__lock_};
+                    __control_->__closers_.push_back([this] { __wake(); });
+                }
+                __workers_.reserve(__options_.parallelism);
+                for (std::size_t __i = 0; __i < __options_.parallelism; ++__i) __workers_.emplace_back([this] { __work(); });
+            }
+
+            ~__pipeline_stage() override { __join(); }
+
+            void __join() override {
+                for (std::thread& __t : __workers_)
+                    if (__t.joinable()) __t.join();
+            }
+
+            stage_stats __stats() const override;
+
+        private:
+            using __clock = std::chrono::steady_clock;
+
+            const std::string __name_;
+            _Fn __fn_;
+            const stage_options __options_;
+            __pipeline_control* const __control_;
+            const std::shared_ptr<__in_queue> __input_;
+            const std::shared_ptr<__out_queue> __output_;       //!< nullptr for a final stage returning void
+            const __clock::time_point __started_ = __clock::now();
+            std::atomic<std::size_t> __active_;                 //!< workers still running
+            std::atomic<std::uint64_t> __processed_{0};
+            std::atomic<std::int64_t> __busy_ns_{0};
+            std::mutex __reorder_lock_;
+            std::condition_variable __reorder_room_;            //!< signalled when __next_seq_ moves or the pipeline fails
+            std::map<std::uint64_t, __value> __pending_;        //!< finished out of order, ordered stages only
+            std::uint64_t __next_seq_ = 0;                      //!< next item an ordered stage may emit
+            std::size_t __waiting_ = 0;                         //!< workers waiting for the reorder window
+            std::vector<std::thread> __workers_;
+
+            void __work();
+            void __emit(std::vector<__pipeline_item<__value>>& __out);
+
+            void __wake() {
+                std::lock_guard<std::mutex> __guard{__reorder_lock_};
+                __reorder_room_.notify_all();
+            }
+    };
+
+    /**
+     * @brief pipeline runs a chain of stage functions on worker threads. Each stage reads
+     *      from a bounded_queue and writes to the next, so a stage that lags fills its input
+     *      queue and holds back everything before it, down to push().
+     *
+     *      auto p = pipeline<std::string>{}
+     *                   .then("parse", parse, {.parallelism = 4, .batch = 32})
+     *                   .then("score", score, {.parallelism = 2})
+     *                   .then("store", store);                 // returns void: a final stage
+     *      for (auto& line : input) p.push(line);
+     *      p.close();
+     *      p.wait();
+     *
+     * @tparam
+     *      _In the type of pushed items
+     * @tparam
+     *      _Out the type of items leaving the last stage, void if it consumes them
+     *
+     * @note
+     *      Stage workers start in then(). A stage function that throws stops the pipeline:
+     *      every queue is closed, push() and pop() fail, and wait() rethrows the exception.
+     *      Items leaving an ordered stage keep the order of push(); those leaving an unordered
+     *      stage go out as they finish. Unless the last stage returns void, pop() must drain
+     *      the output, or the stages stall once it is full. The destructor stops the pipeline
+     *      without draining it.
+    */
+    template <class _In, class _Out = _In>
+    class pipeline {
+            template <class, class> friend class pipeline;
+
+            using __value = __pipeline_value_t<_Out>;
+
+        public:
+            /** @brief construct a pipeline without stages whose input queue holds __capacity items */
+            explicit pipeline(std::size_t __capacity = 1024) requires std::same_as<_In, _Out>
+                : __control_{std::make_unique<__pipeline_control>()},
+                  __input_{std::make_shared<bounded_queue<__pipeline_item<_In>>>(__capacity)}, __output_{__input_} {
+                __control_->__closers_.push_back([__q = __input_.get()] { __q->close(); });
+            }
+
+            pipeline(pipeline&&) noexcept = default;
+            pipeline& operator=(pipeline&&) = delete;
+
+            /** @brief destructor, stops the stages and joins their threads */
+            ~pipeline() {
+                if (__control_ == nullptr) return;
+                __control_->__abort(nullptr);
+                for (auto& __s : __control_->__stages_) __s->__join();
+            }
+
+            template <class _Fn>
+                requires (!std::is_void_v<_Out>) && std::invocable<_Fn&, __pipeline_value_t<_Out>&&>
+            pipeline<_In, std::invoke_result_t<_Fn&, __pipeline_value_t<_Out>&&>>
+            then(std::string __name, _Fn __fn, stage_options __options = {}) &&;
+
+            /**
+             * @brief feed __x to the first stage, waiting while its queue is full
+             *
+             * @return
+             *      false after close() or a failure
+             */
+            bool push(_In __x) {
+                /* A push that fails takes no sequence number, or an ordered stage would wait for it forever */
+                return __input_->push_with([this, &__x] {
+                    return __pipeline_item<_In>{__control_->__next_seq_.fetch_add(1, std::memory_order_relaxed), std::move(__x)};
+                });
+            }
+
+            /** @brief end the input; the stages finish the queued items and stop */
+            void close() { __input_->close(); }
+
+            /**
+             * @brief wait for the next item leaving the last stage
+             *
+             * @return
+             *      the item, or std::nullopt once the pipeline has finished or failed
+             */
+            std::optional<_Out> pop() requires (!std::is_void_v<_Out>) {
+                std::optional<__pipeline_item<_Out>> __item = __output_->pop();
+                if (!__item) return std::nullopt;
+                return std::optional<_Out>{std::move(__item->__value_)};
+            }
+
+            /**
+             * @brief wait for every stage to finish, after close()
+             *
+             * @note
+             *      Rethrows the first exception thrown by a stage function.
+             */
+            void wait() {
+                for (auto& __s : __control_->__stages_) __s->__join();
+                std::lock_guard<std::mutex> __guard{__control_->__lock_};
+                if (__control_->__error_) std::rethrow_exception(__control_->__error_);
+            }
+
+            /** @brief return the counters of every stage, first stage first */
+            std::vector<stage_stats> stats() const {
+                std::vector<stage_stats> __r;
+                __r.reserve(__control_->__stages_.size());
+                for (const auto& __s : __control_->__stages_) __r.push_back(__s->__stats());
+                return __r;
+            }
+
+            /**
+             * @brief return the index of the stage that limits the throughput, the one with the
+             *      highest utilization
+             *
+             * @note
+             *      Throws std::logic_error for a pipeline without stages.
+             */
+            std::size_t bottleneck() const {
+                const std::vector<stage_stats> __s = stats();
+                if (__s.empty()) throw std::logic_error("pipeline: no stages");
+                std::size_t __b = 0;
+                for (std::size_t __i = 1; __i < __s.size(); ++__i)
+                    if (__s[__i].utilization > __s[__b].utilization) __b = __i;
+                return __b;
+            }
+
+            /** @brief return the number of stages */
+            std::size_t stages() const noexcept { return __control_->__stages_.size(); }
+
+        private:
+            std::unique_ptr<__pipeline_control> __control_;
+            std::shared_ptr<bounded_queue<__pipeline_item<_In>>> __input_;
+            std::shared_ptr<bounded_queue<__pipeline_item<__value>>> __output_;     //!< nullptr after a void stage
+
+            pipeline(std::unique_ptr<__pipeline_control> __control, std::shared_ptr<bounded_queue<__pipeline_item<_In>>> __input,
+                     std::shared_ptr<bounded_queue<__pipeline_item<__value>>> __output) noexcept
+                : __control_{std::move(__control)}, __input_{std::move(__input)}, __output_{std::move(__output)} {}
+    };
+}   /* namespace dsa */
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Append a stage that calls __fn on every item leaving the current last stage and start
+**      its workers
+**
+** @param [in]
+**      __name: name reported by stats()
+**
+** @param [in]
+**      __fn: stage function, called concurrently by the workers when parallelism > 1
+**
+** @param [in]
+**      __options: workers, output queue capacity, batch size and ordering
+**
+** @return
+**       the pipeline, now ending with the new stage; *this is left empty
+**
+** @note
+**       Throws std::invalid_argument for a parallelism, capacity or batch of 0.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _In, class _Out>
+template <class _Fn>
+    requires (!std::is_void_v<_Out>) && std::invocable<_Fn&, dsa::__pipeline_value_t<_Out>&&>
+dsa::pipeline<_In, std::invoke_result_t<_Fn&, dsa::__pipeline_value_t<_Out>&&>>
+dsa::pipeline<_In, _Out>::then(std::string __name, _Fn __fn, stage_options __options) && {
+    using _Result = std::invoke_result_t<_Fn&, dsa::__pipeline_value_t<_Out>&&>;
+    using __stage = __pipeline_stage<_Out, _Result, _Fn>;
+    using __next = pipeline<_In, _Result>;
+    if (__options.parallelism == 0 || __options.capacity == 0 || __options.batch == 0)
+        throw std::invalid_argument("pipeline: parallelism, capacity and batch must be positive");
+
+    std::shared_ptr<typename __stage::__out_queue> __output;
+    if constexpr (!std::is_void_v<_Result>) {
+        __output = std::make_shared<typename __stage::__out_queue>(__options.capacity);
+        std::lock_guard<std::mutex> __guard{__control_->__lock_};
+        __control_->__closers_.push_back([__q = __output.get()] { __q->close(); });
+    }
+    __control_->__stages_.push_back(std::make_unique<__stage>(std::move(__name), std::move(__fn), __options,
+                                                              __control_.get(), __output_, __output));
+    return __next{std::move(__control_), std::move(__input_), std::move(__output)};
+}
+
+/* Take batches until the input is closed and drained; the last worker out closes the output */
+template <class _In, class _Out, class _Fn>
+void dsa::__pipeline_stage<_In, _Out, _Fn>::__work() {
+    std::vector<__pipeline_item<_In>> __in;
+    std::vector<__pipeline_item<__value>> __out;
+    try {
+        while (!__control_->__failed_.load(std::memory_order_relaxed) && __input_->pop_batch(__in, __options_.batch)) {
+            const __clock::time_point __t0 = __clock::now();
+            for (__pipeline_item<_In>& __item : __in) {
+                if constexpr (std::is_void_v<_Out>) std::invoke(__fn_, std::move(__item.__value_));
+                else __out.push_back(__pipeline_item<__value>{__item.__seq_, std::invoke(__fn_, std::move(__item.__value_))});
+            }
+            __busy_ns_.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(__clock::now() - __t0).count(),
+                                 std::memory_order_relaxed);
+            __processed_.fetch_add(__in.size(), std::memory_order_relaxed);
+            if constexpr (!std::is_void_v<_Out>) __emit(__out);
+        }
+    } catch (...) {
+        __control_->__abort(std::current_exception());
+    }
+    if (__active_.fetch_sub(1) == 1 && __output_ != nullptr) __output_->close();
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Hand a batch of results to the next stage; an ordered stage first holds back results
+**      whose predecessors are still being worked on
+**
+** @param [in]
+**      __out: results of one batch, emptied
+**
+** @note
+**       An ordered stage pushes under its reorder lock, so its batches leave in sequence; a
+**       full output queue then blocks every worker of the stage, which is the back-pressure.
+**       While an item is slow, a worker whose batch is capacity or more items ahead of it
+**       waits instead of parking its results, so the reorder buffer stays bounded and the
+**       input queue fills up. One worker always keeps going, since the late item may still
+**       be queued behind an unordered upstream stage.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _In, class _Out, class _Fn>
+void dsa::__pipeline_stage<_In, _Out, _Fn>::__emit(std::vector<__pipeline_item<__value>>& __out) {
+    if (!__options_.ordered) {
+        __output_->push_batch(__out);
+        return;
+    }
+    std::uint64_t __first = __out.front().__seq_;
+    for (const __pipeline_item<__value>& __item : __out) __first = std::min(__first, __item.__seq_);
+
+    std::unique_lock<std::mutex> __guard{__reorder_lock_};
+    if (__first - __next_seq_ >= __options_.capacity && __waiting_ + 1 < __options_.parallelism) {
+        ++__waiting_;
+        __reorder_room_.wait(__guard, [this, __first] {
+            return __first - __next_seq_ < __options_.capacity || __control_->__failed_.load(std::memory_order_relaxed);
+        });
+        --__waiting_;
+    }
+    for (__pipeline_item<__value>& __item : __out) __pending_.emplace(__item.__seq_, std::move(__item.__value_));
+    __out.clear();
+    for (auto __it = __pending_.begin(); __it != __pending_.end() && __it->first == __next_seq_; ++__next_seq_) {
+        __out.push_back(__pipeline_item<__value>{__it->first, std::move(__it->second)});
+        __it = __pending_.erase(__it);
+    }
+    if (__out.empty()) return;
+    __reorder_room_.notify_all();
+    __output_->push_batch(__out);
+}
+
+template <class _In, class _Out, class _Fn>
+dsa::stage_stats dsa::__pipeline_stage<_In, _Out, _Fn>::__stats() const {
+    stage_stats __s;
+    __s.name = __name_;
+    __s.parallelism = __options_.parallelism;
+    __s.processed = __processed_.load(std::memory_order_relaxed);
+    __s.busy = std::chrono::nanoseconds{__busy_ns_.load(std::memory_order_relaxed)};
+    const double __elapsed = std::chrono::duration<double>(__clock::now() - __started_).count();
+    if (__elapsed > 0) {
+        __s.items_per_second = static_cast<double>(__s.processed) / __elapsed;
+        __s.utilization = std::chrono::duration<double>(__s.busy).count() / (__elapsed * static_cast<double>(__s.parallelism));
+    }
+    __s.queue_depth = __input_->size();
+    __s.queue_capacity = __input_->capacity();
+    __s.queue_high_water = __input_->high_water();
+    __s.upstream_stalls = __input_->stalls();
+    return __s;
+}
+
+#endif /* PIPELINE_H */
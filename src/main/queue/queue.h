@@ -10,7 +10,12 @@
 #ifndef QUEUE_H
 #define QUEUE_H
 
-#include <deque>
+#include <optional>
+
+#include "Algorithm.h"
+#include "Deque.h"
+#include "ErrorPolicy.h"
+#include "MemoryUsage.h"
 
 namespace dsa {
     /** 
@@ -21,10 +26,18 @@ namespace dsa {
      *      T the type of stored element
      * @tparam
      *      Container the type of underlying container to use to store the elements
+     * @tparam
+     *      Policy what front(), back() and pop() on an empty queue do, see ErrorPolicy.h
+     *
+     * @note
+     *      The check happens in the queue, whatever the policy of Container.
+     *      try_pop() never fails.
     */
-    template <typename T, class Container = std::deque<T>>
+    template <typename T, class Container = dsa::deque<T>, class Policy = dsa::checked_policy>
     class queue
     {
+        static_assert(dsa::error_policy<Policy>, "Policy must be an error policy");
+
         protected:
             Container _container;                                   //!< container
 
@@ -34,6 +47,7 @@ namespace dsa {
             using size_type = Container::size_type;                 //!< value_type&
             using reference = Container::reference;                 //!< const value_type&
             using const_reference = Container::const_reference;     //!< size_t
+            using error_policy = Policy;                            //!< precondition policy
 
             /**
              *  @brief 
@@ -72,12 +86,34 @@ namespace dsa {
             /** Returns the number of elements in the %queue */
             size_type size() const {return _container.size();}
 
+            /**
+             * Return true if both %queues hold equal elements in the same
+             * order, see dsa::equal().
+            */
+            friend bool operator==(const queue& x, const queue& y)
+            {
+                return dsa::equal(x._container, y._container);
+            }
+
+            /**
+             * Returns the memory held by the %queue, available when the
+             * underlying container reports it.
+            */
+            memory_footprint memory_usage() const
+                requires requires(const Container& __c) { __c.memory_usage(); }
+            {
+                memory_footprint usage = _container.memory_usage();
+                usage.overhead_bytes += sizeof(*this) - sizeof(_container);
+                return usage;
+            }
+
             /**
              * Return a read/write reference to the data at the first 
              * element of the %queue.
             */
-            reference front()
+            reference front() noexcept(Policy::is_nothrow && noexcept(_container.front()))
             {
+                Policy::require(!_container.empty(), "Empty queue");
                 return _container.front();
             }
 
@@ -86,8 +122,9 @@ namespace dsa {
              * of the %queue
             */
 
-            const_reference front() const
+            const_reference front() const noexcept(Policy::is_nothrow && noexcept(_container.front()))
             {
+                Policy::require(!_container.empty(), "Empty queue");
                 return _container.front();
             }
 
@@ -95,17 +132,19 @@ namespace dsa {
              * Return a read/write reference to the data at the last 
              * element of the %queue.
             */
-            reference back()
+            reference back() noexcept(Policy::is_nothrow && noexcept(_container.back()))
             {
-                    return _container.back();
+                Policy::require(!_container.empty(), "Empty queue");
+                return _container.back();
             }
 
             /**
             * Return a constant reference to the data at the last 
             * element of the %queue.
             */
-            const_reference back() const
+            const_reference back() const noexcept(Policy::is_nothrow && noexcept(_container.back()))
             {
+                Policy::require(!_container.empty(), "Empty queue");
                 return _container.back();
             }
 
@@ -140,10 +179,27 @@ namespace dsa {
             /**
              * @brief   Removes first element.
             */
-            void pop()
+            void pop() noexcept(Policy::is_nothrow && noexcept(_container.pop_front()))
             {
+                Policy::require(!_container.empty(), "Empty queue");
                 _container.pop_front();
             }
+
+            /**
+             * @brief   Removes first element and returns it.
+             * @return  The removed element, or std::nullopt if the %queue is empty
+            */
+            std::optional<value_type> try_pop()
+            {
+                if constexpr (requires { _container.try_pop_front(); }) {
+                    return _container.try_pop_front();
+                } else {
+                    if (_container.empty()) return std::nullopt;
+                    std::optional<value_type> val{std::move(_container.front())};
+                    _container.pop_front();
+                    return val;
+                }
+            }
     };
 }
 
@@ -0,0 +1,198 @@
+/**
+ * @file    ConcurrentRingBuffer.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A lossy ring of the last N events, written by any number of threads without locks
+*/
+
+#ifndef CONCURRENT_RING_BUFFER_H
+#define CONCURRENT_RING_BUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "MemoryUsage.h"
+
+namespace dsa {
+    /**
+     * @brief concurrent_ring_buffer keeps the last _N events pushed by any number of threads,
+     *      e.g. a recent-events log or an in-process trace. A writer claims a sequence number
+     *      with one fetch_add and writes its event into slot sequence % _N under a per-slot
+     *      sequence lock; it never waits for another thread and never allocates.
+     *
+     * @tparam
+     *      _Tp the type of stored event, trivially copyable
+     * @tparam
+     *      _N capacity in events
+     *
+     * @note
+     *      Readers take a snapshot() at any time, concurrently with the writers: it returns
+     *      the readable events in sequence order and skips the ones being written or
+     *      overwritten while it copies them, so it never returns a torn event. A writer that
+     *      finds its slot still being written by a writer one lap behind or ahead gives up its
+     *      event and counts it in lost(); that takes _N pushes during one write. The event is
+     *      copied in 8-byte words through relaxed atomics, which compile to plain moves.
+    */
+    template <class _Tp, std::size_t _N>
+    class concurrent_ring_buffer {
+            static_assert(_N > 0, "concurrent_ring_buffer: capacity must not be zero");
+            static_assert(std::is_trivially_copyable_v<_Tp>, "concurrent_ring_buffer: events must be trivially copyable");
+
+            static constexpr std::size_t __cache_line = 64;     //!< keeps the writers' counter off the slots
+            static constexpr std::size_t __words = (sizeof(_Tp) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+            /* stamp 0: never written, 2s + 1: event s being written, 2s + 2: event s readable */
+            struct __slot {
+                std::atomic<std::uint64_t> __stamp_{0};
+                std::array<std::atomic<std::uint64_t>, __words> __words_{};
+            };
+
+        public:
+            using value_type = _Tp;                             //!< value_type
+            using size_type = std::size_t;                      //!< size_type
+
+            concurrent_ring_buffer() noexcept = default;
+            concurrent_ring_buffer(const concurrent_ring_buffer&) = delete;
+            concurrent_ring_buffer& operator=(const concurrent_ring_buffer&) = delete;
+
+            bool push(const _Tp& __x) noexcept;
+
+            template <class _Out>
+            _Out snapshot(_Out __out) const;
+
+            /** @brief return a copy of the readable events, oldest first */
+            std::vector<_Tp> snapshot() const {
+                std::vector<_Tp> __v;
+                __v.reserve(_N);
+                snapshot(std::back_inserter(__v));
+                return __v;
+            }
+
+            /** @brief return the number of events pushed so far */
+            std::uint64_t pushed() const noexcept { return __next_.load(std::memory_order_relaxed); }
+
+            /** @brief return the number of events pushed out by _N newer ones */
+            std::uint64_t overwritten() const noexcept {
+                const std::uint64_t __n = pushed();
+                return __n > _N ? __n - _N : 0;
+            }
+
+            /** @brief return the number of events given up because their slot was busy */
+            std::uint64_t lost() const noexcept { return __lost_.load(std::memory_order_relaxed); }
+
+            /** @brief return overwritten() + lost(), an event lost and then lapped is counted twice */
+            std::uint64_t dropped() const noexcept { return overwritten() + lost(); }
+
+            /** @brief return the number of events a snapshot may hold, at most _N */
+            size_type size() const noexcept {
+                const std::uint64_t __n = pushed();
+                return __n < _N ? static_cast<size_type>(__n) : _N;
+            }
+
+            /** @brief return the capacity, _N */
+            static constexpr size_type capacity() noexcept { return _N; }
+
+            /** @brief return the memory held by the ring, all of it inside the object */
+            memory_footprint memory_usage() const noexcept {
+                memory_footprint __m;
+                __m.payload_bytes = size() * sizeof(_Tp);
+                __m.overhead_bytes = sizeof(*this) - __m.payload_bytes;
+                return __m;
+            }
+
+        private:
+            alignas(__cache_line) std::atomic<std::uint64_t> __next_{0};    //!< next sequence number
+            std::atomic<std::uint64_t> __lost_{0};
+            alignas(__cache_line) std::array<__slot, _N> __slots_{};
+    };
+}   /* namespace dsa */
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Append a copy of __x, overwriting the event pushed _N events earlier
+**
+** @param[in]
+**      __x: event to push
+**
+** @return
+**      true if the event was written, false if it was lost to a busy slot
+**
+** @note
+**      Complexity: O(1), lock-free: one fetch_add, one compare-exchange and
+**      sizeof(_Tp) / 8 relaxed stores. The compare-exchange only retries when
+**      another writer finished the slot in between.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N>
+bool dsa::concurrent_ring_buffer<_Tp, _N>::push(const _Tp& __x) noexcept {
+    const std::uint64_t __seq = __next_.fetch_add(1, std::memory_order_relaxed);
+    __slot& __s = __slots_[__seq % _N];
+    std::uint64_t __stamp = __s.__stamp_.load(std::memory_order_relaxed);
+    do {
+        if ((__stamp & 1) != 0 || __stamp >= 2 * __seq + 2) {
+            __lost_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    } while (!__s.__stamp_.compare_exchange_weak(__stamp, 2 * __seq + 1, std::memory_order_relaxed));
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::uint64_t __raw[__words] = {};
+    std::memcpy(__raw, &__x, sizeof(_Tp));
+    for (std::size_t __i = 0; __i < __words; ++__i) __s.__words_[__i].store(__raw[__i], std::memory_order_relaxed);
+    __s.__stamp_.store(2 * __seq + 2, std::memory_order_release);
+    return true;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Copy the readable events to __out, oldest first
+**
+** @param[in]
+**      __out: output iterator accepting _Tp
+**
+** @return
+**      the end of the output
+**
+** @note
+**      Complexity: O(_N). Every event written is intact and the sequence numbers
+**      of the events written increase; events still being written or lapped
+**      during the copy are left out, so there may be gaps.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N>
+template <class _Out>
+_Out dsa::concurrent_ring_buffer<_Tp, _N>::snapshot(_Out __out) const {
+    const std::uint64_t __end = __next_.load(std::memory_order_acquire);
+    for (std::uint64_t __seq = __end > _N ? __end - _N : 0; __seq < __end; ++__seq) {
+        const __slot& __s = __slots_[__seq % _N];
+        const std::uint64_t __stamp = __s.__stamp_.load(std::memory_order_acquire);
+        if (__stamp != 2 * __seq + 2) continue;
+
+        std::uint64_t __raw[__words];
+        for (std::size_t __i = 0; __i < __words; ++__i) __raw[__i] = __s.__words_[__i].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (__s.__stamp_.load(std::memory_order_relaxed) != __stamp) continue;
+
+        alignas(_Tp) unsigned char __bytes[sizeof(_Tp)];
+        std::memcpy(__bytes, __raw, sizeof(_Tp));
+        *__out = *std::launder(reinterpret_cast<const _Tp*>(__bytes));
+        ++__out;
+    }
+    return __out;
+}
+
+#endif /* CONCURRENT_RING_BUFFER_H */
@@ -0,0 +1,336 @@
+/**
+ * @file    RingBuffer.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A fixed-capacity ring that never allocates and drops elements when full
+*/
+
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Algorithm.h"
+#include "ErrorPolicy.h"
+#include "MemoryUsage.h"
+
+namespace dsa {
+    /**
+     * @brief what a push to a full ring_buffer does
+     *
+     * overwrite_oldest: the oldest element is replaced, the ring keeps the last N elements.
+     * drop_newest: the pushed element is discarded, the ring keeps the first N elements.
+    */
+    enum class ring_overflow { overwrite_oldest, drop_newest };
+
+    template <class _Tp, std::size_t _N, ring_overflow _Overflow, class _Policy>
+    class ring_buffer;
+
+    /**
+     * @brief
+     *      ring_buffer iterator, a (ring, index) pair
+     *  @note
+     *      The iterator category is random_access_iterator
+    */
+    template <class _Tp, std::size_t _N, ring_overflow _Overflow, class _Policy, bool _Const>
+    class __ring_iterator {
+            friend class ring_buffer<_Tp, _N, _Overflow, _Policy>;
+            friend class __ring_iterator<_Tp, _N, _Overflow, _Policy, !_Const>;
+
+            using __ring_pointer = std::conditional_t<_Const, const ring_buffer<_Tp, _N, _Overflow, _Policy>*, ring_buffer<_Tp, _N, _Overflow, _Policy>*>;
+            __ring_pointer __r_;                //!< owning ring
+            std::size_t __i_;                   //!< position from the front
+
+        public:
+            using value_type = _Tp;                                                 //!< value_type
+            using reference = std::conditional_t<_Const, const _Tp&, _Tp&>;         //!< reference
+            using pointer = std::conditional_t<_Const, const _Tp*, _Tp*>;           //!< pointer
+            using difference_type = std::ptrdiff_t;                                 //!< distance
+            using iterator_category = std::random_access_iterator_tag;              //!< category
+
+            __ring_iterator() noexcept : __r_{nullptr}, __i_{0} {}
+            __ring_iterator(__ring_pointer __r, std::size_t __i) noexcept : __r_{__r}, __i_{__i} {}
+
+            /** @brief conversion from iterator to const_iterator */
+            template <bool _R, class = std::enable_if_t<_Const && !_R>>
+            __ring_iterator(const __ring_iterator<_Tp, _N, _Overflow, _Policy, _R>& __x) noexcept : __r_{__x.__r_}, __i_{__x.__i_} {}
+
+            reference operator*() const { return (*__r_)[__i_]; }
+            pointer operator->() const { return std::addressof((*__r_)[__i_]); }
+            reference operator[](difference_type __n) const { return (*__r_)[__i_ + __n]; }
+
+            __ring_iterator& operator++() { ++__i_; return *this; }
+            __ring_iterator operator++(int) { __ring_iterator __t{*this}; ++__i_; return __t; }
+            __ring_iterator& operator--() { --__i_; return *this; }
+            __ring_iterator operator--(int) { __ring_iterator __t{*this}; --__i_; return __t; }
+            __ring_iterator& operator+=(difference_type __n) { __i_ += __n; return *this; }
+            __ring_iterator& operator-=(difference_type __n) { __i_ -= __n; return *this; }
+
+            friend __ring_iterator operator+(__ring_iterator __x, difference_type __n) { return __x += __n; }
+            friend __ring_iterator operator+(difference_type __n, __ring_iterator __x) { return __x += __n; }
+            friend __ring_iterator operator-(__ring_iterator __x, difference_type __n) { return __x -= __n; }
+            friend difference_type operator-(const __ring_iterator& __x, const __ring_iterator& __y) {
+                return static_cast<difference_type>(__x.__i_) - static_cast<difference_type>(__y.__i_);
+            }
+
+            friend bool operator==(const __ring_iterator& __x, const __ring_iterator& __y) { return __x.__i_ == __y.__i_; }
+            friend auto operator<=>(const __ring_iterator& __x, const __ring_iterator& __y) { return __x.__i_ <=> __y.__i_; }
+    };
+
+    /**
+     * @brief ring_buffer is a circular buffer of _N elements stored inside the object. A push
+     *      to a full ring does not block and does not allocate: it drops the oldest or the new
+     *      element, as _Overflow says, and counts it in dropped(). It is a sequence container
+     *      for dsa::queue, e.g. queue<event, ring_buffer<event, 4096>> keeps the last 4096
+     *      events of a trace.
+     *
+     * @tparam
+     *      _Tp the type of stored element
+     * @tparam
+     *      _N capacity in elements
+     * @tparam
+     *      _Overflow what a push to a full ring does, see ring_overflow
+     * @tparam
+     *      _Policy what front/back/pop_front on an empty ring do, see ErrorPolicy.h
+     *
+     * @note
+     *      Elements are stored in at most two contiguous runs, see segments(). Pushing and
+     *      popping invalidate iterators to the elements they remove only. Not thread-safe,
+     *      see concurrent_ring_buffer for a ring shared by several writers.
+    */
+    template <class _Tp, std::size_t _N, ring_overflow _Overflow = ring_overflow::overwrite_oldest, class _Policy = unchecked_policy>
+    class ring_buffer {
+            static_assert(_N > 0, "ring_buffer: capacity must not be zero");
+
+        public:
+            using value_type = _Tp;                                                 //!< value_type
+            using size_type = std::size_t;                                          //!< size_type
+            using difference_type = std::ptrdiff_t;                                 //!< difference_type
+            using reference = _Tp&;                                                 //!< reference
+            using const_reference = const _Tp&;                                     //!< const_reference
+            using iterator = __ring_iterator<_Tp, _N, _Overflow, _Policy, false>;   //!< iterator type
+            using const_iterator = __ring_iterator<_Tp, _N, _Overflow, _Policy, true>;  //!< const_iterator type
+
+            /** @brief construct an empty ring */
+            ring_buffer() noexcept {}
+
+            /** @brief copy constructor, keeps the dropped() count */
+            ring_buffer(const ring_buffer& __x) : __dropped_{__x.__dropped_} {
+                for (const _Tp& __e : __x) emplace_back(__e);
+            }
+
+            /** @brief move constructor, moves the elements one by one */
+            ring_buffer(ring_buffer&& __x) noexcept(std::is_nothrow_move_constructible_v<_Tp>) : __dropped_{__x.__dropped_} {
+                for (_Tp& __e : __x) emplace_back(std::move(__e));
+                __x.clear();
+            }
+
+            /** @brief copy assignment */
+            ring_buffer& operator=(const ring_buffer& __x) {
+                if (this != &__x) {
+                    clear();
+                    for (const _Tp& __e : __x) emplace_back(__e);
+                    __dropped_ = __x.__dropped_;
+                }
+                return *this;
+            }
+
+            /** @brief move assignment */
+            ring_buffer& operator=(ring_buffer&& __x) noexcept(std::is_nothrow_move_constructible_v<_Tp>) {
+                if (this != &__x) {
+                    clear();
+                    for (_Tp& __e : __x) emplace_back(std::move(__e));
+                    __dropped_ = __x.__dropped_;
+                    __x.clear();
+                }
+                return *this;
+            }
+
+            ~ring_buffer() { clear(); }
+
+            /** @brief push a copy of __x at the back, return false if an element was dropped */
+            bool push_back(const _Tp& __x) { return emplace_back(__x); }
+
+            /** @brief push __x at the back, return false if an element was dropped */
+            bool push_back(_Tp&& __x) { return emplace_back(std::move(__x)); }
+
+            template <class... _Args>
+            bool emplace_back(_Args&&... __args);
+
+            /** @brief remove the front element */
+            void pop_front() noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "pop_front on an empty ring_buffer");
+                std::destroy_at(__slot(__head_));
+                __head_ = __head_ + 1 == _N ? 0 : __head_ + 1;
+                --__size_;
+            }
+
+            /** @brief remove the front element and return it, std::nullopt if the ring is empty */
+            std::optional<_Tp> try_pop_front() {
+                if (__size_ == 0) return std::nullopt;
+                std::optional<_Tp> __x{std::move(*__slot(__head_))};
+                pop_front();
+                return __x;
+            }
+
+            /** @brief return a reference to the oldest element */
+            reference front() noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "front on an empty ring_buffer");
+                return *__slot(__head_);
+            }
+
+            /** @brief return a constant reference to the oldest element */
+            const_reference front() const noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "front on an empty ring_buffer");
+                return *__slot(__head_);
+            }
+
+            /** @brief return a reference to the newest element */
+            reference back() noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "back on an empty ring_buffer");
+                return (*this)[__size_ - 1];
+            }
+
+            /** @brief return a constant reference to the newest element */
+            const_reference back() const noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "back on an empty ring_buffer");
+                return (*this)[__size_ - 1];
+            }
+
+            /** @brief return the element __i positions from the front, no bounds checking */
+            reference operator[](size_type __i) noexcept { return *__slot(__wrap(__head_ + __i)); }
+
+            /** @brief return the element __i positions from the front, no bounds checking */
+            const_reference operator[](size_type __i) const noexcept { return *__slot(__wrap(__head_ + __i)); }
+
+            iterator begin() noexcept { return iterator{this, 0}; }
+            iterator end() noexcept { return iterator{this, __size_}; }
+            const_iterator begin() const noexcept { return const_iterator{this, 0}; }
+            const_iterator end() const noexcept { return const_iterator{this, __size_}; }
+
+            /** @brief check whether the ring is empty */
+            bool empty() const noexcept { return __size_ == 0; }
+
+            /** @brief check whether the next push drops an element */
+            bool full() const noexcept { return __size_ == _N; }
+
+            /** @brief return the number of elements */
+            size_type size() const noexcept { return __size_; }
+
+            /** @brief return the capacity, _N */
+            static constexpr size_type capacity() noexcept { return _N; }
+
+            /** @brief check whether __x and __y hold equal elements from the front, see dsa::equal() */
+            friend bool operator==(const ring_buffer& __x, const ring_buffer& __y) { return dsa::equal(__x, __y); }
+
+            /** @brief return the number of elements dropped by pushes to the full ring */
+            std::uint64_t dropped() const noexcept { return __dropped_; }
+
+            /** @brief remove every element, keeps the dropped() count */
+            void clear() noexcept {
+                if constexpr (!std::is_trivially_destructible_v<_Tp>) {
+                    for (size_type __i = 0; __i < __size_; ++__i) std::destroy_at(&(*this)[__i]);
+                }
+                __head_ = 0;
+                __size_ = 0;
+            }
+
+            /**
+             * @brief
+             *      return the elements as contiguous runs, oldest first
+             *
+             * @return
+             *      two spans; the second is empty unless the elements wrap around the end of
+             *      the storage
+            */
+            std::array<std::span<const _Tp>, 2> segments() const noexcept {
+                const size_type __first = std::min(__size_, _N - __head_);
+                return {std::span<const _Tp>{__slot(__head_), __first}, std::span<const _Tp>{__slot(0), __size_ - __first}};
+            }
+
+            /** @brief copy the elements to __out, oldest first, and return the end of the output */
+            template <class _Out>
+            _Out snapshot(_Out __out) const {
+                for (std::span<const _Tp> __s : segments()) __out = std::copy(__s.begin(), __s.end(), __out);
+                return __out;
+            }
+
+            /** @brief return a copy of the elements, oldest first */
+            std::vector<_Tp> snapshot() const {
+                std::vector<_Tp> __v;
+                __v.reserve(__size_);
+                snapshot(std::back_inserter(__v));
+                return __v;
+            }
+
+            /** @brief return the memory held by the ring, all of it inside the object */
+            memory_footprint memory_usage() const noexcept {
+                memory_footprint __m;
+                __m.payload_bytes = __size_ * sizeof(_Tp);
+                __m.overhead_bytes = sizeof(*this) - __m.payload_bytes;
+                return __m;
+            }
+
+        private:
+            /* physical index of __i, which is below 2 * _N */
+            static constexpr size_type __wrap(size_type __i) noexcept { return __i >= _N ? __i - _N : __i; }
+
+            _Tp* __slot(size_type __i) noexcept { return std::launder(reinterpret_cast<_Tp*>(__storage_) + __i); }
+            const _Tp* __slot(size_type __i) const noexcept { return std::launder(reinterpret_cast<const _Tp*>(__storage_) + __i); }
+
+            alignas(_Tp) std::byte __storage_[_N * sizeof(_Tp)];    //!< element slots
+            size_type __head_ = 0;                                  //!< slot of the front element
+            size_type __size_ = 0;
+            std::uint64_t __dropped_ = 0;
+    };
+}   /* namespace dsa */
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Construct an element at the back from __args
+**
+** @param[in]
+**      __args: arguments passed to the element constructor
+**
+** @return
+**      true if no element was dropped; false if the ring was full and the oldest
+**      element was overwritten, or the new one discarded under drop_newest
+**
+** @note
+**      Complexity: O(1), never allocates. An overwrite builds the new element
+**      first and move-assigns it over the oldest, so a throwing constructor
+**      leaves the ring unchanged.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N, dsa::ring_overflow _Overflow, class _Policy>
+template <class... _Args>
+bool dsa::ring_buffer<_Tp, _N, _Overflow, _Policy>::emplace_back(_Args&&... __args) {
+    if (__size_ != _N) [[likely]] {
+        ::new (static_cast<void*>(__slot(__wrap(__head_ + __size_)))) _Tp(std::forward<_Args>(__args)...);
+        ++__size_;
+        return true;
+    }
+    if constexpr (_Overflow == ring_overflow::overwrite_oldest) {
+        *__slot(__head_) = _Tp(std::forward<_Args>(__args)...);
+        __head_ = __head_ + 1 == _N ? 0 : __head_ + 1;
+    }
+    ++__dropped_;
+    return false;
+}
+
+#endif /* RING_BUFFER_H */
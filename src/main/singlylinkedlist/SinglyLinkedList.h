@@ -11,6 +11,8 @@
 
 #include <iostream>
 
+#include "MemoryUsage.h"
+
 /** @brief  Struct of singly linked list node  */
 template <class T>
 struct Node {
@@ -29,11 +31,16 @@ struct Node {
 template <class T, bool Const>
 class SinglyLinkedListIterator;
 
-/** @brief  SinglyLinkedList class  */
+/**
+ * @brief  SinglyLinkedList class
+ * @note
+ *          None of its members has a precondition to check, so unlike the dsa containers it
+ *          takes no error policy; insert() with an iterator of another list returns end().
+*/
 template <class T>
 class SinglyLinkedList {
     private:
-        size_t size_;
+        size_t size_ = 0;
         Node<T> *head_ = nullptr;
         Node<T> *tail_ = nullptr;
     public:
@@ -50,6 +57,7 @@ class SinglyLinkedList {
         void addLast(const T& value);
         void addFirst(const T& value);
         iterator insert(const_iterator It, const T& value);
+        dsa::memory_footprint memory_usage() const noexcept;
 
         ~SinglyLinkedList(){
             for (Node<T> *p = head_, *next; p != nullptr; p = next) {
@@ -164,6 +172,27 @@ typename SinglyLinkedList<T>::iterator SinglyLinkedList<T> :: insert(const_itera
     return result;
 }
 
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Report the memory held by the list. Time complexity: O(1)
+**
+** @return
+**       payload, link overhead and estimated allocator slack; every node is one allocation
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class T>
+dsa::memory_footprint SinglyLinkedList<T> :: memory_usage() const noexcept {
+    dsa::memory_footprint usage;
+    usage.payload_bytes = size_ * sizeof(T);
+    usage.overhead_bytes = sizeof(*this) + size_ * (sizeof(Node<T>) - sizeof(T));
+    usage.slack_bytes = size_ * dsa::allocation_slack(sizeof(Node<T>));
+    usage.allocations = size_;
+    return usage;
+}
+
 /** 
  * @brief  
  *          SinglyLinkedListIterator class
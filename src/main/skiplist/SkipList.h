@@ -0,0 +1,853 @@
+/**
+ * @file    SkipList.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A concurrent skip list ordered map (lazy, fine-grained locking).
+*/
+
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <bit>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#include "MemoryUsage.h"
+
+namespace dsa {
+    template <class _Key, class _Tp, class _Compare>
+    class skip_list;
+
+    /**
+     * @brief Base of every skip list node: the tower of forward pointers plus the
+     *      synchronisation state of the lazy skip list algorithm.
+     *
+     * @note
+     *      The head sentinel is a bare __skip_node_base, every other node is a
+     *      __skip_node that also carries the key/value pair.
+    */
+    struct __skip_node_base {
+        using __base_pointer = __skip_node_base*;
+
+        std::atomic<__base_pointer>* __next_;       //!< tower of forward pointers, __height_ entries
+        int __height_;                              //!< number of levels this node is linked in
+        std::atomic<bool> __marked_;                //!< logically removed
+        std::atomic<bool> __fully_linked_;          //!< linked at every level of its tower
+        std::mutex __lock_;                         //!< held while this node is a predecessor being updated
+        __base_pointer __retired_next_;             //!< link in a limbo list once unlinked
+
+        __skip_node_base(std::atomic<__base_pointer>* __tower, int __height) noexcept
+            : __next_{__tower}, __height_{__height}, __marked_{false},
+              __fully_linked_{false}, __retired_next_{nullptr} {
+            for (int __i = 0; __i < __height; ++__i)
+                ::new (static_cast<void*>(__tower + __i)) std::atomic<__base_pointer>(nullptr);
+        }
+    };
+
+    /**
+     * @brief Epoch-based reclamation of the nodes a skip_list unlinks
+     *
+     * @note
+     *      Every operation, and every iterator not at the end, is counted in the bucket of the
+     *      epoch it started in; buckets are striped over cache lines so that readers on
+     *      different cores do not share one counter. A node unlinked in epoch r goes to limbo
+     *      list r % 3 and is freed when the epoch moves from r + 1 to r + 2. The epoch only
+     *      moves from e to e + 1 once the bucket of e - 1 is empty, so by then every
+     *      operation that could have reached the node has finished.
+    */
+    struct __skip_epoch {
+        using __base_pointer = __skip_node_base*;
+        using __pin = std::atomic<long>*;
+
+        static constexpr std::size_t __stripes = 16;
+
+        struct alignas(64) __counter {
+            std::atomic<long> __n_{0};
+        };
+
+        std::atomic<std::uint64_t> __epoch_{0};
+        __counter __active_[2][__stripes];
+        std::atomic<__base_pointer> __limbo_[3] = {};
+
+        /* the stripe of the calling thread, handed out round-robin */
+        static std::size_t __stripe() noexcept {
+            static std::atomic<std::size_t> __next{0};
+            thread_local const std::size_t __s = __next.fetch_add(1, std::memory_order_relaxed) % __stripes;
+            return __s;
+        }
+
+        /** @brief count the caller in the bucket of the current epoch */
+        __pin __enter() noexcept {
+            const std::size_t __s = __stripe();
+            while (true) {
+                const std::uint64_t __e = __epoch_.load();
+                __pin __c = &__active_[__e & 1][__s].__n_;
+                __c->fetch_add(1);
+                if (__epoch_.load() == __e) return __c;
+                __c->fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        static void __leave(__pin __c) noexcept { __c->fetch_sub(1, std::memory_order_release); }
+
+        /** @brief queue a node that no new operation can reach; call it inside an operation */
+        void __retire(__base_pointer __p) noexcept {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::atomic<__base_pointer>& __limbo = __limbo_[__epoch_.load() % 3];
+            __base_pointer __top = __limbo.load(std::memory_order_relaxed);
+            do {
+                __p->__retired_next_ = __top;
+            } while (!__limbo.compare_exchange_weak(__top, __p, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        /**
+         * @brief move to the next epoch if the bucket of the previous one is empty, and pass
+         *      the nodes retired two epochs ago to __free; an operation of the caller that
+         *      is in that bucket only makes the attempt fail
+        */
+        template <class _Free>
+        void __try_advance(_Free&& __free) noexcept {
+            std::uint64_t __e = __epoch_.load();
+            for (const __counter& __c : __active_[(__e + 1) & 1])
+                if (__c.__n_.load() != 0) return;
+            if (__epoch_.compare_exchange_strong(__e, __e + 1))
+                __free(__limbo_[(__e + 2) % 3].exchange(nullptr, std::memory_order_acquire));
+        }
+
+        /** @brief RAII membership of one operation */
+        struct __guard {
+            __pin __c_;
+
+            explicit __guard(__skip_epoch& __d) noexcept : __c_{__d.__enter()} {}
+            __guard(const __guard&) = delete;
+            __guard& operator=(const __guard&) = delete;
+            ~__guard() { __leave(__c_); }
+        };
+    };
+
+    /** @brief Skip list node holding a key/value pair */
+    template <class _Key, class _Tp>
+    struct __skip_node : __skip_node_base {
+        std::pair<const _Key, _Tp> __value_;        //!< data, immutable once published
+
+        template <class... _Args>
+        __skip_node(std::atomic<__base_pointer>* __tower, int __height, _Args&&... __args)
+            : __skip_node_base{__tower, __height}, __value_(std::forward<_Args>(__args)...) {}
+    };
+
+    /**
+     * @brief class const_iterator of skip_list
+     *
+     * @note
+     *      Walks level 0 without taking any lock and skips nodes that are being
+     *      inserted or have been logically removed. The traversal is weakly
+     *      consistent: it never fails, but may or may not observe concurrent updates.
+     *      An iterator that is not at the end holds its list's current epoch, so erased
+     *      nodes are not freed under it; do not keep one for long on a busy list.
+    */
+    template <class _Key, class _Tp>
+    class __skip_list_const_iterator
+    {
+            template <class, class, class>
+            friend class skip_list;
+
+        private:
+            using __base_pointer = __skip_node_base*;
+            using __node_pointer = __skip_node<_Key, _Tp>*;
+            __base_pointer __ptr_;                                      //!< current node, nullptr at the end
+            __skip_epoch::__pin __pin_;                                 //!< epoch bucket held, nullptr at the end
+
+            void __release() noexcept {
+                if (__pin_ != nullptr) __skip_epoch::__leave(__pin_);
+                __pin_ = nullptr;
+            }
+
+            static __base_pointer __skip_unpublished(__base_pointer __p) noexcept {
+                while (__p != nullptr &&
+                       (__p->__marked_.load(std::memory_order_acquire) ||
+                        !__p->__fully_linked_.load(std::memory_order_acquire)))
+                    __p = __p->__next_[0].load(std::memory_order_acquire);
+                return __p;
+            }
+
+        public:
+            using value_type = std::pair<const _Key, _Tp>;              //!< key/value pair
+            using reference = const value_type&;                        //!< reference
+            using pointer = const value_type*;                          //!< pointer
+            using difference_type = std::ptrdiff_t;                     //!< distance
+            using iterator_category = std::forward_iterator_tag;        //!< category
+
+            /** @brief Default constructor */
+            __skip_list_const_iterator() noexcept : __ptr_{nullptr}, __pin_{nullptr} {}
+
+            /**
+             * @brief
+             *      Constructor, positions on the first visible node at or after __p
+             *
+             * @param[in]
+             *      __p: pointer to the node
+             * @param[in]
+             *      __pin: epoch bucket entered before __p was read, owned by the iterator
+            */
+            __skip_list_const_iterator(__base_pointer __p, __skip_epoch::__pin __pin) noexcept
+                : __ptr_{__skip_unpublished(__p)}, __pin_{__pin} {
+                if (__ptr_ == nullptr) __release();
+            }
+
+            /** @brief copy constructor, joins the epoch bucket of __x */
+            __skip_list_const_iterator(const __skip_list_const_iterator& __x) noexcept : __ptr_{__x.__ptr_}, __pin_{__x.__pin_} {
+                if (__pin_ != nullptr) __pin_->fetch_add(1, std::memory_order_relaxed);
+            }
+
+            /** @brief move constructor */
+            __skip_list_const_iterator(__skip_list_const_iterator&& __x) noexcept : __ptr_{__x.__ptr_}, __pin_{__x.__pin_} {
+                __x.__ptr_ = nullptr;
+                __x.__pin_ = nullptr;
+            }
+
+            /** @brief assignment, by copy or move */
+            __skip_list_const_iterator& operator=(__skip_list_const_iterator __x) noexcept {
+                std::swap(__ptr_, __x.__ptr_);
+                std::swap(__pin_, __x.__pin_);
+                return *this;
+            }
+
+            /** @brief destructor, leaves the epoch bucket */
+            ~__skip_list_const_iterator() { __release(); }
+
+            /** @brief return the reference to the current element */
+            reference operator*() const { return static_cast<__node_pointer>(__ptr_)->__value_; }
+
+            /** @brief return the pointer to the current element */
+            pointer operator->() const { return std::addressof(static_cast<__node_pointer>(__ptr_)->__value_); }
+
+            /** @brief pre-increment by one */
+            __skip_list_const_iterator& operator++() {
+                __ptr_ = __skip_unpublished(__ptr_->__next_[0].load(std::memory_order_acquire));
+                if (__ptr_ == nullptr) __release();
+                return *this;
+            }
+
+            /** @brief post-increment by one */
+            __skip_list_const_iterator operator++(int) {
+                __skip_list_const_iterator __t{*this};
+                ++(*this);
+                return __t;
+            }
+
+            /** @brief compare the underlying node */
+            friend bool operator==(const __skip_list_const_iterator& __x, const __skip_list_const_iterator& __y) {
+                return __x.__ptr_ == __y.__ptr_;
+            }
+
+            /** @brief compare the underlying node */
+            friend bool operator!=(const __skip_list_const_iterator& __x, const __skip_list_const_iterator& __y) {
+                return !(__x == __y);
+            }
+    };
+
+    /**
+     * @brief skip_list is an ordered map that can be read and updated by many threads
+     *      at once. It extends the linked-node design of the lists with towers of
+     *      forward pointers.
+     *
+     * @tparam
+     *      _Key the type of keys
+     * @tparam
+     *      _Tp the type of mapped values
+     * @tparam
+     *      _Compare strict weak ordering of the keys
+     *
+     * @note
+     *      insert() and erase() lock only the predecessors of the affected node
+     *      (lazy skip list, Herlihy et al.). find(), contains(), iteration and
+     *      range scans are lock-free.
+     *      A mapped value is immutable once published: to change it, erase the key
+     *      and insert it again.
+     *      Unlinked nodes are freed by epoch-based reclamation (see __skip_epoch) once no
+     *      operation or iterator that started before the unlink is still running, so a
+     *      list that is updated continuously holds only the nodes erased in the last few
+     *      epochs. A thread stalled inside an operation, or an iterator kept alive, delays
+     *      every later release until it finishes.
+    */
+    template <class _Key, class _Tp, class _Compare = std::less<_Key>>
+    class skip_list {
+        public:
+            using key_type = _Key;                                                  //!< key_type
+            using mapped_type = _Tp;                                                //!< mapped_type
+            using value_type = std::pair<const _Key, _Tp>;                          //!< value_type
+            using key_compare = _Compare;                                           //!< key_compare
+            using size_type = std::size_t;                                          //!< size_type
+            using const_iterator = __skip_list_const_iterator<_Key, _Tp>;           //!< const_iterator type
+            using iterator = const_iterator;                                        //!< iterator type, values are read-only
+
+            static constexpr int max_level = 32;                                    //!< height of the head tower
+
+            /** @brief default constructor */
+            explicit skip_list(const _Compare& __comp = _Compare())
+                : __comp_{__comp}, __head_{__head_tower_, max_level}, __size_{0}, __levels_{1} {}
+
+            skip_list(const skip_list&) = delete;
+            skip_list& operator=(const skip_list&) = delete;
+
+            /** @brief default destructor, must not run concurrently with any other member */
+            ~skip_list();
+
+            /** @brief return the number of elements, exact when the list is quiescent */
+            size_type size() const noexcept { return __size_.load(std::memory_order_relaxed); }
+
+            /** @brief check whether the list is empty */
+            bool empty() const noexcept { return size() == 0; }
+
+            /** @brief return an iterator to the smallest key */
+            const_iterator begin() const noexcept {
+                const __skip_epoch::__pin __pin = __reclaim_.__enter();
+                return const_iterator{__head_.__next_[0].load(std::memory_order_acquire), __pin};
+            }
+
+            /** @brief return an iterator past the largest key */
+            const_iterator end() const noexcept { return const_iterator{}; }
+
+            /** @brief return a constant iterator to the smallest key */
+            const_iterator cbegin() const noexcept { return begin(); }
+
+            /** @brief return a constant iterator past the largest key */
+            const_iterator cend() const noexcept { return end(); }
+
+            template <class... _Args>
+            bool emplace(const _Key& __k, _Args&&... __args);
+
+            /**
+             * @brief
+             *      insert the pair (__k, __v) if __k is not present
+             *
+             * @return
+             *      true if inserted, false if the key already exists
+            */
+            bool insert(const _Key& __k, const _Tp& __v) { return emplace(__k, __v); }
+
+            /** @brief insert the pair (__k, __v) if __k is not present */
+            bool insert(const _Key& __k, _Tp&& __v) { return emplace(__k, std::move(__v)); }
+
+            bool erase(const _Key& __k);
+            bool contains(const _Key& __k) const;
+            std::optional<_Tp> find(const _Key& __k) const;
+            const_iterator lower_bound(const _Key& __k) const;
+
+            template <class _Fn>
+            size_type for_each_range(const _Key& __lo, const _Key& __hi, _Fn&& __fn) const;
+
+            size_type reclaim_retired() noexcept;
+
+            memory_footprint memory_usage() const noexcept;
+
+        private:
+            using __base_pointer = __skip_node_base*;
+            using __node = __skip_node<_Key, _Tp>;
+            using __node_pointer = __node*;
+
+            /* Tower storage follows the node in the same allocation */
+            static constexpr std::size_t __tower_offset =
+                (sizeof(__node) + alignof(std::atomic<__base_pointer>) - 1) & ~(alignof(std::atomic<__base_pointer>) - 1);
+
+            _Compare __comp_;
+            std::atomic<__base_pointer> __head_tower_[max_level];
+            mutable __skip_node_base __head_;
+            std::atomic<size_type> __size_;
+            std::atomic<int> __levels_;                                             //!< levels in use, only grows
+            mutable __skip_epoch __reclaim_;
+
+            static const _Key& __key_of(__base_pointer __p) noexcept { return static_cast<__node_pointer>(__p)->__value_.first; }
+
+            static int __random_level() noexcept;
+
+            int __find(const _Key& __k, __base_pointer* __preds, __base_pointer* __succs, int __min_levels = 1) const;
+            static void __unlock_preds(__base_pointer* __preds, int __highest_locked) noexcept;
+
+            template <class... _Args>
+            static __node_pointer __create_node(int __height, _Args&&... __args);
+            static void __destroy_node(__base_pointer __p) noexcept;
+
+            void __retire(__base_pointer __p) noexcept;
+            static size_type __free_chain(__base_pointer __p) noexcept;
+    };
+};      /* namespace dsa */
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Release every node, linked or retired
+**
+** @note
+**       Complexity: O(n)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Compare>
+dsa::skip_list<_Key, _Tp, _Compare>::~skip_list() {
+    reclaim_retired();
+    for (__base_pointer __p = __head_.__next_[0].load(std::memory_order_relaxed), __n; __p != nullptr; __p = __n) {
+        __n = __p->__next_[0].load(std::memory_order_relaxed);
+        __destroy_node(__p);
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Draw a tower height with P(height > h) = 2^-h
+**
+** @return
+**       height in [1, max_level]
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Compare>
+int dsa::skip_list<_Key, _Tp, _Compare>::__random_level() noexcept {
+    /* xorshift32, one state per thread so that concurrent inserts never contend on it */
+    thread_local std::uint32_t __state =
+        static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&__state) >> 4) | 1u;
+    __state ^= __state << 13;
+    __state ^= __state >> 17;
+    __state ^= __state << 5;
+    return 1 + std::countr_zero(__state | (1u << (max_level - 1)));
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Locate the predecessors and successors of __k at every level
+**
+** @param [out]
+**      __preds: last node with a key less than __k, per level
+**
+** @param [out]
+**      __succs: first node with a key not less than __k, per level
+**
+** @param [in]
+**      __min_levels: levels to search at least, for a caller that knows of a taller node
+**
+** @return
+**       the highest level at which a node with key __k was found, -1 if none
+**
+** @note
+**       Starts at the highest level in use rather than at max_level, and fills __preds and
+**       __succs only below it. A node linked concurrently may be taller than the level read
+**       at the start; erase() searches again with its height.
+**       Lock-free. Complexity: O(log n) expected
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Compare>
+int dsa::skip_list<_Key, _Tp, _Compare>::__find(const _Key& __k, __base_pointer* __preds, __base_pointer* __succs, int __min_levels) const {
+    int __found = -1;
+    __base_pointer __pred = &__head_;
+    for (int __level = std::max(__levels_.load(std::memory_order_acquire), __min_levels) - 1; __level >= 0; --__level) {
+        __base_pointer __curr = __pred->__next_[__level].load(std::memory_order_acquire);
+        while (__curr != nullptr && __comp_(__key_of(__curr), __k)) {
+            __pred = __curr;
+            __curr = __pred->__next_[__level].load(std::memory_order_acquire);
+        }
+        if (__found == -1 && __curr != nullptr && !__comp_(__k, __key_of(__curr)))
+            __found = __level;
+        __preds[__level] = __pred;
+        __succs[__level] = __curr;
+    }
+    return __found;
+}
+
+template <class _Key, class _Tp, class _Compare>
+void dsa::skip_list<_Key, _Tp, _Compare>::__unlock_preds(__base_pointer* __preds, int __highest_locked) noexcept {
+    /* A predecessor may repeat on consecutive levels but was locked only once */
+    for (int __level = 0; __level <= __highest_locked; ++__level)
+        if (__level == 0 || __preds[__level] != __preds[__level - 1])
+            __preds[__level]->__lock_.unlock();
+}
+
+template <class _Key, class _Tp, class _Compare>
+template <class... _Args>
+typename dsa::skip_list<_Key, _Tp, _Compare>::__node_pointer
+dsa::skip_list<_Key, _Tp, _Compare>::__create_node(int __height, _Args&&... __args) {
+    void* __mem = ::operator new(__tower_offset + __height * sizeof(std::atomic<__base_pointer>),
+                                 std::align_val_t{alignof(__node)});
+    auto* __tower = reinterpret_cast<std::atomic<__base_pointer>*>(static_cast<char*>(__mem) + __tower_offset);
+    try {
+        return ::new (__mem) __node(__tower, __height, std::forward<_Args>(__args)...);
+    } catch (...) {
+        ::operator delete(__mem, std::align_val_t{alignof(__node)});
+        throw;
+    }
+}
+
+template <class _Key, class _Tp, class _Compare>
+void dsa::skip_list<_Key, _Tp, _Compare>::__destroy_node(__base_pointer __p) noexcept {
+    __node_pointer __n = static_cast<__node_pointer>(__p);
+    __n->~__node();
+    ::operator delete(static_cast<void*>(__n), std::align_val_t{alignof(__node)});
+}
+
+template <class _Key, class _Tp, class _Compare>
+void dsa::skip_list<_Key, _Tp, _Compare>::__retire(__base_pointer __p) noexcept {
+    __reclaim_.__retire(__p);
+    /* Look for a finished epoch every few retirements of this thread, not on every erase */
+    thread_local unsigned __since_advance = 0;
+    if ((++__since_advance & 31) == 0) __reclaim_.__try_advance(__free_chain);
+}
+
+template <class _Key, class _Tp, class _Compare>
+typename dsa::skip_list<_Key, _Tp, _Compare>::size_type
+dsa::skip_list<_Key, _Tp, _Compare>::__free_chain(__base_pointer __p) noexcept {
+    size_type __n = 0;
+    for (__base_pointer __next; __p != nullptr; __p = __next, ++__n) {
+        __next = __p->__retired_next_;
+        __destroy_node(__p);
+    }
+    return __n;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Insert a node with key __k and a value constructed from __args if __k is not present
+**
+** @param [in]
+**      __k: the key
+**
+** @param [in]
+**      __args: arguments forwarded to the constructor of the mapped value
+**
+** @return
+**       true if inserted, false if the key already exists
+**
+** @note
+**       Locks the predecessors of the new node only. Waits for a concurrent insert or erase of
+**       the same key yield the processor rather than spin. Complexity: O(log n) expected
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Compare>
+template <class... _Args>
+bool dsa::skip_list<_Key, _Tp, _Compare>::emplace(const _Key& __k, _Args&&... __args) {
+    __base_pointer __preds[max_level];
+    __base_pointer __succs[max_level];
+    __node_pointer __new_node = nullptr;
+    const int __top_level = __random_level();
+    const __skip_epoch::__guard __guard{__reclaim_};
+
+    /* Raise the levels in use first, so that every search that can meet the node starts high enough */
+    for (int __levels = __levels_.load(std::memory_order_relaxed);
+         __levels < __top_level && !__levels_.compare_exchange_weak(__levels, __top_level, std::memory_order_release);) {}
+
+    while (true) {
+        int __found = __find(__k, __preds, __succs);
+        if (__found != -1) {
+            __base_pointer __node_found = __succs[__found];
+            if (!__node_found->__marked_.load(std::memory_order_acquire)) {
+                /* Wait until the concurrent insert of the same key is visible */
+                while (!__node_found->__fully_linked_.load(std::memory_order_acquire)) std::this_thread::yield();
+                if (__new_node != nullptr) __destroy_node(__new_node);
+                return false;
+            }
+            /* The node is being removed, retry once it is unlinked; let its owner run meanwhile */
+            std::this_thread::yield();
+            continue;
+        }
+
+        if (__new_node == nullptr)
+            __new_node = __create_node(__top_level, std::piecewise_construct,
+                                       std::forward_as_tuple(__k),
+                                       std::forward_as_tuple(std::forward<_Args>(__args)...));
+
+        int __highest_locked = -1;
+        bool __valid = true;
+        __base_pointer __prev_pred = nullptr;
+        for (int __level = 0; __valid && __level < __top_level; ++__level) {
+            __base_pointer __pred = __preds[__level];
+            __base_pointer __succ = __succs[__level];
+            if (__pred != __prev_pred) {
+                __pred->__lock_.lock();
+                __highest_locked = __level;
+                __prev_pred = __pred;
+            }
+            __valid = !__pred->__marked_.load(std::memory_order_acquire) &&
+                      (__succ == nullptr || !__succ->__marked_.load(std::memory_order_acquire)) &&
+                      __pred->__next_[__level].load(std::memory_order_acquire) == __succ;
+        }
+        if (!__valid) {
+            __unlock_preds(__preds, __highest_locked);
+            continue;
+        }
+
+        for (int __level = 0; __level < __top_level; ++__level)
+            __new_node->__next_[__level].store(__succs[__level], std::memory_order_relaxed);
+        for (int __level = 0; __level < __top_level; ++__level)
+            __preds[__level]->__next_[__level].store(__new_node, std::memory_order_release);
+        __new_node->__fully_linked_.store(true, std::memory_order_release);
+        __size_.fetch_add(1, std::memory_order_relaxed);
+
+        __unlock_preds(__preds, __highest_locked);
+        return true;
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Remove the node with key __k
+**
+** @param [in]
+**      __k: the key
+**
+** @return
+**       true if a node was removed, false if the key is not present
+**
+** @note
+**       The node is marked first (logical removal), then unlinked top-down under the
+**       locks of its predecessors and retired to the current epoch.
+**       Complexity: O(log n) expected
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Compare>
+bool dsa::skip_list<_Key, _Tp, _Compare>::erase(const _Key& __k) {
+    __base_pointer __preds[max_level];
+    __base_pointer __succs[max_level];
+    __base_pointer __victim = nullptr;
+    bool __is_marked = false;
+    int __top_level = -1;
+    int __min_levels = 1;
+    const __skip_epoch::__guard __guard{__reclaim_};
+
+    while (true) {
+        int __found = __find(__k, __preds, __succs, __min_levels);
+        if (__found != -1) __victim = __succs[__found];
+
+        /* The search started below the top of a node linked meanwhile: search again from there */
+        if (!__is_marked && __found != -1 && __victim->__height_ - 1 > __found && __min_levels < __victim->__height_ &&
+            __victim->__fully_linked_.load(std::memory_order_acquire)) {
+            __min_levels = __victim->__height_;
+            continue;
+        }
+
+        if (!__is_marked &&
+            (__found == -1 ||
+             !__victim->__fully_linked_.load(std::memory_order_acquire) ||
+             __victim->__height_ - 1 != __found ||
+             __victim->__marked_.load(std::memory_order_acquire)))
+            return false;
+
+        if (!__is_marked) {
+            __top_level = __victim->__height_;
+            __victim->__lock_.lock();
+            if (__victim->__marked_.load(std::memory_order_relaxed)) {
+                __victim->__lock_.unlock();
+                return false;
+            }
+            __victim->__marked_.store(true, std::memory_order_release);
+            __is_marked = true;
+        }
+
+        int __highest_locked = -1;
+        bool __valid = true;
+        __base_pointer __prev_pred = nullptr;
+        for (int __level = 0; __valid && __level < __top_level; ++__level) {
+            __base_pointer __pred = __preds[__level];
+            if (__pred != __prev_pred) {
+                __pred->__lock_.lock();
+                __highest_locked = __level;
+                __prev_pred = __pred;
+            }
+            __valid = !__pred->__marked_.load(std::memory_order_acquire) &&
+                      __pred->__next_[__level].load(std::memory_order_acquire) == __victim;
+        }
+        if (!__valid) {
+            __unlock_preds(__preds, __highest_locked);
+            std::this_thread::yield();
+            continue;
+        }
+
+        for (int __level = __top_level - 1; __level >= 0; --__level)
+            __preds[__level]->__next_[__level].store(__victim->__next_[__level].load(std::memory_order_acquire),
+                                                     std::memory_order_release);
+        __victim->__lock_.unlock();
+        __unlock_preds(__preds, __highest_locked);
+
+        __size_.fetch_sub(1, std::memory_order_relaxed);
+        __retire(__victim);
+        return true;
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Check whether a node with key __k is present
+**
+** @note
+**       Lock-free. Complexity: O(log n) expected
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Compare>
+bool dsa::skip_list<_Key, _Tp, _Compare>::contains(const _Key& __k) const {
+    __base_pointer __preds[max_level];
+    __base_pointer __succs[max_level];
+    const __skip_epoch::__guard __guard{__reclaim_};
+    int __found = __find(__k, __preds, __succs);
+    return __found != -1 &&
+           __succs[__found]->__fully_linked_.load(std::memory_order_acquire) &&
+           !__succs[__found]->__marked_.load(std::memory_order_acquire);
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Return a copy of the value mapped to __k
+**
+** @return
+**       the mapped value, std::nullopt if the key is not present
+**
+** @note
+**       Lock-free. Complexity: O(log n) expected
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Compare>
+std::optional<_Tp> dsa::skip_list<_Key, _Tp, _Compare>::find(const _Key& __k) const {
+    __base_pointer __preds[max_level];
+    __base_pointer __succs[max_level];
+    const __skip_epoch::__guard __guard{__reclaim_};
+    int __found = __find(__k, __preds, __succs);
+    if (__found == -1 ||
+        !__succs[__found]->__fully_linked_.load(std::memory_order_acquire) ||
+        __succs[__found]->__marked_.load(std::memory_order_acquire))
+        return std::nullopt;
+    return static_cast<__node_pointer>(__succs[__found])->__value_.second;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Return an iterator to the first element whose key is not less than __k
+**
+** @note
+**       Lock-free. Complexity: O(log n) expected
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Compare>
+typename dsa::skip_list<_Key, _Tp, _Compare>::const_iterator
+dsa::skip_list<_Key, _Tp, _Compare>::lower_bound(const _Key& __k) const {
+    __base_pointer __preds[max_level];
+    __base_pointer __succs[max_level];
+    const __skip_epoch::__pin __pin = __reclaim_.__enter();
+    __find(__k, __preds, __succs);
+    return const_iterator{__succs[0], __pin};
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Visit, in key order, every element whose key lies in [__lo, __hi)
+**
+** @param [in]
+**      __fn: callable invoked as __fn(const value_type&)
+**
+** @return
+**       the number of visited elements
+**
+** @note
+**       Lock-free. Complexity: O(log n + k) expected
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Compare>
+template <class _Fn>
+typename dsa::skip_list<_Key, _Tp, _Compare>::size_type
+dsa::skip_list<_Key, _Tp, _Compare>::for_each_range(const _Key& __lo, const _Key& __hi, _Fn&& __fn) const {
+    size_type __n = 0;
+    for (const_iterator __it = lower_bound(__lo); __it != end() && __comp_(__it->first, __hi); ++__it, ++__n)
+        __fn(*__it);
+    return __n;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Release the memory of every erased node now, without waiting for the epochs
+**
+** @return
+**       the number of released nodes
+**
+** @note
+**       Only call this while no other thread is using the list and no iterator into it is
+**       alive: a concurrent reader may still be standing on a retired node. Erased nodes
+**       are released automatically otherwise, this only shortens the wait.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Compare>
+typename dsa::skip_list<_Key, _Tp, _Compare>::size_type
+dsa::skip_list<_Key, _Tp, _Compare>::reclaim_retired() noexcept {
+    size_type __n = 0;
+    for (std::atomic<__base_pointer>& __limbo : __reclaim_.__limbo_)
+        __n += __free_chain(__limbo.exchange(nullptr, std::memory_order_acquire));
+    return __n;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Report the memory held by the list, retired nodes included
+**
+** @return
+**       payload, towers, node headers and estimated allocator slack
+**
+** @note
+**       Complexity: O(n). Walks the bottom level and the limbo lists, so the result is exact
+**       only when the list is quiescent.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Tp, class _Compare>
+dsa::memory_footprint dsa::skip_list<_Key, _Tp, _Compare>::memory_usage() const noexcept {
+    memory_footprint __m;
+    __m.overhead_bytes = sizeof(*this);
+    auto __account = [&__m](__base_pointer __p, bool __linked) {
+        const std::size_t __bytes = __tower_offset + __p->__height_ * sizeof(std::atomic<__base_pointer>);
+        const std::size_t __payload = __linked ? sizeof(value_type) : 0;
+        __m.payload_bytes += __payload;
+        __m.overhead_bytes += __bytes - __payload;
+        __m.slack_bytes += allocation_slack(__bytes, alignof(__node));
+        ++__m.allocations;
+    };
+    for (__base_pointer __p = __head_.__next_[0].load(std::memory_order_acquire); __p != nullptr;
+         __p = __p->__next_[0].load(std::memory_order_acquire))
+        __account(__p, true);
+    for (const std::atomic<__base_pointer>& __limbo : __reclaim_.__limbo_)
+        for (__base_pointer __p = __limbo.load(std::memory_order_acquire); __p != nullptr; __p = __p->__retired_next_)
+            __account(__p, false);
+    return __m;
+}
+#endif /* SKIP_LIST_H */
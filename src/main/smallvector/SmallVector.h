@@ -0,0 +1,480 @@
+/**
+ * @file    SmallVector.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A vector that keeps its first N elements inline and spills to the heap beyond that
+*/
+
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "Algorithm.h"
+#include "ErrorPolicy.h"
+#include "MemoryUsage.h"
+#include "TypeTraits.h"
+
+namespace dsa {
+    /**
+     * @brief small_vector is a contiguous sequence with storage for _N elements inside the
+     *      object. It allocates only when it grows past _N, so a short-lived small_vector
+     *      that stays within _N costs no allocation at all.
+     *
+     * @tparam
+     *      _Tp the type of stored element
+     * @tparam
+     *      _N number of elements stored inline
+     * @tparam
+     *      _Policy what front/back/pop_back on an empty vector do, see ErrorPolicy.h;
+     *      at() always throws
+     *
+     * @note
+     *      Iterators are pointers. A move from an inline small_vector moves the elements one
+     *      by one (one memcpy for a trivially relocatable _Tp); a move from a spilled one
+     *      takes over its heap buffer. The buffer is never given back to the inline storage
+     *      except by shrink_to_fit().
+    */
+    template <class _Tp, std::size_t _N, class _Policy = unchecked_policy>
+    class small_vector {
+        static_assert(_N > 0, "small_vector needs an inline capacity");
+        static_assert(dsa::error_policy<_Policy>, "_Policy must be an error policy");
+
+        public:
+            using value_type = _Tp;                                     //!< value_type
+            using size_type = std::size_t;                              //!< size_type
+            using difference_type = std::ptrdiff_t;                     //!< difference_type
+            using reference = _Tp&;                                     //!< reference
+            using const_reference = const _Tp&;                         //!< const_reference
+            using pointer = _Tp*;                                       //!< pointer
+            using const_pointer = const _Tp*;                           //!< const_pointer
+            using iterator = _Tp*;                                      //!< iterator type
+            using const_iterator = const _Tp*;                          //!< const_iterator type
+            using error_policy = _Policy;                               //!< precondition policy
+
+            /** @brief number of elements stored inline */
+            static constexpr size_type inline_capacity = _N;
+
+            /** @brief default constructor, does not allocate */
+            small_vector() noexcept : __data_{__inline_data()}, __size_{0}, __capacity_{_N} {}
+
+            /** @brief construct with the elements of the initializer list */
+            small_vector(std::initializer_list<_Tp> __il) : small_vector() {
+                reserve(__il.size());
+                for (const _Tp& __v : __il) emplace_back(__v);
+            }
+
+            /** @brief copy constructor */
+            small_vector(const small_vector& __x) : small_vector() {
+                reserve(__x.__size_);
+                if constexpr (std::is_trivially_copyable_v<_Tp>) {
+                    if (__x.__size_ != 0) std::memcpy(static_cast<void*>(__data_), __x.__data_, __x.__size_ * sizeof(_Tp));
+                    __size_ = __x.__size_;
+                } else {
+                    for (const _Tp& __v : __x) emplace_back(__v);
+                }
+            }
+
+            /** @brief move constructor */
+            small_vector(small_vector&& __x) noexcept(std::is_nothrow_move_constructible_v<_Tp>) : small_vector() {
+                __take(__x);
+            }
+
+            /** @brief copy assignment operator */
+            small_vector& operator=(const small_vector& __x) {
+                if (this != &__x) {
+                    clear();
+                    reserve(__x.__size_);
+                    for (const _Tp& __v : __x) emplace_back(__v);
+                }
+                return *this;
+            }
+
+            /** @brief move assignment operator */
+            small_vector& operator=(small_vector&& __x) noexcept(std::is_nothrow_move_constructible_v<_Tp>) {
+                if (this != &__x) {
+                    clear();
+                    __release();
+                    __take(__x);
+                }
+                return *this;
+            }
+
+            /** @brief default destructor */
+            ~small_vector() {
+                clear();
+                __release();
+            }
+
+            /** @brief return the number of elements */
+            size_type size() const noexcept { return __size_; }
+
+            /** @brief check whether the vector is empty */
+            bool empty() const noexcept { return __size_ == 0; }
+
+            /** @brief return the number of elements that fit without reallocating */
+            size_type capacity() const noexcept { return __capacity_; }
+
+            /** @brief check whether the elements are stored inline */
+            bool is_inline() const noexcept { return __data_ == __inline_data(); }
+
+            /** @brief check whether __x and __y hold equal elements, see dsa::equal() */
+            friend bool operator==(const small_vector& __x, const small_vector& __y) { return dsa::equal(__x, __y); }
+
+            /** @brief return a pointer to the first element */
+            pointer data() noexcept { return __data_; }
+
+            /** @brief return a constant pointer to the first element */
+            const_pointer data() const noexcept { return __data_; }
+
+            /** @brief return an iterator to the first element */
+            iterator begin() noexcept { return __data_; }
+
+            /** @brief return an iterator to the end */
+            iterator end() noexcept { return __data_ + __size_; }
+
+            /** @brief return a constant iterator to the first element */
+            const_iterator begin() const noexcept { return __data_; }
+
+            /** @brief return a constant iterator to the end */
+            const_iterator end() const noexcept { return __data_ + __size_; }
+
+            /** @brief return a constant iterator to the first element */
+            const_iterator cbegin() const noexcept { return __data_; }
+
+            /** @brief return a constant iterator to the end */
+            const_iterator cend() const noexcept { return __data_ + __size_; }
+
+            /** @brief return a reference to the element at position __i, no bounds checking */
+            reference operator[](size_type __i) noexcept { return __data_[__i]; }
+
+            /** @brief return a constant reference to the element at position __i, no bounds checking */
+            const_reference operator[](size_type __i) const noexcept { return __data_[__i]; }
+
+            /** @brief return a reference to the element at position __i, throw std::out_of_range if out of bounds */
+            reference at(size_type __i) {
+                if (__i >= __size_) throw std::out_of_range("Index out of range");
+                return __data_[__i];
+            }
+
+            /** @brief return a constant reference to the element at position __i, throw std::out_of_range if out of bounds */
+            const_reference at(size_type __i) const {
+                if (__i >= __size_) throw std::out_of_range("Index out of range");
+                return __data_[__i];
+            }
+
+            /** @brief return a reference to the first element */
+            reference front() noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "Empty small_vector");
+                return __data_[0];
+            }
+
+            /** @brief return a constant reference to the first element */
+            const_reference front() const noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "Empty small_vector");
+                return __data_[0];
+            }
+
+            /** @brief return a reference to the last element */
+            reference back() noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "Empty small_vector");
+                return __data_[__size_ - 1];
+            }
+
+            /** @brief return a constant reference to the last element */
+            const_reference back() const noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "Empty small_vector");
+                return __data_[__size_ - 1];
+            }
+
+            /** @brief append a copy of __x */
+            void push_back(const _Tp& __x) { emplace_back(__x); }
+
+            /** @brief append __x */
+            void push_back(_Tp&& __x) { emplace_back(std::move(__x)); }
+
+            /**
+             * @brief
+             *      construct an element at the end from __args
+             *
+             * @return
+             *      reference to the new element
+             *
+             * @note
+             *      Complexity: O(1) amortized. Strong exception guarantee.
+            */
+            template <class... _Args>
+            reference emplace_back(_Args&&... __args) {
+                if (__size_ == __capacity_) [[unlikely]] return __emplace_back_slow(std::forward<_Args>(__args)...);
+                _Tp* __slot = ::new (static_cast<void*>(__data_ + __size_)) _Tp(std::forward<_Args>(__args)...);
+                ++__size_;
+                return *__slot;
+            }
+
+            /** @brief remove the last element, see _Policy for an empty vector */
+            void pop_back() noexcept(_Policy::is_nothrow) {
+                _Policy::require(__size_ != 0, "Empty small_vector");
+                std::destroy_at(__data_ + --__size_);
+            }
+
+            /** @brief remove and return the last element, std::nullopt if the vector is empty */
+            std::optional<_Tp> try_pop_back() noexcept(std::is_nothrow_move_constructible_v<_Tp>) {
+                if (__size_ == 0) return std::nullopt;
+                std::optional<_Tp> __v{std::move(__data_[__size_ - 1])};
+                std::destroy_at(__data_ + --__size_);
+                return __v;
+            }
+
+            /** @brief remove every element, the capacity is kept */
+            void clear() noexcept {
+                std::destroy(__data_, __data_ + __size_);
+                __size_ = 0;
+            }
+
+            /**
+             * @brief
+             *      remove the elements past the first __n, if any; the capacity is kept
+             *
+             * @note
+             *      Complexity: O(1) for a trivially destructible _Tp, O(size() - __n) otherwise
+            */
+            void truncate(size_type __n) noexcept {
+                if (__n >= __size_) return;
+                std::destroy(__data_ + __n, __data_ + __size_);
+                __size_ = __n;
+            }
+
+            void reserve(size_type __n);
+            void shrink_to_fit();
+
+            memory_footprint memory_usage() const noexcept;
+
+        private:
+            using __alloc_traits = std::allocator_traits<std::allocator<_Tp>>;
+
+            _Tp* __data_;                       //!< __inline_data() or a heap buffer of __capacity_ elements
+            size_type __size_;                  //!< number of elements
+            size_type __capacity_;              //!< _N while inline
+            alignas(_Tp) std::byte __inline_[_N * sizeof(_Tp)];     //!< inline storage
+
+            _Tp* __inline_data() noexcept { return std::launder(reinterpret_cast<_Tp*>(__inline_)); }
+            const _Tp* __inline_data() const noexcept { return std::launder(reinterpret_cast<const _Tp*>(__inline_)); }
+
+            template <class... _Args>
+            reference __emplace_back_slow(_Args&&... __args);
+
+            void __reallocate(size_type __cap);
+            void __take(small_vector& __x) noexcept(std::is_nothrow_move_constructible_v<_Tp>);
+            void __release() noexcept;
+            static void __relocate(_Tp* __from, size_type __n, _Tp* __to) noexcept(std::is_nothrow_move_constructible_v<_Tp>);
+    };
+}   /* namespace dsa */
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Move __n elements from __from to the raw storage __to and destroy the sources
+**
+** @note
+**       One memcpy for a trivially relocatable _Tp. Otherwise the elements are moved, or
+**       copied when the move constructor may throw and a copy constructor exists, so a
+**       failure leaves the sources untouched.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N, class _Policy>
+void dsa::small_vector<_Tp, _N, _Policy>::__relocate(_Tp* __from, size_type __n, _Tp* __to) noexcept(std::is_nothrow_move_constructible_v<_Tp>) {
+    if constexpr (is_trivially_relocatable_v<_Tp>) {
+        if (__n != 0) std::memcpy(static_cast<void*>(__to), static_cast<const void*>(__from), __n * sizeof(_Tp));
+    } else {
+        if constexpr (std::is_nothrow_move_constructible_v<_Tp> || !std::is_copy_constructible_v<_Tp>) {
+            std::uninitialized_move_n(__from, __n, __to);
+        } else {
+            std::uninitialized_copy_n(__from, __n, __to);
+        }
+        std::destroy_n(__from, __n);
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Move the elements to a heap buffer of __cap elements, __cap >= size()
+**
+** @note
+**       Complexity: O(n). Strong exception guarantee.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N, class _Policy>
+void dsa::small_vector<_Tp, _N, _Policy>::__reallocate(size_type __cap) {
+    typename __alloc_traits::allocator_type __a;
+    _Tp* __buffer = __alloc_traits::allocate(__a, __cap);
+    try {
+        __relocate(__data_, __size_, __buffer);
+    } catch (...) {
+        __alloc_traits::deallocate(__a, __buffer, __cap);
+        throw;
+    }
+    __release();
+    __data_ = __buffer;
+    __capacity_ = __cap;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      emplace_back() into a full vector: grow geometrically, constructing the new element
+**      before the old ones move so that __args may refer to one of them
+**
+** @note
+**       Complexity: O(n). Strong exception guarantee.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N, class _Policy>
+template <class... _Args>
+typename dsa::small_vector<_Tp, _N, _Policy>::reference dsa::small_vector<_Tp, _N, _Policy>::__emplace_back_slow(_Args&&... __args) {
+    const size_type __cap = 2 * __capacity_;
+    typename __alloc_traits::allocator_type __a;
+    _Tp* __buffer = __alloc_traits::allocate(__a, __cap);
+    _Tp* __slot = __buffer + __size_;
+    try {
+        ::new (static_cast<void*>(__slot)) _Tp(std::forward<_Args>(__args)...);
+    } catch (...) {
+        __alloc_traits::deallocate(__a, __buffer, __cap);
+        throw;
+    }
+    try {
+        __relocate(__data_, __size_, __buffer);
+    } catch (...) {
+        std::destroy_at(__slot);
+        __alloc_traits::deallocate(__a, __buffer, __cap);
+        throw;
+    }
+    __release();
+    __data_ = __buffer;
+    __capacity_ = __cap;
+    ++__size_;
+    return *__slot;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Make room for __n elements
+**
+** @param [in]
+**      __n: number of elements
+**
+** @note
+**       Does nothing when __n fits in the current capacity, the inline storage included.
+**       Complexity: O(n)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N, class _Policy>
+void dsa::small_vector<_Tp, _N, _Policy>::reserve(size_type __n) {
+    if (__n > __capacity_) __reallocate(std::max(__n, 2 * __capacity_));
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Give back unused heap capacity; the elements return to the inline storage when they fit
+**
+** @note
+**       Complexity: O(n)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N, class _Policy>
+void dsa::small_vector<_Tp, _N, _Policy>::shrink_to_fit() {
+    if (is_inline() || __size_ == __capacity_) return;
+    if (__size_ > _N) {
+        __reallocate(__size_);
+        return;
+    }
+    _Tp* __heap = __data_;
+    __relocate(__heap, __size_, __inline_data());
+    typename __alloc_traits::allocator_type __a;
+    __alloc_traits::deallocate(__a, __heap, __capacity_);
+    __data_ = __inline_data();
+    __capacity_ = _N;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Take the elements of __x, which is left empty; this vector must be empty and inline
+**
+** @note
+**       O(1) when __x is on the heap, O(size) when __x is inline
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N, class _Policy>
+void dsa::small_vector<_Tp, _N, _Policy>::__take(small_vector& __x) noexcept(std::is_nothrow_move_constructible_v<_Tp>) {
+    if (__x.is_inline()) {
+        __relocate(__x.__data_, __x.__size_, __data_);
+    } else {
+        __data_ = __x.__data_;
+        __capacity_ = __x.__capacity_;
+        __x.__data_ = __x.__inline_data();
+        __x.__capacity_ = _N;
+    }
+    __size_ = __x.__size_;
+    __x.__size_ = 0;
+}
+
+/* Free the heap buffer, if any. The elements must have been destroyed or relocated. */
+template <class _Tp, std::size_t _N, class _Policy>
+void dsa::small_vector<_Tp, _N, _Policy>::__release() noexcept {
+    if (!is_inline()) {
+        typename __alloc_traits::allocator_type __a;
+        __alloc_traits::deallocate(__a, __data_, __capacity_);
+        __data_ = __inline_data();
+        __capacity_ = _N;
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Report the memory held by the vector
+**
+** @return
+**       payload, unused inline and heap capacity, and the heap buffer's allocator slack
+**
+** @note
+**       Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Tp, std::size_t _N, class _Policy>
+dsa::memory_footprint dsa::small_vector<_Tp, _N, _Policy>::memory_usage() const noexcept {
+    memory_footprint __m;
+    __m.payload_bytes = __size_ * sizeof(_Tp);
+    __m.overhead_bytes = sizeof(*this) - __m.payload_bytes;
+    if (!is_inline()) __m += __heap_block(__capacity_ * sizeof(_Tp), alignof(_Tp));
+    return __m;
+}
+#endif /* SMALL_VECTOR_H */
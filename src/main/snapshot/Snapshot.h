@@ -0,0 +1,594 @@
+/**
+ * @file    Snapshot.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   Versioned binary snapshots of the dsa containers, written and restored in bulk
+*/
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <algorithm>
+#include <cerrno>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "AdaptorAccess.h"
+#include "Checksum.h"
+
+namespace dsa {
+    /**
+     * @brief bytes of one element, filled by snapshot_traits<T>::write()
+    */
+    class snapshot_writer {
+        public:
+            explicit snapshot_writer(std::vector<std::byte>& __buf) noexcept : __buf_{__buf} {}
+
+            /** @brief append __n bytes at __p */
+            void write(const void* __p, std::size_t __n) {
+                const std::byte* __b = static_cast<const std::byte*>(__p);
+                __buf_.insert(__buf_.end(), __b, __b + __n);
+            }
+
+            /** @brief append the bytes of __v */
+            template <class _Up>
+                requires std::is_trivially_copyable_v<_Up>
+            void write(const _Up& __v) { write(std::addressof(__v), sizeof(_Up)); }
+
+        private:
+            std::vector<std::byte>& __buf_;     //!< payload of the chunk being written
+    };
+
+    /**
+     * @brief bytes of a chunk, consumed by snapshot_traits<T>::read()
+     *
+     * @note
+     *      Reading past the chunk throws std::runtime_error.
+    */
+    class snapshot_reader {
+        public:
+            snapshot_reader(const std::byte* __p, std::size_t __n) noexcept : __p_{__p}, __end_{__p + __n} {}
+
+            /** @brief copy the next __n bytes to __dst */
+            void read(void* __dst, std::size_t __n) {
+                std::memcpy(__dst, take(__n), __n);
+            }
+
+            /** @brief return the next value of type _Up */
+            template <class _Up>
+                requires std::is_trivially_copyable_v<_Up> && std::is_default_constructible_v<_Up>
+            _Up read() {
+                _Up __v;
+                read(std::addressof(__v), sizeof(_Up));
+                return __v;
+            }
+
+            /** @brief return a pointer to the next __n bytes and skip them */
+            const std::byte* take(std::size_t __n) {
+                if (__n > remaining()) throw std::runtime_error("snapshot: element runs past its chunk");
+                const std::byte* __p = __p_;
+                __p_ += __n;
+                return __p;
+            }
+
+            /** @brief return the bytes left in the chunk */
+            std::size_t remaining() const noexcept { return static_cast<std::size_t>(__end_ - __p_); }
+
+        private:
+            const std::byte* __p_;              //!< next unread byte
+            const std::byte* __end_;            //!< end of the chunk
+    };
+
+    /**
+     * @brief customization point for the snapshot format of an element type
+     *
+     * Trivially copyable types need no specialization: their bytes are written as is, in
+     * contiguous blocks. Other types specialize snapshot_traits with
+     *
+     *      static constexpr std::uint32_t version = ...;          // optional, defaults to 0
+     *      static void write(snapshot_writer& __w, const T& __v);
+     *      static T read(snapshot_reader& __r);
+     *
+     * A trivially copyable type may specialize it too, e.g. to drop padding. The version is
+     * stored in the snapshot and load_snapshot() rejects a snapshot of another version.
+    */
+    template <class _Tp>
+    struct snapshot_traits {};
+
+    /** @brief std::string as a 64-bit length and its characters */
+    template <>
+    struct snapshot_traits<std::string> {
+        static constexpr std::uint32_t version = 0;
+
+        static void write(snapshot_writer& __w, const std::string& __s) {
+            __w.write(static_cast<std::uint64_t>(__s.size()));
+            __w.write(__s.data(), __s.size());
+        }
+
+        static std::string read(snapshot_reader& __r) {
+            const std::uint64_t __n = __r.read<std::uint64_t>();
+            const std::byte* __p = __r.take(__n);
+            return std::string{reinterpret_cast<const char*>(__p), static_cast<std::size_t>(__n)};
+        }
+    };
+
+    /** @brief an element type written through snapshot_traits<T>::write() */
+    template <class _Tp>
+    concept __custom_snapshot = requires(snapshot_writer& __w, snapshot_reader& __r, const _Tp& __v) {
+        snapshot_traits<_Tp>::write(__w, __v);
+        { snapshot_traits<_Tp>::read(__r) } -> std::convertible_to<_Tp>;
+    };
+
+    /** @brief an element type save_snapshot() can write */
+    template <class _Tp>
+    concept snapshottable = __custom_snapshot<_Tp> || std::is_trivially_copyable_v<_Tp>;
+
+    /** @brief layout of the snapshot format; every field is little-endian as in memory */
+    struct __snapshot_format {
+        static constexpr char __magic[8] = {'D', 'S', 'A', 'S', 'N', 'A', 'P', '1'};
+        static constexpr std::uint32_t __version = 2;
+        static constexpr std::uint32_t __bitwise_flag = 1;          // flag: elements stored as raw bytes
+        static constexpr std::size_t __align = 16;                  // payloads start and end on this boundary
+        static constexpr std::size_t __chunk_bytes = 1 << 16;       // target payload size of a chunk
+        static constexpr std::size_t __zero_copy_run = 512;         // contiguous runs this long are not gathered
+        static constexpr std::uint64_t __max_bytes = std::uint64_t{1} << 40;   // larger sizes are taken as corruption
+
+        struct __header {
+            char __magic_[8];
+            std::uint32_t __format_version_;
+            std::uint32_t __flags_;
+            std::uint32_t __type_version_;
+            std::uint32_t __element_size_;
+            std::uint64_t __count_;
+            std::uint32_t __crc_;                                   // crc32 of the fields above
+            std::uint32_t __reserved_;
+            std::uint64_t __reserved2_;
+        };
+
+        struct __chunk {
+            std::uint64_t __count_;                                 // elements in the chunk
+            std::uint64_t __bytes_;                                 // payload bytes, padding excluded
+            std::uint32_t __crc_;                                   // crc32 of the payload
+            std::uint32_t __reserved_;
+            std::uint64_t __reserved2_;
+        };
+
+        static_assert(sizeof(__header) == 48 && sizeof(__chunk) == 32, "snapshot headers must keep payloads aligned");
+
+        static std::uint32_t __header_crc(const __header& __h) noexcept { return crc32(&__h, offsetof(__header, __crc_)); }
+
+        static constexpr std::size_t __padded(std::size_t __n) noexcept { return (__n + __align - 1) & ~(__align - 1); }
+
+        template <class _Tp>
+        static constexpr bool __is_bitwise = !__custom_snapshot<_Tp>;
+
+        template <class _Tp>
+        static constexpr std::uint32_t __type_version() noexcept {
+            if constexpr (requires { snapshot_traits<_Tp>::version; }) return snapshot_traits<_Tp>::version;
+            else return 0;
+        }
+
+        template <class _Tp>
+        static constexpr std::size_t __per_chunk = std::max<std::size_t>(1, __chunk_bytes / sizeof(_Tp));
+
+        [[noreturn]] static void __throw_errno(const char* __what) {
+            throw std::system_error(errno, std::generic_category(), __what);
+        }
+    };
+
+    /** @brief writes to a std::ostream */
+    struct __snapshot_stream_sink {
+        std::ostream& __os_;
+
+        void __write(iovec* __v, std::size_t __n) {
+            for (std::size_t __i = 0; __i < __n; ++__i)
+                __os_.write(static_cast<const char*>(__v[__i].iov_base), static_cast<std::streamsize>(__v[__i].iov_len));
+            if (!__os_) throw std::runtime_error("snapshot: stream write failed");
+        }
+    };
+
+    /** @brief writes to a file descriptor with writev() */
+    struct __snapshot_fd_sink {
+        int __fd_;
+
+        void __write(iovec* __v, std::size_t __n) {
+            constexpr std::size_t __iov_max = 1024;
+            while (__n != 0) {
+                const ssize_t __w = ::writev(__fd_, __v, static_cast<int>(std::min(__n, __iov_max)));
+                if (__w < 0) {
+                    if (errno == EINTR) continue;
+                    __snapshot_format::__throw_errno("snapshot: writev");
+                }
+                std::size_t __k = static_cast<std::size_t>(__w);
+                while (__n != 0 && __k >= __v->iov_len) {
+                    __k -= __v->iov_len;
+                    ++__v;
+                    --__n;
+                }
+                if (__n != 0) {
+                    __v->iov_base = static_cast<char*>(__v->iov_base) + __k;
+                    __v->iov_len -= __k;
+                }
+            }
+        }
+    };
+
+    /** @brief reads from a std::istream into a scratch buffer */
+    struct __snapshot_stream_source {
+        std::istream& __is_;
+
+        const std::byte* __take(std::size_t __n, std::vector<std::byte>& __scratch) {
+            __scratch.resize(__n);
+            __is_.read(reinterpret_cast<char*>(__scratch.data()), static_cast<std::streamsize>(__n));
+            if (static_cast<std::size_t>(__is_.gcount()) != __n) throw std::runtime_error("snapshot: truncated");
+            return __scratch.data();
+        }
+
+        /* A stream does not tell how much is left */
+        std::uint64_t __remaining() const noexcept { return __snapshot_format::__max_bytes; }
+    };
+
+    /** @brief reads from a file descriptor into a scratch buffer */
+    struct __snapshot_fd_source {
+        int __fd_;
+
+        const std::byte* __take(std::size_t __n, std::vector<std::byte>& __scratch) {
+            __scratch.resize(__n);
+            for (std::size_t __done = 0; __done < __n;) {
+                const ssize_t __r = ::read(__fd_, __scratch.data() + __done, __n - __done);
+                if (__r < 0) {
+                    if (errno == EINTR) continue;
+                    __snapshot_format::__throw_errno("snapshot: read");
+                }
+                if (__r == 0) throw std::runtime_error("snapshot: truncated");
+                __done += static_cast<std::size_t>(__r);
+            }
+            return __scratch.data();
+        }
+
+        /* Bytes left in a regular file; a pipe or socket does not tell */
+        std::uint64_t __remaining() const noexcept {
+            struct stat __st;
+            const off_t __at = ::lseek(__fd_, 0, SEEK_CUR);
+            if (__at < 0 || ::fstat(__fd_, &__st) != 0 || !S_ISREG(__st.st_mode)) return __snapshot_format::__max_bytes;
+            return __st.st_size > __at ? static_cast<std::uint64_t>(__st.st_size - __at) : 0;
+        }
+    };
+
+    /** @brief reads in place from memory, such as a mapped file */
+    struct __snapshot_memory_source {
+        const std::byte* __p_;
+        const std::byte* __end_;
+
+        const std::byte* __take(std::size_t __n, std::vector<std::byte>&) {
+            if (__n > static_cast<std::size_t>(__end_ - __p_)) throw std::runtime_error("snapshot: truncated");
+            const std::byte* __p = __p_;
+            __p_ += __n;
+            return __p;
+        }
+
+        std::uint64_t __remaining() const noexcept { return static_cast<std::uint64_t>(__end_ - __p_); }
+    };
+
+    template <class _Sink, class _Container>
+    void __save_snapshot(_Sink& __sink, const _Container& __c);
+
+    template <class _Source, class _Container>
+    void __load_snapshot(_Source& __src, _Container& __c);
+
+    /**
+     * @brief write the elements of __c to __os
+     *
+     * @note
+     *      __c is a doubly_linked_list, deque, small_vector, stack, queue or any container
+     *      with begin(), end(), size() and push_back() whose value_type is snapshottable.
+     *      Throws std::runtime_error if the stream fails.
+    */
+    template <class _Container>
+    void save_snapshot(std::ostream& __os, const _Container& __c) {
+        __snapshot_stream_sink __sink{__os};
+        __save_snapshot(__sink, __c);
+    }
+
+    /** @brief write the elements of __c to the file descriptor __fd with writev() */
+    template <class _Container>
+    void save_snapshot(int __fd, const _Container& __c) {
+        __snapshot_fd_sink __sink{__fd};
+        __save_snapshot(__sink, __c);
+    }
+
+    /**
+     * @brief write the elements of __c to the file __p, replacing it atomically
+     *
+     * @note
+     *      The snapshot is written to __p with ".tmp" appended, synced and renamed over __p,
+     *      and the directory is synced after the rename, so a crash leaves either the old or
+     *      the new snapshot. Throws std::system_error.
+    */
+    template <class _Container>
+    void save_snapshot(const std::filesystem::path& __p, const _Container& __c) {
+        std::filesystem::path __tmp = __p;
+        __tmp += ".tmp";
+        const int __fd = ::open(__tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (__fd < 0) __snapshot_format::__throw_errno("snapshot: open");
+        try {
+            save_snapshot(__fd, __c);
+            if (::fsync(__fd) != 0) __snapshot_format::__throw_errno("snapshot: fsync");
+        } catch (...) {
+            ::close(__fd);
+            ::unlink(__tmp.c_str());
+            throw;
+        }
+        ::close(__fd);
+        std::filesystem::rename(__tmp, __p);
+
+        const std::filesystem::path __dir = __p.has_parent_path() ? __p.parent_path() : std::filesystem::path{"."};
+        const int __dfd = ::open(__dir.c_str(), O_RDONLY | O_DIRECTORY);
+        if (__dfd < 0) __snapshot_format::__throw_errno("snapshot: open directory");
+        const int __r = ::fsync(__dfd);
+        const int __e = errno;
+        ::close(__dfd);
+        if (__r != 0) {
+            errno = __e;
+            __snapshot_format::__throw_errno("snapshot: fsync directory");
+        }
+    }
+
+    /**
+     * @brief replace the contents of __c with the snapshot read from __is
+     *
+     * @note
+     *      Throws std::runtime_error on a malformed, truncated or corrupted snapshot, or one
+     *      of another element type or version; __c is then unchanged.
+    */
+    template <class _Container>
+    void load_snapshot(std::istream& __is, _Container& __c) {
+        __snapshot_stream_source __src{__is};
+        __load_snapshot(__src, __c);
+    }
+
+    /** @brief replace the contents of __c with the snapshot read from the file descriptor __fd */
+    template <class _Container>
+    void load_snapshot(int __fd, _Container& __c) {
+        __snapshot_fd_source __src{__fd};
+        __load_snapshot(__src, __c);
+    }
+
+    /**
+     * @brief replace the contents of __c with the snapshot in the file __p
+     *
+     * @note
+     *      The file is mapped, so bitwise elements are copied straight from the page cache
+     *      into the container. Throws std::system_error if the file cannot be mapped.
+    */
+    template <class _Container>
+    void load_snapshot(const std::filesystem::path& __p, _Container& __c) {
+        const int __fd = ::open(__p.c_str(), O_RDONLY);
+        if (__fd < 0) __snapshot_format::__throw_errno("snapshot: open");
+        struct stat __st;
+        if (::fstat(__fd, &__st) != 0) {
+            const int __e = errno;
+            ::close(__fd);
+            errno = __e;
+            __snapshot_format::__throw_errno("snapshot: stat");
+        }
+        const std::size_t __bytes = static_cast<std::size_t>(__st.st_size);
+        if (__bytes == 0) {
+            ::close(__fd);
+            throw std::runtime_error("snapshot: truncated");
+        }
+        void* __m = ::mmap(nullptr, __bytes, PROT_READ, MAP_PRIVATE, __fd, 0);
+        const int __e = errno;
+        ::close(__fd);                          /* the mapping keeps the file open */
+        if (__m == MAP_FAILED) {
+            errno = __e;
+            __snapshot_format::__throw_errno("snapshot: mmap");
+        }
+        ::madvise(__m, __bytes, MADV_SEQUENTIAL);
+        const std::byte* __b = static_cast<const std::byte*>(__m);
+        __snapshot_memory_source __src{__b, __b + __bytes};
+        try {
+            __load_snapshot(__src, __c);
+        } catch (...) {
+            ::munmap(__m, __bytes);
+            throw;
+        }
+        ::munmap(__m, __bytes);
+    }
+}   /* namespace dsa */
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Write a header and the elements of __c in chunks of about 64 KiB, each with its own
+**      header and CRC-32
+**
+** @param [in]
+**      __sink: stream or file descriptor
+**
+** @param [in]
+**      __c: container or container adaptor
+**
+** @note
+**       Bitwise elements are not serialized one by one: contiguous runs of at least 512 bytes,
+**       such as deque blocks, are handed to writev() in place and shorter runs, such as list
+**       nodes, are gathered into one buffer per chunk. Complexity: O(size())
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Sink, class _Container>
+void dsa::__save_snapshot(_Sink& __sink, const _Container& __c) {
+    using __fmt = __snapshot_format;
+    const auto& __elements = __adaptor_access<_Container>::__get(__c);
+    using _Tp = typename std::remove_cvref_t<decltype(__elements)>::value_type;
+    static_assert(snapshottable<_Tp>, "snapshot: specialize dsa::snapshot_traits for this element type");
+    constexpr bool __raw = __fmt::__is_bitwise<_Tp>;
+    static constexpr std::byte __zeros[__fmt::__align] = {};
+
+    __fmt::__header __h{};
+    std::memcpy(__h.__magic_, __fmt::__magic, sizeof(__h.__magic_));
+    __h.__format_version_ = __fmt::__version;
+    __h.__flags_ = __raw ? __fmt::__bitwise_flag : 0;
+    __h.__type_version_ = __fmt::__type_version<_Tp>();
+    __h.__element_size_ = __raw ? static_cast<std::uint32_t>(sizeof(_Tp)) : 0;
+    __h.__count_ = __elements.size();
+    __h.__crc_ = __fmt::__header_crc(__h);
+    iovec __hv{&__h, sizeof(__h)};
+    __sink.__write(&__hv, 1);
+
+    std::vector<std::byte> __gather;
+    std::vector<iovec> __iov;
+    if constexpr (__raw) __gather.reserve(__fmt::__per_chunk<_Tp> * sizeof(_Tp));
+    auto __it = __elements.begin();
+    for (std::size_t __left = __elements.size(); __left != 0;) {
+        __fmt::__chunk __ch{};
+        __gather.clear();
+        __iov.assign(1, iovec{&__ch, sizeof(__ch)});
+        std::size_t __n = 0;
+        std::uint32_t __crc = 0;
+        if constexpr (__raw) {
+            /* __gather never reallocates, so iovecs may point into it */
+            auto __flush = [&](const std::byte* __run, std::size_t __len) {
+                if (__len == 0) return;
+                __crc = crc32(__run, __len, __crc);
+                if (__len >= __fmt::__zero_copy_run) {
+                    __iov.push_back(iovec{const_cast<std::byte*>(__run), __len});
+                    return;
+                }
+                std::byte* __end = __gather.data() + __gather.size();
+                if (__iov.back().iov_base != &__ch && static_cast<std::byte*>(__iov.back().iov_base) + __iov.back().iov_len == __end)
+                    __iov.back().iov_len += __len;
+                else
+                    __iov.push_back(iovec{__end, __len});
+                __gather.insert(__gather.end(), __run, __run + __len);
+            };
+            const std::byte* __run = nullptr;
+            std::size_t __len = 0;
+            for (__n = std::min(__left, __fmt::__per_chunk<_Tp>); __ch.__count_ < __n; ++__ch.__count_, ++__it) {
+                const std::byte* __p = reinterpret_cast<const std::byte*>(std::addressof(*__it));
+                if (__p == __run + __len && __run != nullptr) {
+                    __len += sizeof(_Tp);
+                } else {
+                    __flush(__run, __len);
+                    __run = __p;
+                    __len = sizeof(_Tp);
+                }
+            }
+            __flush(__run, __len);
+            __ch.__bytes_ = __n * sizeof(_Tp);
+        } else {
+            snapshot_writer __w{__gather};
+            for (; __n < __left && __gather.size() < __fmt::__chunk_bytes; ++__n, ++__it) snapshot_traits<_Tp>::write(__w, *__it);
+            __crc = crc32(__gather.data(), __gather.size());
+            __iov.push_back(iovec{__gather.data(), __gather.size()});
+            __ch.__count_ = __n;
+            __ch.__bytes_ = __gather.size();
+        }
+        __ch.__crc_ = __crc;
+        const std::size_t __pad = __fmt::__padded(__ch.__bytes_) - __ch.__bytes_;
+        if (__pad != 0) __iov.push_back(iovec{const_cast<std::byte*>(__zeros), __pad});
+        __sink.__write(__iov.data(), __iov.size());
+        __left -= __n;
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Read a snapshot into a new container, verifying every chunk, and move it into __c
+**
+** @param [in]
+**      __src: stream, file descriptor or mapped file
+**
+** @param [out]
+**      __c: container or container adaptor, replaced only if the whole snapshot is valid
+**
+** @note
+**       Bitwise chunks are appended with one range insert where the container has one, so a
+**       doubly_linked_list gets one node slab per chunk, and a container with reserve() is
+**       sized once up front. The header has its own CRC-32, and the reserve is capped by the
+**       bytes left in a file or mapping, so a corrupted count cannot cause a huge allocation.
+**       Complexity: O(size of the snapshot)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Source, class _Container>
+void dsa::__load_snapshot(_Source& __src, _Container& __c) {
+    using __fmt = __snapshot_format;
+    _Container __tmp;
+    auto& __elements = __adaptor_access<_Container>::__get(__tmp);
+    using _Tp = typename std::remove_cvref_t<decltype(__elements)>::value_type;
+    static_assert(snapshottable<_Tp>, "snapshot: specialize dsa::snapshot_traits for this element type");
+    constexpr bool __raw = __fmt::__is_bitwise<_Tp>;
+
+    std::vector<std::byte> __scratch;
+    __fmt::__header __h;
+    std::memcpy(&__h, __src.__take(sizeof(__h), __scratch), sizeof(__h));
+    if (std::memcmp(__h.__magic_, __fmt::__magic, sizeof(__h.__magic_)) != 0)
+        throw std::runtime_error("snapshot: not a snapshot");
+    if (__h.__format_version_ != __fmt::__version) throw std::runtime_error("snapshot: unsupported format version");
+    if (__fmt::__header_crc(__h) != __h.__crc_) throw std::runtime_error("snapshot: header checksum mismatch");
+    if ((__h.__flags_ & __fmt::__bitwise_flag) != (__raw ? __fmt::__bitwise_flag : 0)
+        || __h.__element_size_ != (__raw ? sizeof(_Tp) : 0))
+        throw std::runtime_error("snapshot: element type mismatch");
+    if (__h.__type_version_ != __fmt::__type_version<_Tp>()) throw std::runtime_error("snapshot: element version mismatch");
+
+    if constexpr (requires { __elements.reserve(std::size_t{}); }) {
+        /* Never reserve more elements than the bytes left can hold */
+        const std::uint64_t __bytes = std::min(__src.__remaining(), __fmt::__max_bytes);
+        __elements.reserve(static_cast<std::size_t>(std::min(__h.__count_, __raw ? __bytes / sizeof(_Tp) : __bytes)));
+    }
+    std::vector<_Tp> __aligned;
+    for (std::uint64_t __left = __h.__count_; __left != 0;) {
+        __fmt::__chunk __ch;
+        std::memcpy(&__ch, __src.__take(sizeof(__ch), __scratch), sizeof(__ch));
+        if (__ch.__count_ == 0 || __ch.__count_ > __left || __ch.__bytes_ > __fmt::__max_bytes
+            || (__raw && __ch.__bytes_ != __ch.__count_ * sizeof(_Tp)))
+            throw std::runtime_error("snapshot: malformed chunk");
+        const std::byte* __payload = __src.__take(__fmt::__padded(__ch.__bytes_), __scratch);
+        if (crc32(__payload, __ch.__bytes_) != __ch.__crc_) throw std::runtime_error("snapshot: checksum mismatch");
+
+        const std::size_t __n = static_cast<std::size_t>(__ch.__count_);
+        if constexpr (__raw) {
+            const _Tp* __first = reinterpret_cast<const _Tp*>(__payload);
+            if (reinterpret_cast<std::uintptr_t>(__payload) % alignof(_Tp) != 0) {
+                __aligned.resize(__n);
+                std::memcpy(__aligned.data(), __payload, __ch.__bytes_);
+                __first = __aligned.data();
+            }
+            if constexpr (requires { __elements.insert(__elements.end(), __first, __first + __n); })
+                __elements.insert(__elements.end(), __first, __first + __n);
+            else
+                for (std::size_t __i = 0; __i < __n; ++__i) __elements.push_back(__first[__i]);
+        } else {
+            snapshot_reader __r{__payload, static_cast<std::size_t>(__ch.__bytes_)};
+            for (std::size_t __i = 0; __i < __n; ++__i) __elements.push_back(snapshot_traits<_Tp>::read(__r));
+            if (__r.remaining() != 0) throw std::runtime_error("snapshot: malformed chunk");
+        }
+        __left -= __ch.__count_;
+    }
+    __c = std::move(__tmp);
+}
+
+#endif /* SNAPSHOT_H */
@@ -11,7 +11,12 @@
 #define STACK_H
 
 #include <iostream>
-#include <deque>
+#include <optional>
+#include "Algorithm.h"
+#include "Deque.h"
+#include "ErrorPolicy.h"
+#include "MemoryUsage.h"
+#include "SmallVector.h"
 
 namespace dsa {
     /** 
@@ -22,12 +27,22 @@ namespace dsa {
      *      _Tp the type of stored element
      * @tparam
      *      _Container the type of underlying container to use to store the elements
+     * @tparam
+     *      _Policy what top() and pop() on an empty stack do, see ErrorPolicy.h
+     *
+     * @note
+     *      The check happens in the stack, whatever the policy of _Container.
+     *      try_top() and try_pop() never fail.
     */
     template < class _Tp,
-            class _Container = std::deque<_Tp>
+            class _Container = dsa::deque<_Tp>,
+            class _Policy = dsa::checked_policy
     > class stack {
+        static_assert(dsa::error_policy<_Policy>, "_Policy must be an error policy");
+
         public:
             using container_type = _Container;                                  //!< container_type
+            using error_policy = _Policy;                                       //!< precondition policy
             
             using value_type = typename container_type::value_type;             //!< value_type
             using reference = typename container_type::reference;               //!< reference
@@ -92,7 +107,40 @@ namespace dsa {
             inline void push(_Tp&& element) {c.push_back(std::forward<_Tp>(element));}
             
             /** @brief remove the top element from the stack*/
-            inline void pop() {c.pop_back();}
+            inline void pop() noexcept(_Policy::is_nothrow && noexcept(c.pop_back())) {
+                _Policy::require(!c.empty(), "Empty stack");
+                c.pop_back();
+            }
+
+            /**
+             * @brief
+             *      remove the top element and return it
+             *
+             * @return
+             *      the removed element, or std::nullopt if the stack is empty
+            */
+            std::optional<value_type> try_pop() {
+                if constexpr (requires { c.try_pop_back(); }) {
+                    return c.try_pop_back();
+                } else {
+                    if (c.empty()) return std::nullopt;
+                    std::optional<value_type> __v{std::move(c.back())};
+                    c.pop_back();
+                    return __v;
+                }
+            }
+
+            /**
+             * @brief
+             *      return a copy of the element at the top of the stack
+             *
+             * @return
+             *      the top element, or std::nullopt if the stack is empty
+            */
+            std::optional<value_type> try_top() const {
+                if (c.empty()) return std::nullopt;
+                return c.back();
+            }
 
             /**
              * @brief
@@ -101,7 +149,10 @@ namespace dsa {
              * @return
              *      reference to the top element
             */
-            inline reference top() {return c.back();}
+            inline reference top() noexcept(_Policy::is_nothrow && noexcept(c.back())) {
+                _Policy::require(!c.empty(), "Empty stack");
+                return c.back();
+            }
 
             /**
              * @brief
@@ -110,14 +161,42 @@ namespace dsa {
              * @return
              *      constant reference to the top element
             */
-            inline const_reference top() const {return c.back();}
+            inline const_reference top() const noexcept(_Policy::is_nothrow && noexcept(c.back())) {
+                _Policy::require(!c.empty(), "Empty stack");
+                return c.back();
+            }
 
             /** @brief check wheter the stack is empty */
             inline bool empty() const {return c.empty();}
 
             /** @brief return the size of the stack */
             inline std::size_t size() const {return c.size();}
+
+            /** @brief check whether both stacks hold equal elements from the bottom up, see dsa::equal() */
+            friend bool operator==(const stack& __x, const stack& __y) { return dsa::equal(__x.c, __y.c); }
+
+            /**
+             * @brief
+             *      return the memory held by the stack, available when the underlying container reports it
+             *
+             * @return
+             *      footprint of the underlying container
+            */
+            memory_footprint memory_usage() const
+                requires requires(const _Container& __c) { __c.memory_usage(); }
+            {
+                memory_footprint __m = c.memory_usage();
+                __m.overhead_bytes += sizeof(*this) - sizeof(c);
+                return __m;
+            }
     };
+
+    /**
+     * @brief a stack that keeps up to _N elements inside the object and allocates only
+     *      beyond that, for the short expression and DFS stacks that rarely grow
+    */
+    template <class _Tp, std::size_t _N = 32>
+    using small_stack = stack<_Tp, small_vector<_Tp, _N>>;
 }
 
 #endif /* STACK_H */
\ No newline at end of file
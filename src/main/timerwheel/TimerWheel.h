@@ -0,0 +1,418 @@
+/**
+ * @file    TimerWheel.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A hierarchical timer wheel whose slots are doubly_linked_list buckets
+*/
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "DoublyLinkedList.h"
+#include "MemoryUsage.h"
+
+namespace dsa {
+    /**
+     * @brief class timer_wheel
+     *
+     * _Levels wheels of 256 slots each; level k covers ticks that differ from the current tick
+     * first in byte k. A timer is placed once and moves down a level every time the tick
+     * reaches the start of its slot, so every timer is touched at most _Levels times.
+     *
+     * Each slot is a doubly_linked_list and timers move between slots with splice(), so the
+     * handle returned by schedule() stays valid until the timer fires or is cancelled.
+    */
+    template <class _Payload, std::size_t _Levels = 4>
+    class timer_wheel {
+        static_assert(_Levels >= 1 && _Levels <= 7, "timer_wheel supports 1 to 7 levels of 8 bits");
+
+        public:
+            using tick_type = std::uint64_t;                        //!< time unit of the wheel
+            using size_type = std::size_t;                          //!< size_type
+            using payload_type = _Payload;                          //!< payload_type
+
+            static constexpr std::size_t slot_bits = 8;             //!< log2 of the slots per level
+            static constexpr std::size_t slots = 1u << slot_bits;   //!< slots per level
+            static constexpr std::size_t levels = _Levels;          //!< number of levels
+
+        private:
+            struct __entry {
+                tick_type __expiry_;
+                std::uint32_t __level_;
+                std::uint32_t __slot_;
+                _Payload __payload_;
+            };
+
+            using __bucket = doubly_linked_list<__entry, unchecked_policy>;     //!< the wheel only erases live entries
+            static constexpr std::size_t __words = slots / 64;
+            static constexpr tick_type __slot_mask = slots - 1;
+            static constexpr std::uint32_t __firing_level = _Levels;       //!< __level_ of a timer of the batch advance() fires
+            static constexpr std::uint32_t __fired_level = _Levels + 1;    //!< __level_ of a timer whose callback has run
+
+        public:
+            /** @brief handle of a pending timer, invalidated when the timer fires or is cancelled */
+            class handle {
+                    friend class timer_wheel;
+                    typename __bucket::iterator __it_;
+
+                    explicit handle(typename __bucket::iterator __it) noexcept : __it_{__it} {}
+
+                public:
+                    handle() = default;
+
+                    /** @brief return the tick the timer fires at */
+                    tick_type expiry() const noexcept { return (*__it_).__expiry_; }
+
+                    /** @brief return the payload of the timer */
+                    _Payload& payload() const noexcept { return (*__it_).__payload_; }
+            };
+
+            /** @brief constructor, __now is the first tick that advance() processes */
+            explicit timer_wheel(tick_type __now = 0) noexcept : __cur_{__now} {}
+
+            timer_wheel(const timer_wheel&) = delete;
+            timer_wheel& operator=(const timer_wheel&) = delete;
+
+            /** @brief return the number of pending timers */
+            size_type size() const noexcept { return __size_; }
+
+            /** @brief check whether no timer is pending */
+            bool empty() const noexcept { return __size_ == 0; }
+
+            /** @brief return the next tick advance() processes */
+            tick_type now() const noexcept { return __cur_; }
+
+            template <class... _Args>
+            handle emplace(tick_type __expiry, _Args&&... __args);
+
+            /** @brief schedule __p to fire at tick __expiry, see emplace() */
+            handle schedule(tick_type __expiry, const _Payload& __p) { return emplace(__expiry, __p); }
+
+            /** @brief schedule __p to fire at tick __expiry, see emplace() */
+            handle schedule(tick_type __expiry, _Payload&& __p) { return emplace(__expiry, std::move(__p)); }
+
+            /** @brief schedule __p to fire __delay ticks after now() */
+            handle schedule_after(tick_type __delay, _Payload __p) { return emplace(__cur_ + __delay, std::move(__p)); }
+
+            void cancel(handle __h) noexcept;
+
+            template <class _Fn>
+            size_type advance(tick_type __now, _Fn&& __on_expire);
+
+            memory_footprint memory_usage() const noexcept;
+
+        private:
+            __bucket __wheel_[_Levels][slots];
+            __bucket __firing_;                                     //!< expired timers whose callbacks have not run yet
+            std::uint64_t __occupied_[_Levels][__words] = {};      //!< bit s of level k is set when slot s is not empty
+            tick_type __cur_;
+            size_type __size_ = 0;
+
+            static constexpr tick_type __shift(std::size_t __level) noexcept { return __level * slot_bits; }
+
+            void __place(typename __bucket::iterator __it, __bucket& __from);
+            void __cascade(tick_type __t);
+            tick_type __next_event() const noexcept;
+            std::size_t __next_occupied(std::size_t __level, std::size_t __from) const noexcept;
+
+            void __mark(std::size_t __level, std::size_t __slot) noexcept {
+                __occupied_[__level][__slot / 64] |= std::uint64_t{1} << (__slot % 64);
+            }
+
+            void __unmark(std::size_t __level, std::size_t __slot) noexcept {
+                __occupied_[__level][__slot / 64] &= ~(std::uint64_t{1} << (__slot % 64));
+            }
+    };
+}   /* namespace dsa */
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Schedule a timer whose payload is constructed from __args
+**
+** @param [in]
+**      __expiry: tick to fire at. A tick before now() fires on the next advance().
+**
+** @param [in]
+**      __args: arguments forwarded to the constructor of the payload
+**
+** @return
+**       handle to cancel the timer
+**
+** @note
+**       Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Payload, std::size_t _Levels>
+template <class... _Args>
+typename dsa::timer_wheel<_Payload, _Levels>::handle
+dsa::timer_wheel<_Payload, _Levels>::emplace(tick_type __expiry, _Args&&... __args) {
+    __bucket __staging;
+    __staging.emplace_back(__entry{__expiry < __cur_ ? __cur_ : __expiry, 0, 0, _Payload(std::forward<_Args>(__args)...)});
+    typename __bucket::iterator __it = __staging.begin();
+    __place(__it, __staging);
+    ++__size_;
+    return handle{__it};
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Remove a pending timer without firing it
+**
+** @param [in]
+**      __h: handle returned by schedule() for a timer that has neither fired nor been cancelled
+**
+** @return
+**       None
+**
+** @note
+**       From a callback of advance(), a timer of the same tick whose callback has not run yet
+**       is removed and does not fire; the timer whose callback is running is left alone.
+**       Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Payload, std::size_t _Levels>
+void dsa::timer_wheel<_Payload, _Levels>::cancel(handle __h) noexcept {
+    const std::size_t __level = (*__h.__it_).__level_;
+    const std::size_t __slot = (*__h.__it_).__slot_;
+    if (__level == __fired_level) return;
+    if (__level == __firing_level) {
+        __firing_.erase(__h.__it_);                         // no longer counted by size()
+        return;
+    }
+    __bucket& __b = __wheel_[__level][__slot];
+    __b.erase(__h.__it_);
+    if (__b.empty()) __unmark(__level, __slot);
+    --__size_;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Process every tick from now() up to and including __now and fire the timers that expire
+**
+** @param [in]
+**      __now: last tick to process
+**
+** @param [in]
+**      __on_expire: callable invoked as __on_expire(_Payload&) for every expired timer, in
+**      expiry order. It may schedule and cancel other timers; a timer scheduled for a tick
+**      already processed fires at the next processed tick.
+**
+** @return
+**       number of fired timers
+**
+** @note
+**       Timers of one tick are detached as a batch before their callbacks run; a timer of the
+**       batch cancelled by an earlier callback is not fired. Empty slots
+**       are skipped with the occupancy bitmaps, so the cost is proportional to the number of
+**       fired and cascaded timers rather than to the number of elapsed ticks.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Payload, std::size_t _Levels>
+template <class _Fn>
+typename dsa::timer_wheel<_Payload, _Levels>::size_type
+dsa::timer_wheel<_Payload, _Levels>::advance(tick_type __now, _Fn&& __on_expire) {
+    size_type __fired = 0;
+    while (__cur_ <= __now) {
+        const tick_type __t = __cur_;
+        if ((__t & __slot_mask) == 0) __cascade(__t);
+
+        const std::size_t __slot = __t & __slot_mask;
+        __firing_.clear();                                  // left over by a callback that threw
+        __firing_.splice(__firing_.end(), __wheel_[0][__slot]);
+        __unmark(0, __slot);
+        __size_ -= __firing_.size();
+        for (__entry& __e : __firing_) __e.__level_ = __firing_level;
+
+        /* Timers scheduled by the callbacks are placed relative to the next tick */
+        __cur_ = __t + 1;
+        __bucket __done;
+        while (!__firing_.empty()) {
+            __done.splice(__done.end(), __firing_, __firing_.begin());
+            __entry& __e = __done.back();
+            __e.__level_ = __fired_level;
+            ++__fired;
+            __on_expire(__e.__payload_);
+        }
+
+        const tick_type __next = __next_event();
+        if (__next > __now) {
+            __cur_ = __now + 1;
+            break;
+        }
+        __cur_ = __next;
+    }
+    return __fired;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Splice the entry __it of __from into the slot its expiry maps to relative to now()
+**
+** @note
+**       The level is the highest byte in which the expiry differs from now(), so the slot is
+**       always ahead of the current position of that level. An expiry beyond the top level
+**       goes to its own top-level slot when that slot comes round in the next rotation, and
+**       is otherwise parked in the slot just behind the current one; either way it is placed
+**       again when that slot is cascaded.
+**       Complexity: O(1)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Payload, std::size_t _Levels>
+void dsa::timer_wheel<_Payload, _Levels>::__place(typename __bucket::iterator __it, __bucket& __from) {
+    __entry& __e = *__it;
+    const tick_type __diff = __e.__expiry_ ^ __cur_;
+    std::size_t __level = __diff == 0 ? 0 : (std::bit_width(__diff) - 1) / slot_bits;
+    std::size_t __slot;
+    if (__level < _Levels) {
+        __slot = (__e.__expiry_ >> __shift(__level)) & __slot_mask;
+    } else {
+        /* A slot behind the current one is only visited in the next rotation of the top level */
+        __level = _Levels - 1;
+        const tick_type __cs = (__cur_ >> __shift(__level)) & __slot_mask;
+        const tick_type __es = (__e.__expiry_ >> __shift(__level)) & __slot_mask;
+        const bool __next_rotation = (__e.__expiry_ >> __shift(_Levels)) == (__cur_ >> __shift(_Levels)) + 1;
+        __slot = __next_rotation && __es < __cs ? __es : (__cs - 1) & __slot_mask;
+    }
+
+    __e.__level_ = static_cast<std::uint32_t>(__level);
+    __e.__slot_ = static_cast<std::uint32_t>(__slot);
+    __bucket& __to = __wheel_[__level][__slot];
+    __to.splice(__to.end(), __from, __it);
+    __mark(__level, __slot);
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Redistribute the slots of the upper levels that start at tick __t, highest level first
+**
+** @note
+**       Complexity: O(number of cascaded timers)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Payload, std::size_t _Levels>
+void dsa::timer_wheel<_Payload, _Levels>::__cascade(tick_type __t) {
+    std::size_t __top = 1;
+    while (__top + 1 < _Levels && (__t & ((tick_type{1} << __shift(__top + 1)) - 1)) == 0) ++__top;
+
+    for (std::size_t __level = __top; __level >= 1 && __level < _Levels; --__level) {
+        const std::size_t __slot = (__t >> __shift(__level)) & __slot_mask;
+        __bucket& __b = __wheel_[__level][__slot];
+        if (__b.empty()) continue;
+
+        __bucket __moving;
+        __moving.splice(__moving.end(), __b);
+        __unmark(__level, __slot);
+        while (!__moving.empty()) __place(__moving.begin(), __moving);
+    }
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Return the first tick at or after now() where a slot has to be fired or cascaded
+**
+** @note
+**       Complexity: O(_Levels * slots / 64)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Payload, std::size_t _Levels>
+typename dsa::timer_wheel<_Payload, _Levels>::tick_type
+dsa::timer_wheel<_Payload, _Levels>::__next_event() const noexcept {
+    if (__size_ == 0) return std::numeric_limits<tick_type>::max();
+    if ((__cur_ & __slot_mask) == 0) return __cur_;
+
+    tick_type __best = std::numeric_limits<tick_type>::max();
+    const std::size_t __s0 = __next_occupied(0, __cur_ & __slot_mask);
+    if (__s0 < slots) __best = (__cur_ & ~__slot_mask) + __s0;
+
+    for (std::size_t __level = 1; __level < _Levels; ++__level) {
+        const tick_type __span = tick_type{1} << __shift(__level + 1);
+        const tick_type __base = __cur_ & ~(__span - 1);
+        const std::size_t __pos = (__cur_ >> __shift(__level)) & __slot_mask;
+
+        std::size_t __s = __next_occupied(__level, __pos + 1);
+        if (__s < slots) {
+            const tick_type __t = __base + (tick_type{__s} << __shift(__level));
+            if (__t < __best) __best = __t;
+        } else if (__level == _Levels - 1) {
+            /* parked timers behind the current top-level slot come round in the next rotation */
+            __s = __next_occupied(__level, 0);
+            if (__s <= __pos) {
+                const tick_type __t = __base + __span + (tick_type{__s} << __shift(__level));
+                if (__t < __best && __t > __base) __best = __t;
+            }
+        }
+    }
+    return __best;
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Return the first occupied slot >= __from of __level, or slots if there is none
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Payload, std::size_t _Levels>
+std::size_t dsa::timer_wheel<_Payload, _Levels>::__next_occupied(std::size_t __level, std::size_t __from) const noexcept {
+    if (__from >= slots) return slots;
+    std::size_t __w = __from / 64;
+    std::uint64_t __bits = __occupied_[__level][__w] & (~std::uint64_t{0} << (__from % 64));
+    while (__bits == 0) {
+        if (++__w == __words) return slots;
+        __bits = __occupied_[__level][__w];
+    }
+    return __w * 64 + static_cast<std::size_t>(std::countr_zero(__bits));
+}
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Report the memory held by the wheel
+**
+** @return
+**       payload, slot lists and bookkeeping of every timer, and estimated allocator slack
+**
+** @note
+**       Complexity: O(_Levels * slots)
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Payload, std::size_t _Levels>
+dsa::memory_footprint dsa::timer_wheel<_Payload, _Levels>::memory_usage() const noexcept {
+    memory_footprint __m;
+    for (const auto& __level : __wheel_)
+        for (const __bucket& __b : __level) __m += __b.memory_usage();
+
+    /* The buckets count whole entries as payload; only the payloads are */
+    __m.overhead_bytes += __m.payload_bytes - __size_ * sizeof(_Payload) + sizeof(*this) - sizeof(__wheel_);
+    __m.payload_bytes = __size_ * sizeof(_Payload);
+    return __m;
+}
+#endif /* TIMER_WHEEL_H */
@@ -0,0 +1,169 @@
+/**
+ * @file    TrailStack.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A stack with checkpoints, the trail of a backtracking search
+*/
+
+#ifndef TRAIL_STACK_H
+#define TRAIL_STACK_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "ErrorPolicy.h"
+#include "MemoryUsage.h"
+#include "SmallVector.h"
+
+namespace dsa {
+    /**
+     * @brief trail_stack is a stack on contiguous storage that can be cut back to an earlier
+     *      depth in one step. mark() returns a checkpoint; rollback() removes everything
+     *      pushed since.
+     *
+     * @tparam
+     *      _Tp the type of stored element
+     * @tparam
+     *      _N number of elements stored inline, see small_vector
+     * @tparam
+     *      _Policy what top/pop on an empty trail and rollback() to a checkpoint deeper than
+     *      the trail do, see ErrorPolicy.h. The trail checks them itself; the small_vector
+     *      underneath is unchecked.
+     *
+     * @note
+     *      A checkpoint stays valid until the trail is rolled back below it; checkpoints may
+     *      be used in any order as long as each is at most size().
+    */
+    template <class _Tp, std::size_t _N = 64, class _Policy = checked_policy>
+    class trail_stack {
+        static_assert(dsa::error_policy<_Policy>, "_Policy must be an error policy");
+
+        public:
+            using container_type = small_vector<_Tp, _N, unchecked_policy>;         //!< container_type
+            using error_policy = _Policy;                                           //!< precondition policy
+            using value_type = _Tp;                                                 //!< value_type
+            using size_type = typename container_type::size_type;                   //!< size_type
+            using reference = typename container_type::reference;                   //!< reference
+            using const_reference = typename container_type::const_reference;       //!< const_reference
+            using const_iterator = typename container_type::const_iterator;         //!< const_iterator type
+
+            /** @brief depth of the trail at the time of mark() */
+            class checkpoint {
+                    friend class trail_stack;
+                    size_type __depth_ = 0;
+                    explicit checkpoint(size_type __d) noexcept : __depth_{__d} {}
+
+                public:
+                    checkpoint() = default;
+
+                    /** @brief return the number of elements below the checkpoint */
+                    size_type depth() const noexcept { return __depth_; }
+
+                    friend bool operator==(checkpoint, checkpoint) = default;
+            };
+
+            /** @brief push a copy of __x */
+            void push(const _Tp& __x) { __c_.push_back(__x); }
+
+            /** @brief push __x */
+            void push(_Tp&& __x) { __c_.push_back(std::move(__x)); }
+
+            /** @brief construct an element on top from __args */
+            template <class... _Args>
+            reference emplace(_Args&&... __args) { return __c_.emplace_back(std::forward<_Args>(__args)...); }
+
+            /** @brief remove the top element */
+            void pop() noexcept(_Policy::is_nothrow) {
+                _Policy::require(!__c_.empty(), "Empty trail");
+                __c_.pop_back();
+            }
+
+            /** @brief return a reference to the top element */
+            reference top() noexcept(_Policy::is_nothrow) {
+                _Policy::require(!__c_.empty(), "Empty trail");
+                return __c_.back();
+            }
+
+            /** @brief return a constant reference to the top element */
+            const_reference top() const noexcept(_Policy::is_nothrow) {
+                _Policy::require(!__c_.empty(), "Empty trail");
+                return __c_.back();
+            }
+
+            /** @brief return the element at depth __i from the bottom, no bounds checking */
+            const_reference operator[](size_type __i) const noexcept { return __c_[__i]; }
+
+            /** @brief return a constant iterator to the bottom element */
+            const_iterator begin() const noexcept { return __c_.begin(); }
+
+            /** @brief return a constant iterator past the top element */
+            const_iterator end() const noexcept { return __c_.end(); }
+
+            /** @brief check whether the trail is empty */
+            bool empty() const noexcept { return __c_.empty(); }
+
+            /** @brief return the number of elements */
+            size_type size() const noexcept { return __c_.size(); }
+
+            /** @brief return a checkpoint at the current depth */
+            checkpoint mark() const noexcept { return checkpoint{__c_.size()}; }
+
+            /** @brief return the number of elements pushed since __cp */
+            size_type since(checkpoint __cp) const noexcept { return __c_.size() - __cp.__depth_; }
+
+            /**
+             * @brief
+             *      remove every element pushed since __cp
+             *
+             * @param[in]
+             *      __cp: checkpoint returned by mark()
+             *
+             * @note
+             *      Complexity: O(1) for a trivially destructible _Tp, O(k) for k removed elements
+             *      otherwise. The capacity is kept, so the next pushes do not allocate.
+            */
+            void rollback(checkpoint __cp) noexcept(_Policy::is_nothrow) {
+                _Policy::require(__cp.__depth_ <= __c_.size(), "Checkpoint above the trail");
+                __c_.truncate(__cp.__depth_);
+            }
+
+            /**
+             * @brief
+             *      remove every element pushed since __cp, calling __undo on each one first,
+             *      most recent first
+             *
+             * @param[in]
+             *      __cp: checkpoint returned by mark()
+             * @param[in]
+             *      __undo: callable invoked as __undo(_Tp&) before the element is destroyed
+             *
+             * @note
+             *      Complexity: O(k) for k removed elements. If __undo throws, the element it
+             *      threw on and those below it stay on the trail.
+            */
+            template <class _Undo>
+            void rollback(checkpoint __cp, _Undo&& __undo) {
+                _Policy::require(__cp.__depth_ <= __c_.size(), "Checkpoint above the trail");
+                for (size_type __n = __c_.size(); __n > __cp.__depth_; --__n) {
+                    __undo(__c_[__n - 1]);
+                    __c_.truncate(__n - 1);
+                }
+            }
+
+            /** @brief remove every element */
+            void clear() noexcept { __c_.clear(); }
+
+            /** @brief make room for __n elements */
+            void reserve(size_type __n) { __c_.reserve(__n); }
+
+            /** @brief return the memory held by the trail */
+            memory_footprint memory_usage() const noexcept { return __c_.memory_usage(); }
+
+        private:
+            container_type __c_;                //!< elements, bottom first
+    };
+}   /* namespace dsa */
+
+#endif /* TRAIL_STACK_H */
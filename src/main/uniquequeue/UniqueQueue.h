@@ -0,0 +1,194 @@
+/**
+ * @file    UniqueQueue.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A FIFO queue that holds each key at most once
+*/
+
+#ifndef UNIQUE_QUEUE_H
+#define UNIQUE_QUEUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+
+#include "Deque.h"
+#include "ErrorPolicy.h"
+#include "FlatHashMap.h"
+#include "MemoryUsage.h"
+
+namespace dsa {
+    /**
+     * @brief unique_queue is a FIFO work queue that holds each key at most once. A push of a
+     *      key that is already pending is merged into the pending entry instead of queued
+     *      again, so a key enqueued n times before a worker reaches it is processed once.
+     *
+     * @tparam
+     *      _Key the type of stored keys
+     * @tparam
+     *      _Hash hash function of the index
+     * @tparam
+     *      _KeyEqual key equality, two keys are the same work item if it holds
+     * @tparam
+     *      _Container the type of underlying FIFO, must support operator[], see dsa::queue
+     * @tparam
+     *      _Policy what front() on an empty queue does, see ErrorPolicy.h
+     *
+     * @note
+     *      The index is a flat_hash_map from each pending key to its sequence number, the
+     *      position it was pushed at; the pending entry sits at that number minus the
+     *      sequence number of the front, so push(), pop() and contains() are O(1) on
+     *      average. A merged key keeps its place in the queue. Not thread-safe.
+    */
+    template <class _Key, class _Hash = std::hash<_Key>, class _KeyEqual = std::equal_to<_Key>,
+              class _Container = deque<_Key>, class _Policy = checked_policy>
+    class unique_queue {
+            static_assert(dsa::error_policy<_Policy>, "_Policy must be an error policy");
+
+        public:
+            using container_type = _Container;                  //!< container_type
+            using error_policy = _Policy;                       //!< precondition policy
+            using value_type = _Key;                            //!< value_type
+            using size_type = std::size_t;                      //!< size_type
+            using const_reference = const _Key&;                //!< const_reference
+
+            /** @brief push a copy of __k, return false if it was already pending */
+            bool push(const _Key& __k) { return __push(__k, __keep_pending{}); }
+
+            /** @brief push __k, return false if it was already pending */
+            bool push(_Key&& __k) { return __push(std::move(__k), __keep_pending{}); }
+
+            /**
+             * @brief
+             *      push __k, or coalesce it into the pending entry of an equal key
+             *
+             * @param[in]
+             *      __k: key to push
+             * @param[in]
+             *      __merge: callable invoked as __merge(_Key& pending, _Key&& incoming) when
+             *      an equal key is pending; it must leave the pending key equal to __k
+             *      under _KeyEqual and with the same hash
+             *
+             * @return
+             *      true if __k was queued, false if it was coalesced
+             *
+             * @note
+             *      Complexity: O(1) on average. If __merge throws, the pending entry is what
+             *      __merge left of it and the queue is otherwise unchanged.
+            */
+            template <class _Merge>
+            bool push(_Key __k, _Merge&& __merge) { return __push(std::move(__k), std::forward<_Merge>(__merge)); }
+
+            /** @brief remove the front key and return it, std::nullopt if the queue is empty */
+            std::optional<_Key> pop() {
+                if (__fifo_.empty()) return std::nullopt;
+                std::optional<_Key> __k{std::move(__fifo_.front())};
+                __index_.erase(*__k);
+                __fifo_.pop_front();
+                ++__head_;
+                return __k;
+            }
+
+            /** @brief return a constant reference to the front key */
+            const_reference front() const noexcept(_Policy::is_nothrow && noexcept(__fifo_.front())) {
+                _Policy::require(!__fifo_.empty(), "Empty unique_queue");
+                return __fifo_.front();
+            }
+
+            /** @brief check whether a key equal to __k is pending */
+            bool contains(const _Key& __k) const { return __index_.contains(__k); }
+
+            /** @brief return the pending key equal to __k, nullptr if there is none */
+            const _Key* find(const _Key& __k) const {
+                auto __it = __index_.find(__k);
+                return __it == __index_.end() ? nullptr : &__fifo_[__it->second - __head_];
+            }
+
+            /** @brief check whether the queue is empty */
+            bool empty() const noexcept { return __fifo_.empty(); }
+
+            /** @brief return the number of pending keys */
+            size_type size() const noexcept { return __fifo_.size(); }
+
+            /** @brief return the number of pushes merged into a pending key so far */
+            std::uint64_t merged() const noexcept { return __merged_; }
+
+            /** @brief remove every pending key, keeps the merged() count */
+            void clear() noexcept {
+                __fifo_.clear();
+                __index_.clear();
+            }
+
+            /** @brief make room in the index for __n pending keys */
+            void reserve(size_type __n) { __index_.reserve(__n); }
+
+            /** @brief return the memory held by the FIFO and the index */
+            memory_footprint memory_usage() const
+                requires requires(const _Container& __c) { __c.memory_usage(); }
+            {
+                memory_footprint __m = __fifo_.memory_usage();
+                __m += __index_.memory_usage();
+                __m.overhead_bytes += sizeof(*this) - sizeof(__fifo_) - sizeof(__index_);
+                return __m;
+            }
+
+        private:
+            /* merge function of the plain push(): the pending key wins */
+            struct __keep_pending {
+                void operator()(_Key&, const _Key&) const noexcept {}
+            };
+
+            template <class _K2, class _Merge>
+            bool __push(_K2&& __k, _Merge&& __merge);
+
+            _Container __fifo_;                                                 //!< pending keys, oldest first
+            flat_hash_map<_Key, std::uint64_t, _Hash, _KeyEqual> __index_;      //!< pending key -> sequence number
+            std::uint64_t __head_ = 0;                                          //!< sequence number of the front
+            std::uint64_t __merged_ = 0;
+    };
+}   /* namespace dsa */
+
+/**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+**
+** @brief
+**      Queue __k unless an equal key is pending, in which case __merge folds it
+**      into the pending entry
+**
+** @param[in]
+**      __k: key to push
+** @param[in]
+**      __merge: merge function, see push()
+**
+** @return
+**      true if __k was queued
+**
+** @note
+**      Complexity: O(1) on average. The index entry goes in first so that a
+**      failed rehash leaves the queue unchanged; a failed FIFO push removes it.
+**
+** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+*/
+template <class _Key, class _Hash, class _KeyEqual, class _Container, class _Policy>
+template <class _K2, class _Merge>
+bool dsa::unique_queue<_Key, _Hash, _KeyEqual, _Container, _Policy>::__push(_K2&& __k, _Merge&& __merge) {
+    const std::uint64_t __seq = __head_ + __fifo_.size();
+    auto [__it, __inserted] = __index_.try_emplace(__k, __seq);
+    if (!__inserted) {
+        __merge(__fifo_[__it->second - __head_], std::forward<_K2>(__k));
+        ++__merged_;
+        return false;
+    }
+    try {
+        __fifo_.push_back(std::forward<_K2>(__k));
+    } catch (...) {
+        __index_.erase(__it);
+        throw;
+    }
+    return true;
+}
+
+#endif /* UNIQUE_QUEUE_H */
@@ -0,0 +1,154 @@
+/**
+ * @file    AdaptiveContainerTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   An inline-or-heap adaptive ring container test
+*/
+
+#ifndef ADAPTIVE_CONTAINER_TEST_H
+#define ADAPTIVE_CONTAINER_TEST_H
+
+#include <string>
+#include <utility>
+#include <gtest/gtest.h>
+
+#include "AdaptiveContainer.h"
+#include "Stack.h"
+#include "queue.h"
+
+namespace dsa {
+    class AdaptiveContainerTest : public testing::Test {
+        public:
+            AdaptiveContainerTest() {}
+            virtual ~AdaptiveContainerTest() {}
+            virtual void SetUp() {}
+            virtual void TearDown() {}
+    };
+
+    TEST_F(AdaptiveContainerTest, testSpikeThenDemote) {
+        adaptive_container<int, 8> c;
+        c.set_demote_after(32);
+        for (int i = 0; i < 6; ++i) c.push_back(i);
+        c.pop_front();
+        c.pop_front();
+        EXPECT_TRUE(c.is_inline());
+
+        for (int i = 6; i < 10000; ++i) c.push_back(i);             // the spike, pushed over a wrapped ring
+        EXPECT_FALSE(c.is_inline());
+        EXPECT_GE(c.capacity(), c.size());
+        EXPECT_EQ(c.stats().promotions, 1u);
+        EXPECT_EQ(c.stats().peak_size, 9998u);
+        for (int i = 2; i < 9997; ++i) ASSERT_EQ(*c.try_pop_front(), i);
+
+        EXPECT_FALSE(c.is_inline());                                // 3 left, but not for long enough
+        for (int i = 0; i < 20; ++i) {
+            c.push_back(10000 + i);
+            c.pop_front();
+        }
+        EXPECT_TRUE(c.is_inline());
+        EXPECT_EQ(c.stats().demotions, 1u);
+        EXPECT_EQ(c.size(), 3u);
+        EXPECT_EQ(c.front(), 10017);
+        EXPECT_EQ(c.back(), 10019);
+        EXPECT_LT(c.stats().inline_share(), 0.01);
+    }
+
+    TEST_F(AdaptiveContainerTest, testHysteresis) {
+        adaptive_container<int, 8> c;
+        c.set_demote_after(4);
+        for (int i = 0; i < 9; ++i) c.push_back(i);
+        EXPECT_FALSE(c.is_inline());
+        for (int i = 0; i < 1000; ++i) {                            // hovering between 5 and 9 elements
+            for (int k = 0; k < 4; ++k) c.pop_front();
+            for (int k = 0; k < 4; ++k) c.push_back(i);
+        }
+        EXPECT_FALSE(c.is_inline());
+        EXPECT_EQ(c.stats().promotions, 1u);
+        EXPECT_EQ(c.stats().demotions, 0u);
+
+        c.clear();
+        c.shrink_to_fit();
+        EXPECT_TRUE(c.is_inline());
+        EXPECT_EQ(c.stats().demotions, 1u);
+    }
+
+    TEST_F(AdaptiveContainerTest, testShrinkHeapRing) {
+        adaptive_container<int, 8> c;
+        c.set_demote_after(4);
+        for (int i = 0; i < 1000; ++i) c.push_back(i);
+        EXPECT_EQ(c.capacity(), 1024u);
+        for (int i = 0; i < 900; ++i) ASSERT_EQ(*c.try_pop_front(), i);
+
+        for (int i = 0; i < 100; ++i) {                             // 100 elements, above _N / 2
+            c.push_back(1000 + i);
+            c.pop_front();
+        }
+        EXPECT_FALSE(c.is_inline());
+        EXPECT_EQ(c.capacity(), 256u);                              // halved twice, now above a quarter full
+        EXPECT_EQ(c.stats().shrinks, 2u);
+        EXPECT_EQ(c.stats().demotions, 0u);
+        ASSERT_EQ(c.size(), 100u);
+        for (int i = 0; i < 100; ++i) ASSERT_EQ(c[static_cast<std::size_t>(i)], 1000 + i);
+
+        adaptive_container<int, 8> spike;                           // never halved below 2 * _N
+        spike.set_demote_after(4);
+        for (int i = 0; i < 64; ++i) spike.push_back(i);
+        while (spike.size() > 5) spike.pop_back();
+        for (int i = 0; i < 100; ++i) {
+            spike.pop_back();
+            spike.push_back(i);
+        }
+        EXPECT_EQ(spike.capacity(), 16u);
+        EXPECT_FALSE(spike.is_inline());
+    }
+
+    TEST_F(AdaptiveContainerTest, testBehindQueueAndStack) {
+        queue<std::string, adaptive_container<std::string, 4>> q;
+        for (int i = 0; i < 3; ++i) q.push(std::to_string(i));
+        EXPECT_EQ(q.front(), "0");
+        EXPECT_EQ(q.back(), "2");
+        EXPECT_EQ(q.try_pop(), "0");
+        EXPECT_EQ(q.size(), 2u);
+
+        memory_footprint m = q.memory_usage();
+        EXPECT_EQ(m.allocations, 0u);
+        EXPECT_EQ(m.payload_bytes, 2 * sizeof(std::string));
+
+        stack<std::string, adaptive_container<std::string, 4>> s;
+        for (int i = 0; i < 10; ++i) s.push(std::string(20, static_cast<char>('a' + i)));
+        EXPECT_EQ(s.top(), std::string(20, 'j'));
+        for (int i = 9; i >= 0; --i) EXPECT_EQ(s.try_pop(), std::string(20, static_cast<char>('a' + i)));
+        EXPECT_TRUE(s.empty());
+    }
+
+    TEST_F(AdaptiveContainerTest, testCopyAndMove) {
+        adaptive_container<std::string, 2> a;
+        for (int i = 0; i < 5; ++i) a.push_back(std::to_string(i));
+        a.pop_front();
+        a.push_back("5");
+
+        adaptive_container<std::string, 2> b{a};
+        EXPECT_EQ(b.size(), 5u);
+        EXPECT_EQ(b.front(), "1");
+        EXPECT_EQ(b[4], "5");
+
+        adaptive_container<std::string, 2> c{std::move(a)};
+        EXPECT_TRUE(a.empty());
+        EXPECT_TRUE(a.is_inline());
+        EXPECT_EQ(c.stats().promotions, 1u);
+        EXPECT_EQ(c.back(), "5");
+
+        auto segments = c.segments();
+        EXPECT_EQ(segments[0].size() + segments[1].size(), 5u);
+        EXPECT_EQ(segments[0].front(), "1");
+
+        a = b;
+        EXPECT_EQ(a.size(), 5u);
+        b = std::move(c);
+        EXPECT_EQ(b.try_pop_back(), "5");
+        EXPECT_GT(b.memory_usage().allocations, 0u);
+    }
+}   /* namespace dsa */
+
+#endif /* ADAPTIVE_CONTAINER_TEST_H */
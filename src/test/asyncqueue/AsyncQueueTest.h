@@ -0,0 +1,102 @@
+/**
+ * @file    AsyncQueueTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A coroutine queue and executor test
+*/
+
+#ifndef ASYNC_QUEUE_TEST_H
+#define ASYNC_QUEUE_TEST_H
+
+#include <atomic>
+#include <latch>
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "AsyncQueue.h"
+#include "Executor.h"
+
+namespace dsa {
+    class AsyncQueueTest : public testing::Test {
+        protected:
+            manual_executor loop;
+            std::vector<int> received;
+
+            async_task consume(async_queue<int>& q) {
+                while (std::optional<int> v = co_await q.pop()) received.push_back(*v);
+                received.push_back(-1);
+            }
+
+        public:
+            AsyncQueueTest() {}
+            virtual ~AsyncQueueTest() {}
+            virtual void SetUp() {}
+            virtual void TearDown() {}
+    };
+
+    TEST_F(AsyncQueueTest, testConsumerSuspendsUntilPush) {
+        async_queue<int> q{loop};
+        loop.spawn(consume(q));
+        EXPECT_EQ(loop.run(), 1);
+        EXPECT_EQ(q.waiting(), 1);                      /* suspended, no thread held */
+        EXPECT_TRUE(received.empty());
+
+        q.push(1);
+        q.push(2);                                      /* queued: the consumer has not resumed yet */
+        EXPECT_EQ(q.size(), 1);
+        loop.run();
+        EXPECT_EQ(received, (std::vector<int>{1, 2}));
+        EXPECT_EQ(q.waiting(), 1);
+
+        q.close();
+        EXPECT_FALSE(q.push(3));
+        loop.run();
+        EXPECT_EQ(received, (std::vector<int>{1, 2, -1}));
+        EXPECT_EQ(q.waiting(), 0);
+    }
+
+    TEST_F(AsyncQueueTest, testDrainAfterClose) {
+        async_queue<int> q;                             /* resumes inline */
+        q.push(7);
+        q.close();
+        EXPECT_TRUE(q.closed());
+        async_task t = consume(q);
+        loop.spawn(std::move(t));
+        loop.run();
+        EXPECT_EQ(received, (std::vector<int>{7, -1}));
+        EXPECT_FALSE(q.try_pop().has_value());
+    }
+
+    TEST_F(AsyncQueueTest, testPipelineOnThreadPool) {
+        constexpr int stages = 1000;
+        constexpr int items = 200;
+        thread_pool_executor pool{4};
+        std::vector<std::unique_ptr<async_queue<int>>> queues;
+        for (int i = 0; i <= stages; ++i) queues.push_back(std::make_unique<async_queue<int>>(pool));
+
+        auto stage = [](async_queue<int>& in, async_queue<int>& out) -> async_task {
+            while (std::optional<int> v = co_await in.pop()) out.push(*v + 1);
+            out.close();
+        };
+        std::atomic<long> sum{0};
+        std::latch done{1};
+        auto sink = [&](async_queue<int>& in) -> async_task {
+            while (std::optional<int> v = co_await in.pop()) sum += *v;
+            done.count_down();
+        };
+
+        for (int i = 0; i < stages; ++i) pool.spawn(stage(*queues[i], *queues[i + 1]));
+        pool.spawn(sink(*queues[stages]));
+        for (int i = 0; i < items; ++i) queues[0]->push(i);
+        queues[0]->close();
+        done.wait();
+
+        EXPECT_EQ(sum.load(), static_cast<long>(items) * (items - 1) / 2 + static_cast<long>(items) * stages);
+        pool.stop();
+    }
+}   /* namespace dsa */
+
+#endif /* ASYNC_QUEUE_TEST_H */
@@ -0,0 +1,154 @@
+/**
+ * @file    AlgorithmTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   Vectorized find, count, contains and equal test
+*/
+
+#ifndef ALGORITHM_TEST_H
+#define ALGORITHM_TEST_H
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "AdaptiveContainer.h"
+#include "Algorithm.h"
+#include "Deque.h"
+#include "DoublyLinkedList.h"
+#include "RingBuffer.h"
+#include "SmallVector.h"
+#include "Stack.h"
+#include "queue.h"
+
+namespace dsa {
+    class AlgorithmTest : public testing::Test {
+        public:
+            AlgorithmTest() {}
+            virtual ~AlgorithmTest() {}
+            virtual void SetUp() {}
+            virtual void TearDown() {}
+    };
+
+    /* fill a queue across several deque blocks, starting mid-block, and check every kernel against a plain loop */
+    template <class T>
+    void check_against_scalar() {
+        queue<T> q;
+        for (int i = 0; i < 100; ++i) q.push(static_cast<T>(i));
+        for (int i = 0; i < 37; ++i) q.pop();
+        for (int i = 0; i < 5000; ++i) q.push(static_cast<T>(i % 97));
+
+        deque<T> reference;
+        for (int i = 37; i < 100; ++i) reference.push_back(static_cast<T>(i));
+        for (int i = 0; i < 5000; ++i) reference.push_back(static_cast<T>(i % 97));
+        for (int v : {0, 5, 36, 37, 96, 99, 120}) {
+            std::size_t first = reference.size(), n = 0;
+            for (std::size_t i = 0; i < reference.size(); ++i) {
+                if (reference[i] != static_cast<T>(v)) continue;
+                if (first == reference.size()) first = i;
+                ++n;
+            }
+            EXPECT_EQ(find(q, static_cast<T>(v)), first) << v;
+            EXPECT_EQ(count(q, static_cast<T>(v)), n) << v;
+            EXPECT_EQ(contains(q, static_cast<T>(v)), n != 0) << v;
+        }
+        EXPECT_TRUE(equal(q, reference));
+        reference.back() = static_cast<T>(1);
+        EXPECT_FALSE(equal(q, reference));
+    }
+
+    TEST_F(AlgorithmTest, testArithmeticKernels) {
+        check_against_scalar<std::int8_t>();
+        check_against_scalar<std::uint16_t>();
+        check_against_scalar<int>();
+        check_against_scalar<std::int64_t>();
+        check_against_scalar<float>();
+        check_against_scalar<double>();
+    }
+
+    TEST_F(AlgorithmTest, testFloatingPointEquality) {
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        small_vector<double, 4> v;
+        for (int i = 0; i < 40; ++i) v.push_back(i == 20 ? -0.0 : (i == 30 ? nan : 1.5));
+        EXPECT_EQ(find(v, 0.0), 20u);                               // -0.0 == 0.0
+        EXPECT_EQ(find(v, nan), v.size());                          // NaN matches nothing
+        EXPECT_EQ(count(v, 1.5), 38u);
+        EXPECT_FALSE(v == v);
+        v[30] = 2.0;
+        EXPECT_TRUE(v == v);
+    }
+
+    TEST_F(AlgorithmTest, testSegmentedContainers) {
+        ring_buffer<int, 64> ring;
+        for (int i = 0; i < 100; ++i) ring.push_back(i);             // wraps: 36..63, then 64..99
+        EXPECT_EQ(find(ring, 70), 34u);
+        EXPECT_EQ(find(ring, 10), 64u);
+        EXPECT_EQ(count(ring, 99), 1u);
+
+        adaptive_container<int, 8> adaptive;
+        for (int i = 36; i < 100; ++i) adaptive.push_back(i);
+        EXPECT_TRUE(equal(ring, adaptive));
+        EXPECT_TRUE(equal(adaptive, ring));
+        adaptive.pop_back();
+        EXPECT_FALSE(equal(ring, adaptive));
+
+        small_stack<std::int16_t, 8> s;
+        for (int i = 0; i < 6; ++i) s.push(static_cast<std::int16_t>(i));
+        EXPECT_EQ(find(s, std::int16_t{4}), 4u);                    // counted from the bottom
+        EXPECT_TRUE(contains(s, std::int16_t{0}));
+        EXPECT_FALSE(contains(s, std::int16_t{6}));
+        EXPECT_EQ(find(s, 4), 4u);                                  // an int needle converts to std::int16_t
+    }
+
+    TEST_F(AlgorithmTest, testNeedleConversion) {
+        queue<std::size_t> q;
+        for (std::size_t i = 0; i < 1000; ++i) q.push(i % 10);
+        q.push(std::numeric_limits<std::size_t>::max());
+        EXPECT_TRUE(contains(q, 3));
+        EXPECT_EQ(find(q, 7), 7u);
+        EXPECT_EQ(count(q, 9u), 100u);
+        EXPECT_EQ(count(q, 9.0), 100u);                             // floating needle: scalar path
+        EXPECT_EQ(find(q, -1), 1000u);                              // not representable: std::find semantics
+
+        small_vector<std::uint8_t, 16> bytes;
+        for (int i = 0; i < 64; ++i) bytes.push_back(44);
+        EXPECT_EQ(count(bytes, 44), 64u);
+        EXPECT_EQ(count(bytes, 300), 0u);                           // 300 is not 44 modulo 256
+        EXPECT_FALSE(contains(bytes, -212));
+
+        small_vector<float, 16> floats;
+        for (int i = 0; i < 40; ++i) floats.push_back(i * 0.5f);
+        EXPECT_EQ(find(floats, 3), 6u);
+        EXPECT_EQ(find(floats, 2.5), 5u);
+        EXPECT_EQ(find(floats, 0.1), floats.size());                // 0.1 is not a float
+        EXPECT_EQ(count(floats, 1e300), 0u);
+    }
+
+    TEST_F(AlgorithmTest, testAdaptorEquality) {
+        queue<int> a, b;
+        for (int i = 0; i < 3000; ++i) a.push(i);
+        for (int i = 0; i < 2000; ++i) a.pop();
+        for (int i = 2000; i < 3000; ++i) b.push(i);                // same elements, other block offsets
+        EXPECT_TRUE(a == b);
+        b.push(0);
+        EXPECT_FALSE(a == b);
+
+        stack<std::string> x, y;
+        x.push("alpha");
+        y.push("alpha");
+        EXPECT_TRUE(x == y);
+        EXPECT_EQ(find(x, std::string{"alpha"}), 0u);
+        y.push("beta");
+        EXPECT_TRUE(x != y);
+
+        doubly_linked_list<int> list;
+        for (int i = 0; i < 10; ++i) list.push_back(i % 3);
+        EXPECT_EQ(find(list, 2), 2u);                               // iterator walk
+        EXPECT_EQ(count(list, 0), 4u);
+    }
+}   /* namespace dsa */
+
+#endif /* ALGORITHM_TEST_H */
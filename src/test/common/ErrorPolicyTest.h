@@ -0,0 +1,129 @@
+/**
+ * @file    ErrorPolicyTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   Error policy and try_pop test
+*/
+
+#ifndef ERROR_POLICY_TEST_H
+#define ERROR_POLICY_TEST_H
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ErrorPolicy.h"
+#include "DoublyLinkedList.h"
+#include "Deque.h"
+#include "Stack.h"
+#include "queue.h"
+#include "TrailStack.h"
+
+namespace dsa {
+    static_assert(error_policy<checked_policy>);
+    static_assert(error_policy<unchecked_policy>);
+    static_assert(error_policy<assert_only_policy>);
+    static_assert(!noexcept(std::declval<doubly_linked_list<int>&>().pop_back()));
+    static_assert(noexcept(std::declval<doubly_linked_list<int, unchecked_policy>&>().pop_back()));
+    static_assert(noexcept(std::declval<doubly_linked_list<int, assert_only_policy>&>().front()));
+    static_assert(noexcept(std::declval<deque<int>&>().pop_front()));
+    static_assert(!noexcept(std::declval<deque<int, 4096, checked_policy>&>().pop_front()));
+    static_assert(!noexcept(std::declval<stack<int>&>().pop()));
+    static_assert(noexcept(std::declval<stack<int, deque<int>, unchecked_policy>&>().top()));
+    static_assert(!noexcept(std::declval<queue<int, doubly_linked_list<int>, unchecked_policy>&>().pop()));
+
+    class ErrorPolicyTest : public testing::Test {
+        public:
+            ErrorPolicyTest() {}
+            virtual ~ErrorPolicyTest() {}
+            virtual void SetUp() {}
+            virtual void TearDown() {}
+    };
+
+    TEST_F(ErrorPolicyTest, testCheckedPolicy) {
+        doubly_linked_list<int> list;
+        EXPECT_THROW(list.pop_back(), std::runtime_error);
+        EXPECT_THROW(list.pop_front(), std::runtime_error);
+        EXPECT_THROW(list.front(), std::runtime_error);
+        EXPECT_THROW(list.erase(list.end()), std::runtime_error);
+
+        deque<int, 64, checked_policy> d;
+        EXPECT_THROW(d.pop_front(), std::runtime_error);
+        EXPECT_THROW(d.back(), std::runtime_error);
+        d.push_back(1);
+        EXPECT_EQ(d.front(), 1);
+        d.pop_back();
+        EXPECT_TRUE(d.empty());
+    }
+
+    TEST_F(ErrorPolicyTest, testTryPop) {
+        doubly_linked_list<std::unique_ptr<int>, unchecked_policy> list;
+        EXPECT_FALSE(list.try_pop_front().has_value());
+        list.push_back(std::make_unique<int>(1));
+        list.push_back(std::make_unique<int>(2));
+        EXPECT_EQ(*list.try_pop_back().value(), 2);
+        EXPECT_EQ(*list.try_pop_front().value(), 1);
+        EXPECT_FALSE(list.try_pop_back().has_value());
+        EXPECT_TRUE(list.empty());
+
+        deque<std::string, 64> d;
+        for (int i = 0; i < 40; ++i) d.push_back(std::to_string(i));
+        int expected = 0;
+        while (std::optional<std::string> v = d.try_pop_front()) EXPECT_EQ(*v, std::to_string(expected++));
+        EXPECT_EQ(expected, 40);
+        EXPECT_FALSE(d.try_pop_back().has_value());
+    }
+
+    TEST_F(ErrorPolicyTest, testAdaptors) {
+        stack<int> s;
+        EXPECT_THROW(s.pop(), std::runtime_error);      /* checked by default, over an unchecked deque */
+        EXPECT_THROW(s.top(), std::runtime_error);
+        EXPECT_FALSE(s.try_top().has_value());
+        EXPECT_FALSE(s.try_pop().has_value());
+        s.push(1);
+        s.push(2);
+        EXPECT_EQ(s.try_top(), 2);
+        EXPECT_EQ(s.try_pop(), 2);
+        EXPECT_EQ(s.size(), 1);
+
+        stack<int, std::vector<int>> vs;                /* a container without try_pop_back */
+        vs.push(3);
+        EXPECT_EQ(vs.try_pop(), 3);
+        EXPECT_FALSE(vs.try_pop().has_value());
+
+        queue<int, doubly_linked_list<int>> q;
+        EXPECT_FALSE(q.try_pop().has_value());
+        EXPECT_THROW(q.pop(), std::runtime_error);
+        q.push(4);
+        q.push(5);
+        EXPECT_EQ(q.try_pop(), 4);
+        EXPECT_EQ(q.front(), 5);
+
+        const queue<int> empty;
+        EXPECT_THROW(empty.front(), std::runtime_error);
+        EXPECT_THROW(empty.back(), std::runtime_error);
+
+        trail_stack<int, 4> trail;                      /* checked by default, over an unchecked small_vector */
+        EXPECT_THROW(trail.pop(), std::runtime_error);
+        EXPECT_THROW(trail.top(), std::runtime_error);
+        trail.push(1);
+        const auto deep = trail.mark();
+        trail.pop();
+        EXPECT_THROW(trail.rollback(deep), std::runtime_error);
+        EXPECT_EQ(trail.size(), 0);
+        static_assert(std::is_same_v<trail_stack<int>::container_type, small_vector<int, 64, unchecked_policy>>);
+    }
+
+#ifndef NDEBUG
+    TEST_F(ErrorPolicyTest, testAssertOnlyPolicy) {
+        doubly_linked_list<int, assert_only_policy> list;
+        EXPECT_DEATH(list.pop_back(), "Empty list");
+    }
+#endif
+}   /* namespace dsa */
+
+#endif /* ERROR_POLICY_TEST_H */
@@ -0,0 +1,133 @@
+/**
+ * @file    MemoryUsageTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   Memory footprint reporting test
+*/
+
+#ifndef MEMORY_USAGE_TEST_H
+#define MEMORY_USAGE_TEST_H
+
+#include <sstream>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "MemoryUsage.h"
+#include "DoublyLinkedList.h"
+#include "SinglyLinkedList.h"
+#include "Deque.h"
+#include "FlatHashMap.h"
+#include "SkipList.h"
+#include "Stack.h"
+#include "queue.h"
+
+namespace dsa {
+    class MemoryUsageTest : public testing::Test {
+        protected:
+            memory_registry registry;
+
+        public:
+            MemoryUsageTest() {}
+            virtual ~MemoryUsageTest() {}
+            virtual void SetUp() {}
+            virtual void TearDown() {}
+    };
+
+    TEST_F(MemoryUsageTest, testAllocationSlack) {
+        EXPECT_EQ(allocation_slack(0), 0);
+        EXPECT_EQ(allocation_slack(1) + 1, 4 * sizeof(void*));
+        EXPECT_EQ((allocation_slack(100) + 100) % (2 * sizeof(void*)), 0);
+        EXPECT_GE(allocation_slack(100), sizeof(std::size_t));
+    }
+
+    TEST_F(MemoryUsageTest, testLists) {
+        doubly_linked_list<int> dll;
+        SinglyLinkedList<int> sll;
+        const std::size_t empty_dll = dll.memory_usage().total();
+        EXPECT_EQ(empty_dll, sizeof(dll));
+        EXPECT_EQ(sll.memory_usage().total(), sizeof(sll));
+
+        for (int i = 0; i < 10; ++i) {
+            dll.push_back(i);
+            sll.addLast(i);
+        }
+        memory_footprint m = dll.memory_usage();
+        EXPECT_EQ(m.payload_bytes, 10 * sizeof(int));
+        EXPECT_EQ(m.overhead_bytes, sizeof(dll) + 10 * (sizeof(__list_node<int>) - sizeof(int)));
+        EXPECT_EQ(m.allocations, 10);
+        EXPECT_GT(m.slack_bytes, 0);
+        EXPECT_EQ(sll.memory_usage().payload_bytes, 10 * sizeof(int));
+        EXPECT_EQ(sll.memory_usage().allocations, 10);
+
+        /* After defragment() the nodes share one slab */
+        dll.defragment();
+        dll.pop_back();
+        m = dll.memory_usage();
+        EXPECT_EQ(m.payload_bytes, 9 * sizeof(int));
+        EXPECT_EQ(m.allocations, 2);                /* the slab and the slab index */
+        EXPECT_LT(m.slack_bytes, 10 * allocation_slack(sizeof(__list_node<int>)));
+    }
+
+    TEST_F(MemoryUsageTest, testArraysAndAdaptors) {
+        deque<int, 64> d;
+        for (int i = 0; i < 20; ++i) d.push_back(i);
+        memory_footprint m = d.memory_usage();
+        EXPECT_EQ(m.payload_bytes, 20 * sizeof(int));
+        EXPECT_EQ(m.allocations, 3);                /* two blocks and the map */
+
+        stack<int, deque<int, 64>> s{d};
+        EXPECT_EQ(s.memory_usage().total(), d.memory_usage().total());
+        queue<int, deque<int, 64>> q{d};
+        EXPECT_EQ(q.memory_usage().payload_bytes, 20 * sizeof(int));
+
+        flat_hash_map<int, int> map;
+        for (int i = 0; i < 100; ++i) map[i] = i;
+        m = map.memory_usage();
+        EXPECT_EQ(m.payload_bytes, 100 * sizeof(std::pair<const int, int>));
+        EXPECT_GE(m.overhead_bytes, map.capacity());  /* one control byte per slot */
+        EXPECT_EQ(m.allocations, 1);
+
+        skip_list<int, int> sl;
+        for (int i = 0; i < 50; ++i) sl.insert(i, i);
+        sl.erase(0);
+        m = sl.memory_usage();
+        EXPECT_EQ(m.payload_bytes, 49 * sizeof(std::pair<const int, int>));
+        EXPECT_EQ(m.allocations, 50);               /* the erased node is retired, not freed */
+    }
+
+    TEST_F(MemoryUsageTest, testRegistry) {
+        doubly_linked_list<int> a, b;
+        deque<int> c;
+        for (int i = 0; i < 100; ++i) a.push_back(i);
+        c.push_back(1);
+        {
+            auto ra = registry.track(a, "sessions");
+            auto rb = registry.track(b, "sessions");
+            auto rc = registry.track(c);
+            EXPECT_EQ(registry.size(), 3);
+
+            std::vector<memory_report_entry> report = registry.report();
+            ASSERT_EQ(report.size(), 2);
+            EXPECT_GE(report[0].usage.total(), report[1].usage.total());
+            const memory_report_entry& sessions = report[0].label == "sessions" ? report[0] : report[1];
+            const memory_report_entry& by_type = report[0].label == "sessions" ? report[1] : report[0];
+            EXPECT_EQ(sessions.containers, 2);
+            EXPECT_EQ(sessions.usage.total(), a.memory_usage().total() + b.memory_usage().total());
+            EXPECT_NE(by_type.label.find("deque"), std::string::npos);
+            EXPECT_EQ(by_type.containers, 1);
+
+            std::ostringstream out;
+            registry.dump(out);
+            EXPECT_NE(out.str().find("sessions"), std::string::npos);
+            EXPECT_NE(out.str().find("total"), std::string::npos);
+
+            auto moved = std::move(rc);
+            rb.reset();
+            EXPECT_EQ(registry.size(), 2);
+        }
+        EXPECT_EQ(registry.size(), 0);
+    }
+}   /* namespace dsa */
+
+#endif /* MEMORY_USAGE_TEST_H */
@@ -0,0 +1,85 @@
+/**
+ * @file    TypeTraitsTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   Relocation trait and trivial fast path test
+*/
+
+#ifndef TYPE_TRAITS_TEST_H
+#define TYPE_TRAITS_TEST_H
+
+#include <memory>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "TypeTraits.h"
+#include "DoublyLinkedList.h"
+#include "Deque.h"
+#include "FlatHashMap.h"
+
+namespace dsa {
+    /** @brief owns a heap int and counts its moves: relocatable, but not trivially copyable */
+    struct __relocatable_box {
+        static inline int moves = 0;
+        std::unique_ptr<int> value;
+
+        explicit __relocatable_box(int __v) : value{std::make_unique<int>(__v)} {}
+        __relocatable_box(__relocatable_box&& __x) noexcept : value{std::move(__x.value)} { ++moves; }
+    };
+
+    template <>
+    struct is_trivially_relocatable<__relocatable_box> : std::true_type {};
+
+    static_assert(is_trivially_relocatable_v<int>);
+    static_assert(is_trivially_relocatable_v<const double>);
+    static_assert(is_trivially_relocatable_v<std::pair<const int, long>>);
+    static_assert(!is_trivially_relocatable_v<std::string>);
+    static_assert(!is_trivially_relocatable_v<std::pair<const std::string, int>>);
+    static_assert(is_trivially_relocatable_v<std::pair<const int, __relocatable_box>>);
+
+    class TypeTraitsTest : public testing::Test {
+        protected:
+            void SetUp() override { __relocatable_box::moves = 0; }
+    };
+
+    TEST_F(TypeTraitsTest, testDefragmentRelocates) {
+        doubly_linked_list<__relocatable_box> list;
+        for (int i = 0; i < 10; ++i) list.emplace_back(i);
+        list.defragment();
+        EXPECT_EQ(__relocatable_box::moves, 0);
+        int expected = 0;
+        for (auto& box : list) EXPECT_EQ(*box.value, expected++);
+    }
+
+    TEST_F(TypeTraitsTest, testRehashRelocates) {
+        flat_hash_map<int, __relocatable_box> map;
+        for (int i = 0; i < 1000; ++i) map.try_emplace(i, i);
+        EXPECT_EQ(__relocatable_box::moves, 0);
+        for (int i = 0; i < 1000; ++i) EXPECT_EQ(*map.at(i).value, i);
+    }
+
+    TEST_F(TypeTraitsTest, testTrivialCopies) {
+        flat_hash_map<int, int> map;
+        for (int i = 0; i < 100; ++i) map[i] = -i;
+        map.erase(7);
+        flat_hash_map<int, int> copy{map};
+        EXPECT_EQ(copy.size(), 99);
+        EXPECT_EQ(copy.capacity(), map.capacity());
+        EXPECT_FALSE(copy.contains(7));
+        EXPECT_EQ(copy.at(42), -42);
+        copy[7] = 7;
+        EXPECT_EQ(copy.size(), 100);
+
+        deque<int, 64> d;
+        for (int i = 0; i < 50; ++i) d.push_back(i);
+        for (int i = 1; i <= 7; ++i) d.push_front(-i);      /* the first block is partly used */
+        deque<int, 64> dcopy{d};
+        ASSERT_EQ(dcopy.size(), d.size());
+        for (std::size_t i = 0; i < d.size(); ++i) EXPECT_EQ(dcopy[i], d[i]);
+        dcopy.push_back(99);
+        EXPECT_EQ(dcopy.back(), 99);
+    }
+}   /* namespace dsa */
+
+#endif /* TYPE_TRAITS_TEST_H */
@@ -0,0 +1,102 @@
+/**
+ * @file    DequeTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A block-based deque test
+*/
+
+#ifndef DEQUE_TEST_H
+#define DEQUE_TEST_H
+
+#include <string>
+#include <gtest/gtest.h>
+
+#include "Deque.h"
+
+namespace dsa {
+    class DequeTest : public testing::Test {
+        protected:
+            deque<int, 64> my_deque;        // 16 ints per block, so the tests cross block boundaries
+
+        public:
+            DequeTest() {}
+            virtual ~DequeTest() {}
+            virtual void SetUp() {}
+            virtual void TearDown() {}
+    };
+
+    TEST_F(DequeTest, testEmptyDeque) {
+        EXPECT_TRUE(my_deque.empty());
+        EXPECT_EQ(my_deque.size(), 0);
+        EXPECT_EQ(my_deque.begin(), my_deque.end());
+    }
+
+    TEST_F(DequeTest, testPushBackFront) {
+        for (int i = 0; i < 100; ++i) my_deque.push_back(i);
+        for (int i = 1; i <= 100; ++i) my_deque.push_front(-i);
+        EXPECT_EQ(my_deque.size(), 200);
+        EXPECT_EQ(my_deque.front(), -100);
+        EXPECT_EQ(my_deque.back(), 99);
+        for (int i = 0; i < 200; ++i) EXPECT_EQ(my_deque[i], i - 100);
+        EXPECT_THROW(my_deque.at(200), std::out_of_range);
+    }
+
+    TEST_F(DequeTest, testPopBackFront) {
+        for (int i = 0; i < 50; ++i) my_deque.push_back(i);
+        for (int i = 0; i < 20; ++i) my_deque.pop_front();
+        for (int i = 0; i < 20; ++i) my_deque.pop_back();
+        EXPECT_EQ(my_deque.size(), 10);
+        EXPECT_EQ(my_deque.front(), 20);
+        EXPECT_EQ(my_deque.back(), 29);
+    }
+
+    TEST_F(DequeTest, testOscillationReusesBlocks) {
+        for (int i = 0; i < 160; ++i) my_deque.push_back(i);
+        for (int i = 0; i < 160; ++i) my_deque.pop_back();
+        EXPECT_EQ(my_deque.cached_blocks(), 10);
+
+        for (int round = 0; round < 100; ++round) {
+            for (int i = 0; i < 160; ++i) my_deque.push_back(i);
+            EXPECT_EQ(my_deque.cached_blocks(), 0);
+            for (int i = 0; i < 160; ++i) my_deque.pop_front();
+        }
+        EXPECT_TRUE(my_deque.empty());
+
+        my_deque.shrink_to_fit();
+        EXPECT_EQ(my_deque.cached_blocks(), 0);
+    }
+
+    TEST_F(DequeTest, testReserve) {
+        my_deque.reserve(100);
+        EXPECT_EQ(my_deque.cached_blocks(), 7);
+        for (int i = 0; i < 100; ++i) my_deque.push_back(i);
+        EXPECT_EQ(my_deque.cached_blocks(), 0);
+    }
+
+    TEST_F(DequeTest, testCopyMove) {
+        for (int i = 0; i < 40; ++i) my_deque.push_front(i);
+        deque<int, 64> copy{my_deque};
+        EXPECT_EQ(copy.size(), 40);
+        EXPECT_TRUE(std::equal(copy.begin(), copy.end(), my_deque.begin()));
+
+        deque<int, 64> moved{std::move(copy)};
+        EXPECT_TRUE(copy.empty());
+        EXPECT_EQ(moved.front(), 39);
+        EXPECT_EQ(moved.back(), 0);
+    }
+
+    TEST(DequeNonTrivialTest, testStrings) {
+        deque<std::string> strings;
+        strings.emplace_back(40, 'x');
+        strings.emplace_front("front");
+        strings.push_back("back");
+        EXPECT_EQ(strings.front(), "front");
+        EXPECT_EQ(strings[1], std::string(40, 'x'));
+        strings.pop_front();
+        strings.clear();
+        EXPECT_TRUE(strings.empty());
+    }
+}   /* namespace dsa */
+
+#endif /* DEQUE_TEST_H */
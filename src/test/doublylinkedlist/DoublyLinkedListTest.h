@@ -11,7 +11,10 @@
 #define D_LINKED_LIST_TEST_H
 
 #include <iostream>
+#include <iterator>
 #include <list>
+#include <sstream>
+#include <string>
 #include <DoublyLinkedList.h>
 
 #include <type_traits>
@@ -101,11 +104,20 @@ namespace dsa {
     }
 
     TEST_F(LinkListTest, testEnd) {
-        EXPECT_EQ(list->end(), dsa::doubly_linked_list<int>::iterator(nullptr));
+        auto end = list->end();
+        EXPECT_EQ(list->begin(), end);
+        list->push_back(1);
+        list->push_back(2);
+        EXPECT_EQ(list->end(), end);
+        EXPECT_EQ(*(--list->end()), 2);
     }
 
     TEST_F(LinkListTest, testCEnd) {
-        EXPECT_EQ(list->cend(), dsa::doubly_linked_list<int>::iterator(nullptr));
+        auto cend = list->cend();
+        EXPECT_EQ(list->cbegin(), cend);
+        list->push_front(1);
+        EXPECT_EQ(list->cend(), cend);
+        EXPECT_EQ(*(--list->cend()), 1);
     }
 
     /* Element access */
@@ -156,7 +168,7 @@ namespace dsa {
     /* erase */
     TEST_F(LinkListTest, testEraseNon) {
         try {
-            list->erase(dsa::doubly_linked_list<int>::iterator(nullptr));
+            list->erase(list->end());
         }catch (const std::runtime_error& err) {
             EXPECT_EQ(err.what(), std::string("Non-dereferenceable iterator"));
         }catch(...) {
@@ -177,6 +189,28 @@ namespace dsa {
         EXPECT_EQ(list->size(), 0);
     }
 
+    TEST_F(LinkListTest, testEraseMiddle) {
+        for (int i = 0; i < 5; ++i) list->push_back(i);
+        auto it = list->erase(std::next(list->begin(), 2));
+        EXPECT_EQ(*it, 3);
+        it = list->erase(std::next(list->begin(), 3));
+        EXPECT_EQ(it, list->end());
+        std::vector<int> values(list->begin(), list->end());
+        EXPECT_EQ(values, (std::vector<int>{0, 1, 3}));
+        std::vector<int> reversed;
+        for (auto r = list->end(); r != list->begin();) reversed.push_back(*--r);
+        EXPECT_EQ(reversed, (std::vector<int>{3, 1, 0}));
+    }
+
+    TEST_F(LinkListTest, testEraseSubRange) {
+        for (int i = 0; i < 6; ++i) list->push_back(i);
+        auto it = list->erase(std::next(list->begin()), std::next(list->begin(), 4));
+        EXPECT_EQ(*it, 4);
+        EXPECT_EQ(list->size(), 3);
+        EXPECT_EQ(list->front(), 0);
+        EXPECT_EQ(list->back(), 5);
+    }
+
     TEST_F(LinkListTest, testEraseFirstLast) {
         list->push_back(1);
         list->push_back(2);
@@ -185,6 +219,205 @@ namespace dsa {
         EXPECT_EQ(list->size(), 0);
     }
 
+    TEST_F(LinkListTest, testForEachPrefetch) {
+        for (int i = 1; i <= 100; ++i) list->push_back(i);
+        int sum = 0;
+        list->for_each_prefetch([&](int& v) { sum += v; v = 0; }, 8);
+        EXPECT_EQ(sum, 5050);
+        EXPECT_EQ(list->front(), 0);
+        EXPECT_EQ(list->back(), 0);
+    }
+
+    TEST_F(LinkListTest, testDefragment) {
+        for (int i = 0; i < 10; ++i) {
+            list->push_back(i);
+            list->push_front(-i - 1);
+        }
+        list->erase(list->begin());
+        list->defragment();
+
+        std::vector<int> values(list->begin(), list->end());
+        EXPECT_EQ(values.size(), 19);
+        EXPECT_EQ(values.front(), -9);
+        EXPECT_EQ(values.back(), 9);
+
+        /* Neighbours in the list are neighbours in memory */
+        const char* first = reinterpret_cast<const char*>(&list->front());
+        const char* second = reinterpret_cast<const char*>(&*std::next(list->begin()));
+        EXPECT_EQ(second - first, static_cast<std::ptrdiff_t>(sizeof(dsa::__list_node<int>)));
+
+        /* Erased slab nodes are reused */
+        list->pop_back();
+        list->push_front(42);
+        EXPECT_EQ(reinterpret_cast<const char*>(&list->front()), first + 18 * sizeof(dsa::__list_node<int>));
+    }
+
+    TEST_F(LinkListTest, testSplice) {
+        for (int i = 0; i < 5; ++i) list->push_back(i);
+        doubly_linked_list<int> other;
+        for (int i = 10; i < 13; ++i) other.push_back(i);
+
+        /* A single node keeps its address */
+        const int* moved = &other.front();
+        list->splice(list->begin(), other, other.cbegin());
+        EXPECT_EQ(&list->front(), moved);
+        EXPECT_EQ(other.size(), 2);
+
+        list->splice(list->end(), other);
+        EXPECT_TRUE(other.empty());
+        EXPECT_EQ(list->size(), 8);
+        std::vector<int> values(list->begin(), list->end());
+        EXPECT_EQ(values, (std::vector<int>{10, 0, 1, 2, 3, 4, 11, 12}));
+
+        /* Within the same list */
+        list->splice(list->end(), *list, list->cbegin());
+        EXPECT_EQ(list->back(), 10);
+        EXPECT_EQ(list->size(), 8);
+
+        /* Slabs of a defragmented list change owner with its nodes */
+        other.push_back(7);
+        other.push_back(8);
+        other.defragment();
+        other.pop_back();
+        list->splice(list->begin(), other);
+        EXPECT_EQ(list->front(), 7);
+        list->push_back(9);
+        EXPECT_EQ(list->size(), 10);
+    }
+
+    TEST_F(LinkListTest, testRangeConstruction) {
+        std::vector<int> source{1, 2, 3, 4, 5};
+        doubly_linked_list<int> from_range(source.begin(), source.end());
+        EXPECT_EQ(from_range.size(), 5);
+        EXPECT_EQ(from_range.memory_usage().allocations, 2);      /* one slab and its index */
+        EXPECT_TRUE(std::equal(from_range.begin(), from_range.end(), source.begin()));
+
+        doubly_linked_list<int> from_list{7, 8, 9};
+        EXPECT_EQ(from_list.front(), 7);
+        EXPECT_EQ(from_list.back(), 9);
+
+        std::istringstream in{"4 5 6"};
+        doubly_linked_list<int> from_stream{std::istream_iterator<int>(in), std::istream_iterator<int>()};
+        EXPECT_EQ(from_stream.size(), 3);
+        EXPECT_EQ(from_stream.back(), 6);
+    }
+
+    TEST_F(LinkListTest, testInsertRange) {
+        for (int i = 0; i < 4; ++i) list->push_back(i);
+        std::vector<int> source{10, 11, 12};
+        auto it = list->insert(std::next(list->cbegin(), 2), source.begin(), source.end());
+        EXPECT_EQ(*it, 10);
+        EXPECT_EQ(list->size(), 7);
+        std::vector<int> values(list->begin(), list->end());
+        EXPECT_EQ(values, (std::vector<int>{0, 1, 10, 11, 12, 2, 3}));
+
+        EXPECT_EQ(list->insert(list->cend(), source.begin(), source.begin()), list->end());
+        list->insert(list->cbegin(), {-1});
+        EXPECT_EQ(list->front(), -1);
+
+        /* Slab nodes are reused after erase */
+        list->erase(std::next(list->begin(), 3));
+        list->push_back(99);
+        EXPECT_EQ(list->memory_usage().allocations, 7);        /* 5 single nodes, 1 slab, the slab index */
+    }
+
+    TEST_F(LinkListTest, testCopyMoveAssign) {
+        for (int i = 0; i < 6; ++i) list->push_back(i);
+        doubly_linked_list<int> copy{*list};
+        EXPECT_EQ(copy.size(), 6);
+        EXPECT_TRUE(std::equal(copy.begin(), copy.end(), list->begin()));
+        copy.front() = 42;
+        EXPECT_EQ(list->front(), 0);
+
+        doubly_linked_list<int> moved{std::move(copy)};
+        EXPECT_TRUE(copy.empty());
+        EXPECT_EQ(copy.begin(), copy.end());
+        EXPECT_EQ(moved.front(), 42);
+        EXPECT_EQ(moved.size(), 6);
+
+        copy = moved;
+        EXPECT_EQ(copy.size(), 6);
+        copy = {1, 2};
+        EXPECT_EQ(copy.size(), 2);
+        EXPECT_EQ(copy.back(), 2);
+        copy.assign({5, 6, 7, 8});
+        EXPECT_EQ(copy.size(), 4);
+        EXPECT_EQ(copy.back(), 8);
+
+        moved = std::move(copy);
+        EXPECT_EQ(moved.size(), 4);
+        EXPECT_EQ(moved.front(), 5);
+        EXPECT_TRUE(copy.empty());
+        copy.push_back(1);
+        EXPECT_EQ(copy.size(), 1);
+    }
+
+    TEST_F(LinkListTest, testInsertClearCycles) {
+        std::vector<int> source(1000);
+        for (int i = 0; i < 1000; ++i) source[i] = i;
+        list->insert(list->cend(), source.begin(), source.end());
+        list->clear();
+        const memory_footprint first = list->memory_usage();
+
+        /* Idle slab nodes are reused instead of allocating a slab per round */
+        for (int round = 0; round < 100; ++round) {
+            list->insert(list->cend(), source.begin(), source.end());
+            EXPECT_EQ(list->size(), 1000);
+            list->clear();
+        }
+        EXPECT_EQ(list->memory_usage().allocations, first.allocations);
+        EXPECT_EQ(list->memory_usage().overhead_bytes, first.overhead_bytes);
+
+        doubly_linked_list<int> a, b{source.begin(), source.end()};
+        for (int round = 0; round < 100; ++round) {
+            a.clear();
+            a = b;
+        }
+        EXPECT_EQ(a.size(), 1000);
+        EXPECT_EQ(a.memory_usage().allocations, 2);             /* 1 slab, the slab index */
+    }
+
+    TEST_F(LinkListTest, testDeferredReclaim) {
+        doubly_linked_list<std::string> strings;
+        strings.set_reclaim_mode(reclaim_mode::deferred);
+        for (int i = 0; i < 100; ++i) strings.push_back(std::string(32, 'a' + i % 26));
+
+        strings.erase(std::next(strings.begin(), 10), std::next(strings.begin(), 30));
+        EXPECT_EQ(strings.size(), 80);
+        EXPECT_EQ(strings.retired_size(), 20);
+        EXPECT_EQ(std::distance(strings.begin(), strings.end()), 80);
+
+        strings.clear();
+        EXPECT_TRUE(strings.empty());
+        EXPECT_EQ(strings.begin(), strings.end());
+        EXPECT_EQ(strings.retired_size(), 100);
+
+        EXPECT_EQ(strings.reclaim_some(30), 30);
+        EXPECT_EQ(strings.retired_size(), 70);
+
+        /* New elements recycle retired nodes */
+        strings.push_back("x");
+        strings.emplace_front(5, 'y');
+        EXPECT_EQ(strings.retired_size(), 68);
+        EXPECT_EQ(strings.front(), "yyyyy");
+        EXPECT_EQ(strings.back(), "x");
+
+        EXPECT_EQ(strings.reclaim_some(1000), 68);
+        EXPECT_EQ(strings.retired_size(), 0);
+        EXPECT_EQ(strings.memory_usage().allocations, 2);
+
+        /* Retired slab nodes are reclaimed before the slab goes away */
+        strings.defragment();
+        strings.clear();
+        doubly_linked_list<std::string> other{std::move(strings)};
+        EXPECT_EQ(other.retired_size(), 2);
+        other = {"a", "b", "c"};
+        other.erase(other.begin(), std::next(other.begin()));
+        doubly_linked_list<std::string> target;
+        target.splice(target.end(), other);
+        EXPECT_EQ(target.size(), 2);
+        EXPECT_EQ(other.retired_size(), 0);
+    }
 
 #endif  /* if 0 */
 }   /* namespace dsa */
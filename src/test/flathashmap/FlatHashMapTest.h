@@ -0,0 +1,136 @@
+/**
+ * @file    FlatHashMapTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A flat hash map test
+*/
+
+#ifndef FLAT_HASH_MAP_TEST_H
+#define FLAT_HASH_MAP_TEST_H
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <gtest/gtest.h>
+
+#include "FlatHashMap.h"
+
+namespace dsa {
+    class FlatHashMapTest : public testing::Test {
+        protected:
+            flat_hash_map<int, int> my_map;
+
+        public:
+            FlatHashMapTest() {}
+            virtual ~FlatHashMapTest() {}
+            virtual void SetUp() {}
+            virtual void TearDown() {}
+    };
+
+    TEST_F(FlatHashMapTest, testEmptyMap) {
+        EXPECT_TRUE(my_map.empty());
+        EXPECT_EQ(my_map.size(), 0);
+        EXPECT_EQ(my_map.capacity(), 0);
+        EXPECT_EQ(my_map.find(1), my_map.end());
+        EXPECT_EQ(my_map.begin(), my_map.end());
+    }
+
+    TEST_F(FlatHashMapTest, testInsertFind) {
+        EXPECT_TRUE(my_map.insert({1, 10}).second);
+        EXPECT_FALSE(my_map.insert({1, 11}).second);
+        my_map[2] = 20;
+        EXPECT_EQ(my_map.size(), 2);
+        EXPECT_EQ(my_map.at(1), 10);
+        EXPECT_EQ(my_map.find(2)->second, 20);
+        EXPECT_TRUE(my_map.contains(2));
+        EXPECT_EQ(my_map.count(3), 0);
+        EXPECT_THROW(my_map.at(3), std::out_of_range);
+    }
+
+    TEST_F(FlatHashMapTest, testGrowAndErase) {
+        for (int i = 0; i < 10000; ++i) my_map.try_emplace(i, i * 3);
+        EXPECT_EQ(my_map.size(), 10000);
+        EXPECT_LE(my_map.load_factor(), my_map.max_load_factor());
+
+        for (int i = 0; i < 10000; i += 2) EXPECT_EQ(my_map.erase(i), 1);
+        EXPECT_EQ(my_map.erase(0), 0);
+        EXPECT_EQ(my_map.size(), 5000);
+        for (int i = 0; i < 10000; ++i) EXPECT_EQ(my_map.contains(i), i % 2 == 1);
+
+        std::size_t n = 0;
+        for (const auto& kv : my_map) {
+            EXPECT_EQ(kv.second, kv.first * 3);
+            ++n;
+        }
+        EXPECT_EQ(n, 5000);
+    }
+
+    TEST_F(FlatHashMapTest, testChurnReusesTombstones) {
+        my_map.reserve(100);
+        const std::size_t capacity = my_map.capacity();
+        for (int round = 0; round < 1000; ++round) {
+            for (int i = 0; i < 50; ++i) my_map[round * 50 + i] = i;
+            for (int i = 0; i < 50; ++i) my_map.erase(round * 50 + i);
+        }
+        EXPECT_TRUE(my_map.empty());
+        EXPECT_EQ(my_map.capacity(), capacity);
+    }
+
+    TEST_F(FlatHashMapTest, testEraseIteratorAndCopy) {
+        for (int i = 0; i < 100; ++i) my_map[i] = i;
+        for (auto it = my_map.begin(); it != my_map.end();)
+            it = it->first % 3 == 0 ? my_map.erase(it) : std::next(it);
+        flat_hash_map<int, int> copy{my_map};
+        EXPECT_EQ(copy.size(), 66);
+        EXPECT_FALSE(copy.contains(99));
+        EXPECT_TRUE(copy.contains(98));
+        flat_hash_map<int, int> moved{std::move(copy)};
+        EXPECT_EQ(moved.size(), 66);
+        EXPECT_TRUE(copy.empty());
+    }
+
+    struct __string_hash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view __s) const { return std::hash<std::string_view>{}(__s); }
+    };
+
+    /* a hash that throws once its budget of calls is spent */
+    struct throwing_hash {
+        static inline int budget = -1;
+        std::size_t operator()(const std::string& s) const {
+            if (budget == 0) throw std::runtime_error("hash");
+            if (budget > 0) --budget;
+            return std::hash<std::string>{}(s);
+        }
+    };
+
+    TEST(FlatHashMapRehashTest, testThrowingHashLeavesMapUnchanged) {
+        flat_hash_map<std::string, std::string, throwing_hash> map;
+        for (int i = 0; i < 14; ++i) map.try_emplace(std::to_string(i), std::string(40, 'a' + i));
+        const std::size_t capacity = map.capacity();
+
+        throwing_hash::budget = 2 + 5;                          // lookup and insert hash, then 5 elements of the rehash
+        EXPECT_THROW(map.try_emplace("14", "x"), std::runtime_error);
+        throwing_hash::budget = -1;
+        EXPECT_EQ(map.size(), 14);
+        EXPECT_EQ(map.capacity(), capacity);
+        for (int i = 0; i < 14; ++i) EXPECT_EQ(map.at(std::to_string(i)), std::string(40, 'a' + i));
+
+        map.try_emplace("14", "x");
+        EXPECT_GT(map.capacity(), capacity);
+        EXPECT_EQ(map.at("14"), "x");
+    }
+
+    TEST(FlatHashMapHeterogeneousTest, testStringViewLookup) {
+        flat_hash_map<std::string, int, __string_hash, std::equal_to<>> map;
+        map.try_emplace("alpha", 1);
+        map.emplace("beta", 2);
+        EXPECT_TRUE(map.contains(std::string_view{"alpha"}));
+        EXPECT_EQ(map.find(std::string_view{"beta"})->second, 2);
+        EXPECT_EQ(map.erase(std::string_view{"alpha"}), 1);
+        EXPECT_FALSE(map.contains(std::string{"alpha"}));
+    }
+}   /* namespace dsa */
+
+#endif /* FLAT_HASH_MAP_TEST_H */
@@ -0,0 +1,113 @@
+/**
+ * @file    LaneQueueTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A multi-lane priority and deficit round robin queue test
+*/
+
+#ifndef LANE_QUEUE_TEST_H
+#define LANE_QUEUE_TEST_H
+
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "LaneQueue.h"
+
+namespace dsa {
+    class LaneQueueTest : public testing::Test {
+        public:
+            LaneQueueTest() {}
+            virtual ~LaneQueueTest() {}
+            virtual void SetUp() {}
+            virtual void TearDown() {}
+    };
+
+    TEST_F(LaneQueueTest, testStrictPriority) {
+        lane_queue<std::string, 3> q;
+        EXPECT_EQ(q.pop(), std::nullopt);
+        q.push(2, "batch 1");
+        q.push(2, "batch 2");
+        q.push(0, "interactive");
+        q.emplace(1, 3, 'n');
+        EXPECT_EQ(q.size(), 4u);
+        EXPECT_EQ(q.occupied(), 0b111u);
+        EXPECT_EQ(q.top_lane(), 0u);
+        EXPECT_EQ(q.pop(), "interactive");
+        EXPECT_EQ(q.pop(), "nnn");
+        EXPECT_EQ(q.occupied(), 0b100u);
+        q.push(0, "late interactive");
+        EXPECT_EQ(q.pop(), "late interactive");
+        EXPECT_EQ(q.pop(), "batch 1");
+        EXPECT_EQ(q.pop(2), "batch 2");
+        EXPECT_TRUE(q.empty());
+        EXPECT_EQ(q.occupied(), 0u);
+        EXPECT_THROW(q.push(3, "nowhere"), std::out_of_range);
+    }
+
+    TEST_F(LaneQueueTest, testDeficitRoundRobin) {
+        lane_queue<int, 64> q{lane_schedule::deficit_round_robin};
+        q.set_weight(0, 3);
+        EXPECT_THROW(q.set_weight(1, 0), std::invalid_argument);
+        for (int i = 0; i < 300; ++i) q.push(0, i);
+        for (int i = 0; i < 300; ++i) q.push(63, 1000 + i);
+
+        std::array<int, 2> served{};
+        for (int i = 0; i < 200; ++i) ++served[*q.pop() < 1000 ? 0 : 1];
+        EXPECT_EQ(served[0], 150);                                  // 3:1 while both lanes are busy
+        EXPECT_EQ(served[1], 50);
+
+        std::vector<int> lane0, lane63;                             // FIFO within each lane
+        while (std::optional<int> v = q.pop()) (*v < 1000 ? lane0 : lane63).push_back(*v);
+        EXPECT_TRUE(std::is_sorted(lane0.begin(), lane0.end()));
+        EXPECT_TRUE(std::is_sorted(lane63.begin(), lane63.end()));
+        EXPECT_EQ(lane0.size() + lane63.size(), 400u);
+    }
+
+    TEST_F(LaneQueueTest, testNoStarvation) {
+        lane_queue<int, 4> q{lane_schedule::deficit_round_robin};
+        q.set_weight(0, 100);
+        for (int i = 0; i < 1000; ++i) q.push(0, 0);
+        q.push(3, 3);
+        int position = 0;
+        while (*q.pop() != 3) ++position;
+        EXPECT_EQ(position, 100);                                   // lane 3 waits for one turn of lane 0 only
+    }
+
+    TEST_F(LaneQueueTest, testTopLaneOnEmptyQueue) {
+        lane_queue<int, 4> q;
+        EXPECT_THROW(q.top_lane(), std::runtime_error);
+        q.push(2, 1);
+        q.push(3, 2);
+        EXPECT_EQ(q.top_lane(), 2u);
+        q.pop();
+        EXPECT_EQ(q.top_lane(), 3u);
+        q.pop();
+        EXPECT_THROW(q.top_lane(), std::runtime_error);
+
+        lane_queue<int, 4, deque<int>, unchecked_policy> u;
+        static_assert(std::is_same_v<decltype(u)::error_policy, unchecked_policy>);
+        u.push(1, 1);
+        EXPECT_EQ(u.top_lane(), 1u);
+    }
+
+    TEST_F(LaneQueueTest, testStats) {
+        lane_queue<int, 2> q;
+        for (int i = 0; i < 10; ++i) q.push(1, i);
+        for (int i = 0; i < 4; ++i) q.pop();
+        const lane_stats s = q.stats(1);
+        EXPECT_EQ(s.depth, 6u);
+        EXPECT_EQ(s.high_water, 10u);
+        EXPECT_EQ(s.pushed, 10u);
+        EXPECT_EQ(s.popped, 4u);
+        EXPECT_EQ(q.size(1), 6u);
+        EXPECT_EQ(q.stats(0).pushed, 0u);
+        EXPECT_EQ(q.memory_usage().payload_bytes, 6 * sizeof(int));
+    }
+}   /* namespace dsa */
+
+#endif /* LANE_QUEUE_TEST_H */
@@ -0,0 +1,125 @@
+/**
+ * @file    ManagedQueueTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A CoDel-managed queue and latency histogram test
+*/
+
+#ifndef MANAGED_QUEUE_TEST_H
+#define MANAGED_QUEUE_TEST_H
+
+#include <chrono>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "LatencyHistogram.h"
+#include "ManagedQueue.h"
+
+namespace dsa {
+    /** @brief a clock the test moves by hand */
+    struct manual_clock {
+        using rep = std::int64_t;
+        using period = std::nano;
+        using duration = std::chrono::nanoseconds;
+        using time_point = std::chrono::time_point<manual_clock>;
+        static constexpr bool is_steady = true;
+
+        static inline time_point current{};
+        static time_point now() noexcept { return current; }
+        static void advance(duration d) noexcept { current += d; }
+    };
+
+    class ManagedQueueTest : public testing::Test {
+        protected:
+            using ms = std::chrono::milliseconds;
+
+        public:
+            ManagedQueueTest() {}
+            virtual ~ManagedQueueTest() {}
+            virtual void SetUp() { manual_clock::current = manual_clock::time_point{}; }
+            virtual void TearDown() {}
+    };
+
+    TEST_F(ManagedQueueTest, testHistogram) {
+        latency_histogram h;
+        EXPECT_EQ(h.percentile(0.5).count(), 0);
+        for (int i = 1; i <= 1000; ++i) h.record(std::chrono::microseconds(i));
+        EXPECT_EQ(h.count(), 1000u);
+        EXPECT_EQ(h.max(), std::chrono::microseconds(1000));
+        EXPECT_EQ(h.mean(), std::chrono::nanoseconds(500500));
+        const auto p50 = h.percentile(0.5).count(), p99 = h.percentile(0.99).count();
+        EXPECT_GE(p50, 500000);
+        EXPECT_LE(p50, 500000 * 9 / 8);
+        EXPECT_GE(p99, 990000);
+        EXPECT_LE(p99, 1000000);
+        EXPECT_EQ(h.percentile(1.0), h.max());
+        h.record(std::chrono::nanoseconds(-5));
+        EXPECT_EQ(h.percentile(0.0).count(), 0);
+        h.reset();
+        EXPECT_EQ(h.count(), 0u);
+    }
+
+    TEST_F(ManagedQueueTest, testNoDropsUnderTarget) {
+        managed_queue<int, manual_clock> q;
+        for (int i = 0; i < 100; ++i) q.push(i);
+        for (int i = 0; i < 100; ++i) {
+            manual_clock::advance(std::chrono::microseconds(10));
+            EXPECT_EQ(q.pop(), i);
+        }
+        EXPECT_EQ(q.pop(), std::nullopt);
+        EXPECT_EQ(q.dropped(), 0u);
+        EXPECT_EQ(q.sojourn().count(), 100u);
+        EXPECT_EQ(q.sojourn().max(), std::chrono::microseconds(1000));
+    }
+
+    TEST_F(ManagedQueueTest, testDropsStandingQueue) {
+        std::vector<int> diverted;
+        managed_queue<int, manual_clock> q{codel_options{ms(5), ms(100)},
+                                           [&diverted](int&& x, std::chrono::nanoseconds d) {
+                                               EXPECT_GE(d, ms(5));
+                                               diverted.push_back(x);
+                                           }};
+        /* Overload: two arrivals per ms, one departure per ms, for two seconds */
+        int next = 0;
+        std::vector<int> served;
+        for (int t = 0; t < 2000; ++t) {
+            q.push(next++);
+            q.push(next++);
+            manual_clock::advance(ms(1));
+            if (std::optional<int> v = q.pop()) served.push_back(*v);
+        }
+        EXPECT_GT(q.dropped(), 0u);
+        EXPECT_EQ(q.dropped(), diverted.size());
+        EXPECT_EQ(served.size() + diverted.size() + q.size(), static_cast<std::size_t>(next));
+        EXPECT_TRUE(std::is_sorted(served.begin(), served.end()));
+        EXPECT_LT(q.size(), 200u);                                  // without dropping it would hold 2000
+        EXPECT_LE(q.head_sojourn(), ms(150));
+
+        /* Once arrivals stop, the queue drains and CoDel leaves the dropping state */
+        while (!q.empty()) {
+            manual_clock::advance(ms(1));
+            q.pop();
+        }
+        const std::uint64_t dropped = q.dropped();
+        for (int i = 0; i < 10; ++i) {
+            q.push(i);
+            manual_clock::advance(ms(1));
+            EXPECT_EQ(q.pop(), i);
+        }
+        EXPECT_FALSE(q.dropping());
+        EXPECT_EQ(q.dropped(), dropped);
+    }
+
+    TEST_F(ManagedQueueTest, testTrackingOnly) {
+        managed_queue<int, manual_clock> q{codel_options{std::chrono::nanoseconds::max(), ms(100)}};
+        for (int i = 0; i < 1000; ++i) q.push(i);
+        EXPECT_EQ(q.memory_usage().payload_bytes, 1000 * sizeof(int));
+        manual_clock::advance(std::chrono::seconds(10));
+        for (int i = 0; i < 1000; ++i) EXPECT_EQ(q.pop(), i);
+        EXPECT_EQ(q.dropped(), 0u);
+        EXPECT_EQ(q.sojourn().percentile(0.5), std::chrono::seconds(10));
+    }
+}   /* namespace dsa */
+
+#endif /* MANAGED_QUEUE_TEST_H */
@@ -0,0 +1,144 @@
+/**
+ * @file    MmapQueueTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A durable memory-mapped queue test
+*/
+
+#ifndef MMAP_QUEUE_TEST_H
+#define MMAP_QUEUE_TEST_H
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unistd.h>
+#include <gtest/gtest.h>
+
+#include "Checksum.h"
+#include "MmapQueue.h"
+
+namespace dsa {
+    class MmapQueueTest : public testing::Test {
+        protected:
+            std::filesystem::path dir;
+            mmap_queue_options options{4096, sync_policy::none};    // one page per segment, so the tests roll over
+
+            static std::string text(std::span<const std::byte> record) {
+                return std::string{reinterpret_cast<const char*>(record.data()), record.size()};
+            }
+
+        public:
+            MmapQueueTest() {}
+            virtual ~MmapQueueTest() {}
+            virtual void SetUp() {
+                dir = std::filesystem::temp_directory_path() /
+                      ("dsa-mmap-queue-" + std::to_string(::getpid()) + "-" +
+                       testing::UnitTest::GetInstance()->current_test_info()->name());
+                std::filesystem::remove_all(dir);
+            }
+            virtual void TearDown() { std::filesystem::remove_all(dir); }
+    };
+
+    TEST_F(MmapQueueTest, testCrc32) {
+        EXPECT_EQ(crc32("123456789", 9), 0xCBF43926u);
+        EXPECT_EQ(crc32("6789", 4, crc32("12345", 5)), 0xCBF43926u);
+    }
+
+    TEST_F(MmapQueueTest, testPushPopRollover) {
+        mmap_queue q{dir, options};
+        EXPECT_TRUE(q.empty());
+        EXPECT_THROW(q.pop(), std::runtime_error);
+        for (int i = 0; i < 1000; ++i) q.push("record " + std::to_string(i));
+        q.push(std::string_view{});
+        EXPECT_EQ(q.size(), 1001);
+        EXPECT_GT(q.segments(), 5);
+
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT_EQ(text(q.front()), "record " + std::to_string(i));
+            q.pop();
+        }
+        EXPECT_TRUE(q.front().empty());
+        q.pop();
+        EXPECT_TRUE(q.empty());
+        EXPECT_EQ(q.segments(), 1);                             /* consumed segments are deleted */
+        EXPECT_THROW(q.push(std::string(5000, 'x')), std::length_error);
+    }
+
+    TEST_F(MmapQueueTest, testRecovery) {
+        {
+            mmap_queue q{dir, {4096, sync_policy::batch}};
+            std::vector<std::string> batch;
+            for (int i = 0; i < 300; ++i) batch.push_back(std::to_string(i));
+            q.push_batch(batch);
+            for (int i = 0; i < 120; ++i) q.pop();
+        }
+        mmap_queue q{dir, options};
+        ASSERT_EQ(q.size(), 180);
+        for (int i = 120; i < 300; ++i) {
+            ASSERT_EQ(text(q.front()), std::to_string(i));
+            q.pop();
+        }
+        q.push("after restart");
+        EXPECT_EQ(text(q.front()), "after restart");
+    }
+
+    TEST_F(MmapQueueTest, testStaleHeadAfterSegmentDelete) {
+        std::string old_head(64, '\0');
+        int popped = 0;
+        {
+            mmap_queue q{dir, {4096, sync_policy::batch}};
+            std::vector<std::string> batch;
+            for (int i = 0; i < 600; ++i) batch.push_back(std::to_string(i));
+            q.push_batch(batch);
+            std::ifstream{dir / "head", std::ios::binary}.read(old_head.data(), old_head.size());
+
+            const std::size_t segments = q.segments();
+            while (q.segments() == segments) {
+                q.pop();
+                ++popped;
+            }
+        }
+
+        /* The segment delete reached the disk but the head update did not */
+        std::ofstream{dir / "head", std::ios::binary | std::ios::trunc}.write(old_head.data(), old_head.size());
+        mmap_queue q{dir, options};
+        ASSERT_EQ(q.size(), 600 - popped);
+        EXPECT_EQ(text(q.front()), std::to_string(popped));
+    }
+
+    TEST_F(MmapQueueTest, testTornRecord) {
+        std::filesystem::path segment;
+        {
+            mmap_queue q{dir, options};
+            q.push("first");
+            q.push("second");
+            q.push("third");
+        }
+        for (const auto& entry : std::filesystem::directory_iterator(dir))
+            if (entry.path().filename().string().starts_with("segment-")) segment = entry.path();
+
+        /* Flip a payload byte of "second": it and everything after it are dropped */
+        std::fstream f{segment, std::ios::in | std::ios::out | std::ios::binary};
+        f.seekp(16 + 16 + 8);
+        f.put('S');
+        f.close();
+
+        {
+            mmap_queue q{dir, options};
+            ASSERT_EQ(q.size(), 1);
+            EXPECT_EQ(text(q.front()), "first");
+            q.push("fourth");
+            q.push("fifth");
+        }
+        mmap_queue q{dir, options};
+        ASSERT_EQ(q.size(), 3);                                 /* "third" did not come back */
+        q.pop();
+        EXPECT_EQ(text(q.front()), "fourth");
+    }
+}   /* namespace dsa */
+
+#endif /* MMAP_QUEUE_TEST_H */
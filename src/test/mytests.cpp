@@ -2,6 +2,27 @@
 #include "DoublyLinkedListTest.h"
 #include "StackTest.h"
 #include "QueueTest.h"
+#include "SkipListTest.h"
+#include "FlatHashMapTest.h"
+#include "DequeTest.h"
+#include "TimerWheelTest.h"
+#include "MemoryUsageTest.h"
+#include "TypeTraitsTest.h"
+#include "ErrorPolicyTest.h"
+#include "SmallVectorTest.h"
+#include "TrailStackTest.h"
+#include "PersistentListTest.h"
+#include "AsyncQueueTest.h"
+#include "MmapQueueTest.h"
+#include "OffsetListTest.h"
+#include "SnapshotTest.h"
+#include "PipelineTest.h"
+#include "ManagedQueueTest.h"
+#include "LaneQueueTest.h"
+#include "UniqueQueueTest.h"
+#include "RingBufferTest.h"
+#include "AdaptiveContainerTest.h"
+#include "AlgorithmTest.h"
 
 int main(int argc, char* argv[])
 {
@@ -0,0 +1,201 @@
+/**
+ * @file    OffsetListTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   An offset-pointer list, segment arena and mapped region test
+*/
+
+#ifndef OFFSET_LIST_TEST_H
+#define OFFSET_LIST_TEST_H
+
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <gtest/gtest.h>
+
+#include "MappedRegion.h"
+#include "OffsetList.h"
+#include "OffsetPtr.h"
+#include "SegmentArena.h"
+
+namespace dsa {
+    class OffsetListTest : public testing::Test {
+        protected:
+            struct alignas(16) chunk { std::byte bytes[16]; };
+
+            struct pair_of_links {
+                int value;
+                offset_ptr<int> self;
+            };
+
+        public:
+            OffsetListTest() {}
+            virtual ~OffsetListTest() {}
+            virtual void SetUp() {}
+            virtual void TearDown() {}
+    };
+
+    TEST_F(OffsetListTest, testOffsetPtr) {
+        offset_ptr<int> p;
+        EXPECT_FALSE(p);
+        EXPECT_EQ(p.get(), nullptr);
+
+        pair_of_links a{7, nullptr};
+        a.self = &a.value;
+        EXPECT_EQ(*a.self, 7);
+
+        pair_of_links b;
+        std::memcpy(static_cast<void*>(&b), &a, sizeof(a));             // a raw copy still points at its own value
+        EXPECT_EQ(b.self.get(), &b.value);
+        offset_ptr<int> c = a.self;                                     // a copy points at the same target
+        EXPECT_EQ(c.get(), &a.value);
+        c = nullptr;
+        EXPECT_FALSE(c);
+    }
+
+    TEST_F(OffsetListTest, testArena) {
+        std::vector<chunk> buffer(1024);
+        segment_arena arena = segment_arena::create(buffer.data(), buffer.size() * sizeof(chunk));
+        EXPECT_THROW(segment_arena::attach(buffer.data(), 4096), std::runtime_error);
+        const std::size_t start = arena.used();
+
+        void* a = arena.allocate(24);
+        void* b = arena.allocate(24);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(a) % segment_arena::alignment, 0u);
+        EXPECT_EQ(static_cast<std::byte*>(b) - static_cast<std::byte*>(a), 32);
+        EXPECT_EQ(arena.live(), 64u);
+        arena.deallocate(a, 24);
+        EXPECT_EQ(arena.allocate(20), a);                               // same size class, reused
+        EXPECT_EQ(arena.used(), start + 64);
+        EXPECT_THROW(arena.allocate(1 << 20), std::bad_alloc);
+
+        int* root = arena.construct<int>(42);
+        arena.set_root(root);
+        EXPECT_EQ(segment_arena::attach(buffer.data(), buffer.size() * sizeof(chunk)).root<int>(), root);
+        EXPECT_TRUE(arena.try_lock());
+        EXPECT_FALSE(arena.try_lock());
+        arena.unlock();
+    }
+
+    TEST_F(OffsetListTest, testListOperations) {
+        std::vector<chunk> buffer(4096);
+        segment_arena arena = segment_arena::create(buffer.data(), buffer.size() * sizeof(chunk));
+        EXPECT_THROW(offset_list<int>{arena}, std::invalid_argument);
+
+        offset_list<int>& l = *arena.construct<offset_list<int>>(arena);
+        EXPECT_TRUE(l.empty());
+        EXPECT_THROW(l.front(), std::runtime_error);
+        EXPECT_EQ(l.try_pop_front(), std::nullopt);
+        for (int i = 0; i < 10; ++i) l.push_back(i);
+        l.push_front(-1);
+        l.emplace_back(10);
+        EXPECT_EQ(l.size(), 12u);
+        EXPECT_EQ(l.front(), -1);
+        EXPECT_EQ(l.back(), 10);
+
+        auto it = l.begin();
+        for (int i = 0; i < 3; ++i) ++it;
+        EXPECT_EQ(*l.erase(it), 3);                                     // erases 2
+        l.pop_back();
+        l.pop_front();
+        EXPECT_EQ(l.try_pop_front(), 0);
+        std::vector<int> values(l.begin(), l.end());
+        EXPECT_EQ(values, (std::vector<int>{1, 3, 4, 5, 6, 7, 8, 9}));
+
+        const std::size_t live = arena.live();
+        l.push_back(11);
+        l.pop_back();
+        EXPECT_EQ(arena.live(), live);
+        EXPECT_EQ(l.memory_usage().payload_bytes, 8 * sizeof(int));
+        EXPECT_EQ(l.memory_usage().allocations, 0u);
+        arena.destroy(&l);
+        EXPECT_EQ(arena.live(), 0u);
+    }
+
+    TEST_F(OffsetListTest, testRelocation) {
+        std::vector<chunk> original(8192);
+        const std::size_t bytes = original.size() * sizeof(chunk);
+        {
+            segment_arena arena = segment_arena::create(original.data(), bytes);
+            offset_list<long>* l = arena.construct<offset_list<long>>(arena);
+            arena.set_root(l);
+            for (long i = 0; i < 1000; ++i) l->push_back(i * i);
+        }
+
+        std::vector<chunk> copy(original);                              // same bytes, another address
+        segment_arena arena = segment_arena::attach(copy.data(), bytes);
+        offset_list<long>& l = *arena.root<offset_list<long>>();
+        ASSERT_EQ(l.size(), 1000u);
+        long i = 0;
+        for (long v : l) {
+            EXPECT_EQ(v, i * i);
+            ++i;
+        }
+        for (auto it = l.end(); it != l.begin();) {
+            --i;
+            EXPECT_EQ(*--it, i * i);
+        }
+        l.push_front(-1);
+
+        offset_list<long>& first = *segment_arena::attach(original.data(), bytes).root<offset_list<long>>();
+        EXPECT_EQ(first.size(), 1000u);
+        EXPECT_EQ(first.front(), 0);
+    }
+
+    TEST_F(OffsetListTest, testMappedFile) {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() /
+                                           ("dsa-offset-list-" + std::to_string(::getpid()));
+        const std::size_t bytes = 1 << 16;
+        {
+            mapped_region region = mapped_region::open_file(path, bytes);
+            segment_arena arena = segment_arena::create(region.data(), region.size());
+            offset_list<int>* l = arena.construct<offset_list<int>>(arena);
+            arena.set_root(l);
+            for (int i = 0; i < 100; ++i) l->push_back(i);
+            region.flush();
+        }
+        {
+            mapped_region region = mapped_region::open_file(path, bytes);
+            offset_list<int>& l = *segment_arena::attach(region.data(), region.size()).root<offset_list<int>>();
+            EXPECT_EQ(l.size(), 100u);
+            EXPECT_EQ(l.back(), 99);
+            l.pop_front();
+        }
+        mapped_region region = mapped_region::open_file(path, bytes);
+        EXPECT_EQ(segment_arena::attach(region.data(), region.size()).root<offset_list<int>>()->front(), 1);
+        std::filesystem::remove(path);
+    }
+
+    TEST_F(OffsetListTest, testSharedBetweenProcesses) {
+        mapped_region region = mapped_region::anonymous_shared(1 << 16);
+        segment_arena arena = segment_arena::create(region.data(), region.size());
+        offset_list<int>* l = arena.construct<offset_list<int>>(arena);
+
+        const pid_t child = ::fork();
+        ASSERT_GE(child, 0);
+        if (child == 0) {                                               // producer
+            for (int i = 0; i < 500; ++i) {
+                std::lock_guard<segment_arena> lock{arena};
+                l->push_back(i);
+            }
+            ::_exit(0);
+        }
+        int expected = 0;                                               // consumer
+        while (expected < 500) {
+            std::lock_guard<segment_arena> lock{arena};
+            while (std::optional<int> v = l->try_pop_front()) EXPECT_EQ(*v, expected++);
+        }
+        int status = 0;
+        ::waitpid(child, &status, 0);
+        EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+        EXPECT_TRUE(l->empty());
+    }
+}   /* namespace dsa */
+
+#endif /* OFFSET_LIST_TEST_H */
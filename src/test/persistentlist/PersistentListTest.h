@@ -0,0 +1,98 @@
+/**
+ * @file    PersistentListTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A persistent list and stack test
+*/
+
+#ifndef PERSISTENT_LIST_TEST_H
+#define PERSISTENT_LIST_TEST_H
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "PersistentList.h"
+
+namespace dsa {
+    class PersistentListTest : public testing::Test {
+        protected:
+            persistent_list<int> my_list{1, 2, 3};
+
+        public:
+            PersistentListTest() {}
+            virtual ~PersistentListTest() {}
+            virtual void SetUp() {}
+            virtual void TearDown() {}
+    };
+
+    TEST_F(PersistentListTest, testVersionsShareTails) {
+        EXPECT_EQ(my_list.size(), 3);
+        EXPECT_EQ(my_list.front(), 1);
+
+        persistent_list<int> a = my_list.push_front(0);
+        persistent_list<int> b = my_list.pop_front().push_front(9);
+        EXPECT_EQ(std::vector<int>(a.begin(), a.end()), (std::vector<int>{0, 1, 2, 3}));
+        EXPECT_EQ(std::vector<int>(b.begin(), b.end()), (std::vector<int>{9, 2, 3}));
+        EXPECT_EQ(my_list.size(), 3);                           /* the old version is unchanged */
+        EXPECT_TRUE(a.pop_front().same_version(my_list));
+        EXPECT_EQ(b.pop_front(), my_list.pop_front());
+
+        persistent_list<int> snapshot = a;
+        a = a.pop_front().pop_front();
+        EXPECT_EQ(snapshot.size(), 4);
+        EXPECT_EQ(a, (persistent_list<int>{2, 3}));
+        EXPECT_NE(a, snapshot);
+
+        persistent_list<int> empty;
+        EXPECT_THROW(empty.front(), std::runtime_error);
+        EXPECT_THROW((void)empty.pop_front(), std::runtime_error);
+        EXPECT_EQ(empty.memory_usage().allocations, 0);
+        EXPECT_EQ(snapshot.memory_usage().allocations, 4);
+    }
+
+    TEST_F(PersistentListTest, testLongListRelease) {
+        persistent_list<int> list;
+        for (int i = 0; i < 1000000; ++i) list = list.push_front(i);
+        persistent_list<int> half = list;
+        for (int i = 0; i < 500000; ++i) half = half.pop_front();
+        list = persistent_list<int>{};                          /* frees 500000 nodes without recursion */
+        EXPECT_EQ(half.size(), 500000);
+        EXPECT_EQ(half.front(), 499999);
+    }
+
+    TEST_F(PersistentListTest, testStackSnapshotsAcrossThreads) {
+        persistent_stack<std::shared_ptr<std::string>> work;
+        std::vector<persistent_stack<std::shared_ptr<std::string>>> snapshots;
+        for (int i = 0; i < 100; ++i) {
+            work = work.push(std::make_shared<std::string>(std::to_string(i)));
+            snapshots.push_back(work);                          /* O(1) each */
+        }
+        EXPECT_EQ(*work.top(), "99");
+        EXPECT_EQ(*work.pop().top(), "98");
+
+        std::vector<std::size_t> counted(snapshots.size());
+        std::vector<std::thread> readers;
+        for (std::size_t t = 0; t < 4; ++t) {
+            readers.emplace_back([&, t] {
+                for (std::size_t i = t; i < snapshots.size(); i += 4) {
+                    persistent_stack<std::shared_ptr<std::string>> s = std::move(snapshots[i]);
+                    std::size_t n = 0;
+                    for (; !s.empty(); s = s.pop()) ++n;
+                    counted[i] = n;
+                }
+            });
+        }
+        work = work.pop().pop();
+        for (std::thread& r : readers) r.join();
+        for (std::size_t i = 0; i < counted.size(); ++i) EXPECT_EQ(counted[i], i + 1);
+        EXPECT_EQ(work.size(), 98);
+        EXPECT_EQ(work.top().use_count(), 1);                   /* the snapshots are gone */
+    }
+}   /* namespace dsa */
+
+#endif /* PERSISTENT_LIST_TEST_H */
@@ -0,0 +1,167 @@
+/**
+ * @file    PipelineTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A bounded queue and stage pipeline test
+*/
+
+#ifndef PIPELINE_TEST_H
+#define PIPELINE_TEST_H
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "BoundedQueue.h"
+#include "Pipeline.h"
+
+namespace dsa {
+    class PipelineTest : public testing::Test {
+        public:
+            PipelineTest() {}
+            virtual ~PipelineTest() {}
+            virtual void SetUp() {}
+            virtual void TearDown() {}
+    };
+
+    TEST_F(PipelineTest, testBoundedQueue) {
+        EXPECT_THROW(bounded_queue<int>{0}, std::invalid_argument);
+        bounded_queue<int> q{4};
+        for (int i = 0; i < 4; ++i) EXPECT_TRUE(q.push(i));
+        EXPECT_FALSE(q.try_push(4));
+        EXPECT_EQ(q.high_water(), 4u);
+
+        std::thread producer{[&q] {
+            std::vector<int> batch{4, 5, 6, 7, 8, 9};
+            EXPECT_TRUE(q.push_batch(batch));                       // waits for the consumer
+        }};
+        while (q.stalls() == 0) std::this_thread::yield();          // the producer found the queue full
+        std::vector<int> got, batch;
+        while (got.size() < 10 && q.pop_batch(batch, 3)) {
+            EXPECT_LE(batch.size(), 3u);
+            got.insert(got.end(), batch.begin(), batch.end());
+        }
+        producer.join();
+        EXPECT_EQ(got, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+        EXPECT_EQ(q.capacity(), 4u);
+
+        q.push(10);
+        q.close();
+        EXPECT_FALSE(q.push(11));
+        EXPECT_EQ(q.pop(), 10);
+        EXPECT_EQ(q.pop(), std::nullopt);
+        EXPECT_FALSE(q.pop_batch(batch, 8));
+    }
+
+    TEST_F(PipelineTest, testOrderedParallelStages) {
+        auto p = pipeline<int>{64}
+                     .then("square", [](int x) { return static_cast<long>(x) * x; }, {.parallelism = 4, .capacity = 16, .batch = 8})
+                     .then("format", [](long x) { return std::to_string(x); }, {.parallelism = 3, .capacity = 16});
+        EXPECT_EQ(p.stages(), 2u);
+        std::thread feeder{[&p] {
+            for (int i = 0; i < 5000; ++i) p.push(i);
+            p.close();
+        }};
+        int expected = 0;
+        while (std::optional<std::string> s = p.pop()) {
+            EXPECT_EQ(*s, std::to_string(static_cast<long>(expected) * expected));
+            ++expected;
+        }
+        feeder.join();
+        p.wait();
+        EXPECT_EQ(expected, 5000);
+        EXPECT_FALSE(p.push(1));
+
+        const std::vector<stage_stats> stats = p.stats();
+        ASSERT_EQ(stats.size(), 2u);
+        EXPECT_EQ(stats[0].name, "square");
+        EXPECT_EQ(stats[0].processed, 5000u);
+        EXPECT_EQ(stats[1].processed, 5000u);
+        EXPECT_EQ(stats[1].queue_capacity, 16u);
+        EXPECT_LE(stats[1].queue_high_water, 16u);
+    }
+
+    TEST_F(PipelineTest, testUnorderedSinkAndBottleneck) {
+        std::atomic<long> sum{0};
+        auto p = pipeline<int>{8}
+                     .then("fast", [](int x) { return x + 1; }, {.parallelism = 2, .capacity = 4, .ordered = false})
+                     .then("slow", [](int x) {
+                         std::this_thread::sleep_for(std::chrono::microseconds(200));
+                         return x;
+                     }, {.parallelism = 1, .capacity = 4})
+                     .then("sink", [&sum](int x) { sum += x; });
+        for (int i = 0; i < 300; ++i) EXPECT_TRUE(p.push(i));       // held back by the slow stage
+        p.close();
+        p.wait();
+        EXPECT_EQ(sum.load(), 300L * 301 / 2);
+
+        const std::vector<stage_stats> stats = p.stats();
+        EXPECT_EQ(p.bottleneck(), 1u);
+        EXPECT_GT(stats[1].upstream_stalls + stats[0].upstream_stalls, 0u);
+        EXPECT_GT(stats[1].utilization, stats[0].utilization);
+    }
+
+    TEST_F(PipelineTest, testReorderWindow) {
+        std::atomic<bool> release{false};
+        std::atomic<int> pushed{0};
+        auto p = pipeline<int>{4}.then("stall", [&release](int x) {
+            if (x == 0) while (!release.load()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            return x;
+        }, {.parallelism = 2, .capacity = 4});
+        std::thread producer{[&p, &pushed] {
+            for (int i = 0; i < 2000 && p.push(i); ++i) ++pushed;
+            p.close();
+        }};
+
+        /* The head-of-line item is in flight and nobody pops: the window, then the queues fill */
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        EXPECT_LT(pushed.load(), 32);
+        release = true;
+        int expected = 0;
+        while (std::optional<int> x = p.pop()) ASSERT_EQ(*x, expected++);
+        producer.join();
+        p.wait();
+        EXPECT_EQ(expected, 2000);
+    }
+
+    TEST_F(PipelineTest, testCloseWhileProducersPush) {
+        auto p = pipeline<int>{2}.then("id", [](int x) { return x; }, {.parallelism = 3, .capacity = 2});
+        std::atomic<int> accepted{0};
+        std::vector<std::thread> producers;
+        for (int t = 0; t < 4; ++t) {
+            producers.emplace_back([&p, &accepted] {
+                while (p.push(1)) ++accepted;
+            });
+        }
+        int delivered = 0;
+        while (delivered < 1000 && p.pop()) ++delivered;
+        p.close();
+        for (std::thread& t : producers) t.join();
+
+        /* Every accepted item comes out, none is stuck behind the number of a failed push */
+        while (p.pop()) ++delivered;
+        p.wait();
+        EXPECT_EQ(delivered, accepted.load());
+    }
+
+    TEST_F(PipelineTest, testStageFailure) {
+        auto p = pipeline<int>{}
+                     .then("check", [](int x) {
+                         if (x == 7) throw std::domain_error("seven");
+                         return x;
+                     })
+                     .then("drop", [](int) {});
+        for (int i = 0; i < 20; ++i) p.push(i);
+        p.close();
+        EXPECT_THROW(p.wait(), std::domain_error);
+        EXPECT_FALSE(p.push(1));
+        EXPECT_THROW(pipeline<int>{}.then("bad", [](int x) { return x; }, {.parallelism = 0}), std::invalid_argument);
+    }
+}   /* namespace dsa */
+
+#endif /* PIPELINE_TEST_H */
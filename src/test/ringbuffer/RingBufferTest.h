@@ -0,0 +1,138 @@
+/**
+ * @file    RingBufferTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A lossy fixed-capacity ring buffer test
+*/
+
+#ifndef RING_BUFFER_TEST_H
+#define RING_BUFFER_TEST_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ConcurrentRingBuffer.h"
+#include "RingBuffer.h"
+#include "queue.h"
+
+namespace dsa {
+    class RingBufferTest : public testing::Test {
+        public:
+            RingBufferTest() {}
+            virtual ~RingBufferTest() {}
+            virtual void SetUp() {}
+            virtual void TearDown() {}
+    };
+
+    /* a trace event whose fields check each other, so a torn copy is detected */
+    struct trace_event {
+        std::uint64_t seq;
+        std::uint32_t writer;
+        std::uint32_t pad;
+        std::uint64_t check;
+    };
+
+    TEST_F(RingBufferTest, testOverwriteOldest) {
+        ring_buffer<std::string, 4> r;
+        EXPECT_EQ(r.try_pop_front(), std::nullopt);
+        for (int i = 0; i < 4; ++i) EXPECT_TRUE(r.push_back(std::to_string(i)));
+        EXPECT_TRUE(r.full());
+        EXPECT_FALSE(r.push_back("4"));
+        EXPECT_FALSE(r.emplace_back(2, '5'));
+        EXPECT_EQ(r.dropped(), 2u);
+        EXPECT_EQ(r.size(), 4u);
+        EXPECT_EQ(r.front(), "2");
+        EXPECT_EQ(r.back(), "55");
+        EXPECT_EQ(r.snapshot(), (std::vector<std::string>{"2", "3", "4", "55"}));
+
+        auto segments = r.segments();
+        EXPECT_EQ(segments[0].size(), 2u);                          // slots 2 and 3, then 0 and 1
+        EXPECT_EQ(segments[1].size(), 2u);
+        EXPECT_EQ(segments[1][1], "55");
+
+        ring_buffer<std::string, 4> copy{r};
+        EXPECT_EQ(r.try_pop_front(), "2");
+        r.pop_front();
+        EXPECT_EQ(std::vector<std::string>(r.begin(), r.end()), (std::vector<std::string>{"4", "55"}));
+        EXPECT_EQ(copy.size(), 4u);
+        EXPECT_EQ(copy.dropped(), 2u);
+        r = std::move(copy);
+        EXPECT_EQ(r[3], "55");
+        r.clear();
+        EXPECT_TRUE(r.empty());
+        EXPECT_EQ(r.segments()[0].size(), 0u);
+    }
+
+    TEST_F(RingBufferTest, testDropNewestBehindQueue) {
+        queue<int, ring_buffer<int, 3, ring_overflow::drop_newest>> q;
+        for (int i = 0; i < 5; ++i) q.push(i);
+        EXPECT_EQ(q.size(), 3u);
+        EXPECT_EQ(q.front(), 0);
+        EXPECT_EQ(q.back(), 2);
+        q.pop();
+        q.push(7);
+        EXPECT_EQ(q.try_pop(), 1);
+        EXPECT_EQ(q.try_pop(), 2);
+        EXPECT_EQ(q.try_pop(), 7);
+        EXPECT_EQ(q.try_pop(), std::nullopt);
+
+        memory_footprint m = q.memory_usage();
+        EXPECT_EQ(m.payload_bytes, 0u);
+        EXPECT_EQ(m.allocations, 0u);
+        EXPECT_GE(m.overhead_bytes, 3 * sizeof(int));
+    }
+
+    TEST_F(RingBufferTest, testConcurrentWriters) {
+        constexpr int writers = 4;
+        constexpr std::uint64_t per_writer = 50000;
+        concurrent_ring_buffer<trace_event, 256> ring;
+        std::atomic<bool> done{false};
+        std::atomic<std::size_t> torn{0}, unordered{0};
+
+        std::thread reader{[&] {
+            while (!done.load()) {
+                std::vector<trace_event> events = ring.snapshot();
+                std::uint64_t latest[writers] = {};
+                bool seen[writers] = {};
+                for (const trace_event& e : events) {
+                    if (e.check != ~(e.seq * 31 + e.writer)) {
+                        ++torn;
+                        continue;
+                    }
+                    if (seen[e.writer] && latest[e.writer] >= e.seq) ++unordered;
+                    seen[e.writer] = true;
+                    latest[e.writer] = e.seq;
+                }
+            }
+        }};
+        std::vector<std::thread> threads;
+        for (int w = 0; w < writers; ++w) {
+            threads.emplace_back([&ring, w] {
+                for (std::uint64_t i = 0; i < per_writer; ++i) {
+                    ring.push(trace_event{i, static_cast<std::uint32_t>(w), 0, ~(i * 31 + w)});
+                }
+            });
+        }
+        for (std::thread& t : threads) t.join();
+        done = true;
+        reader.join();
+
+        EXPECT_EQ(torn.load(), 0u);
+        EXPECT_EQ(unordered.load(), 0u);
+        EXPECT_EQ(ring.pushed(), writers * per_writer);
+        EXPECT_EQ(ring.overwritten(), writers * per_writer - 256);
+
+        std::vector<trace_event> last = ring.snapshot();                // every slot settled, only lost writes leave gaps
+        EXPECT_LE(last.size(), 256u);
+        EXPECT_GE(last.size() + ring.lost(), 256u);
+        EXPECT_EQ(ring.dropped(), ring.overwritten() + ring.lost());
+    }
+}   /* namespace dsa */
+
+#endif /* RING_BUFFER_TEST_H */
@@ -0,0 +1,125 @@
+/**
+ * @file    SkipListTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A concurrent skip list test
+*/
+
+#ifndef SKIP_LIST_TEST_H
+#define SKIP_LIST_TEST_H
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "SkipList.h"
+
+namespace dsa {
+    class SkipListTest : public testing::Test {
+        protected:
+            skip_list<int, std::string> my_list;
+
+        public:
+            SkipListTest() {}
+            virtual ~SkipListTest() {}
+            virtual void SetUp() {}
+            virtual void TearDown() {}
+    };
+
+    TEST_F(SkipListTest, testEmptySkipList) {
+        EXPECT_TRUE(my_list.empty());
+        EXPECT_EQ(my_list.size(), 0);
+        EXPECT_EQ(my_list.begin(), my_list.end());
+        EXPECT_FALSE(my_list.contains(1));
+    }
+
+    TEST_F(SkipListTest, testInsertFind) {
+        EXPECT_TRUE(my_list.insert(2, "two"));
+        EXPECT_TRUE(my_list.insert(1, "one"));
+        EXPECT_FALSE(my_list.insert(2, "deux"));
+        EXPECT_EQ(my_list.size(), 2);
+        EXPECT_EQ(my_list.find(2).value(), "two");
+        EXPECT_FALSE(my_list.find(3).has_value());
+    }
+
+    TEST_F(SkipListTest, testEraseReinsert) {
+        my_list.insert(1, "one");
+        EXPECT_TRUE(my_list.erase(1));
+        EXPECT_FALSE(my_list.erase(1));
+        EXPECT_FALSE(my_list.contains(1));
+        EXPECT_TRUE(my_list.insert(1, "uno"));
+        EXPECT_EQ(my_list.find(1).value(), "uno");
+        EXPECT_EQ(my_list.reclaim_retired(), 1);
+    }
+
+    TEST_F(SkipListTest, testOrderedIterationAndRange) {
+        for (int i : {5, 3, 9, 1, 7})
+            my_list.insert(i, std::to_string(i));
+
+        std::vector<int> keys;
+        for (const auto& kv : my_list) keys.push_back(kv.first);
+        EXPECT_EQ(keys, (std::vector<int>{1, 3, 5, 7, 9}));
+
+        keys.clear();
+        EXPECT_EQ(my_list.for_each_range(3, 9, [&](const auto& kv) { keys.push_back(kv.first); }), 3);
+        EXPECT_EQ(keys, (std::vector<int>{3, 5, 7}));
+        EXPECT_EQ(my_list.lower_bound(4)->first, 5);
+    }
+
+    TEST(SkipListConcurrentTest, testConcurrentInsertErase) {
+        skip_list<int, int> list;
+        constexpr int threads = 4;
+        constexpr int per_thread = 2000;
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t)
+            workers.emplace_back([&, t] {
+                for (int i = t; i < threads * per_thread; i += threads) list.insert(i, i * 2);
+                for (int i = t; i < threads * per_thread; i += 2 * threads) list.erase(i);
+            });
+        for (auto& w : workers) w.join();
+
+        EXPECT_EQ(list.size(), threads * per_thread / 2);
+        int prev = -1;
+        std::size_t n = 0;
+        for (const auto& kv : list) {
+            EXPECT_LT(prev, kv.first);
+            EXPECT_EQ(kv.second, kv.first * 2);
+            prev = kv.first;
+            ++n;
+        }
+        EXPECT_EQ(n, list.size());
+    }
+
+    TEST(SkipListConcurrentTest, testChurnReclaimsErasedNodes) {
+        skip_list<int, int> list;
+        constexpr int threads = 4;
+        constexpr int rounds = 20000;
+        std::atomic<int> erased{0};
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; ++t)
+            workers.emplace_back([&, t] {
+                for (int i = 0; i < rounds; ++i) {
+                    const int key = (i * 7 + t) % 256;
+                    if (i % 3 != 2) list.insert(key, i);
+                    else if (list.erase(key)) ++erased;
+                    if (i % 100 == 0) {
+                        for (const auto& kv : list) EXPECT_GE(kv.first, 0);   /* iterators pin the epoch */
+                    }
+                }
+            });
+        for (auto& w : workers) w.join();
+
+        /* Tens of thousands of nodes were erased; only the last epochs' worth may remain */
+        EXPECT_GT(erased.load(), 10000);
+        EXPECT_LT(list.memory_usage().allocations, list.size() + 2000);
+        list.reclaim_retired();
+        EXPECT_EQ(list.memory_usage().allocations, list.size());
+    }
+}   /* namespace dsa */
+
+#endif /* SKIP_LIST_TEST_H */
@@ -0,0 +1,94 @@
+/**
+ * @file    SmallVectorTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A small-buffer vector and small_stack test
+*/
+
+#ifndef SMALL_VECTOR_TEST_H
+#define SMALL_VECTOR_TEST_H
+
+#include <memory>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "SmallVector.h"
+#include "Stack.h"
+
+namespace dsa {
+    class SmallVectorTest : public testing::Test {
+        protected:
+            small_vector<int, 8> my_vector;
+
+        public:
+            SmallVectorTest() {}
+            virtual ~SmallVectorTest() {}
+            virtual void SetUp() {}
+            virtual void TearDown() {}
+    };
+
+    TEST_F(SmallVectorTest, testInlineUntilFull) {
+        EXPECT_TRUE(my_vector.empty());
+        EXPECT_EQ(my_vector.capacity(), 8);
+        for (int i = 0; i < 8; ++i) my_vector.push_back(i);
+        EXPECT_TRUE(my_vector.is_inline());
+        EXPECT_EQ(my_vector.memory_usage().allocations, 0);
+
+        my_vector.push_back(my_vector.front());         /* the argument lives in the old storage */
+        EXPECT_FALSE(my_vector.is_inline());
+        EXPECT_EQ(my_vector.capacity(), 16);
+        EXPECT_EQ(my_vector.back(), 0);
+        for (int i = 0; i < 8; ++i) EXPECT_EQ(my_vector[i], i);
+        EXPECT_EQ(my_vector.memory_usage().allocations, 1);
+        EXPECT_THROW(my_vector.at(9), std::out_of_range);
+
+        while (my_vector.size() > 3) my_vector.pop_back();
+        my_vector.shrink_to_fit();
+        EXPECT_TRUE(my_vector.is_inline());
+        EXPECT_EQ(my_vector.size(), 3);
+        EXPECT_EQ(my_vector.back(), 2);
+    }
+
+    TEST_F(SmallVectorTest, testCopyMove) {
+        small_vector<std::string, 2> strings{"a", "b"};
+        small_vector<std::string, 2> spilled{"c", "d", "e"};
+        EXPECT_TRUE(strings.is_inline());
+        EXPECT_FALSE(spilled.is_inline());
+
+        small_vector<std::string, 2> copy{spilled};
+        EXPECT_EQ(copy.size(), 3);
+        EXPECT_EQ(copy[2], "e");
+
+        const std::string* heap = spilled.data();
+        small_vector<std::string, 2> moved{std::move(spilled)};
+        EXPECT_EQ(moved.data(), heap);                  /* the heap buffer changes hands */
+        EXPECT_TRUE(spilled.empty());
+        EXPECT_TRUE(spilled.is_inline());
+
+        moved = std::move(strings);
+        EXPECT_TRUE(moved.is_inline());
+        EXPECT_EQ(moved.back(), "b");
+        copy = moved;
+        EXPECT_EQ(copy.size(), 2);
+        EXPECT_EQ(copy.try_pop_back(), "b");
+        EXPECT_EQ(copy.try_pop_back(), "a");
+        EXPECT_FALSE(copy.try_pop_back().has_value());
+    }
+
+    TEST_F(SmallVectorTest, testSmallStack) {
+        small_stack<std::unique_ptr<int>, 4> s;
+        for (int i = 0; i < 4; ++i) s.push(std::make_unique<int>(i));
+        EXPECT_EQ(s.memory_usage().allocations, 0);
+        s.push(std::make_unique<int>(4));
+        EXPECT_EQ(s.memory_usage().allocations, 1);
+        for (int i = 4; i >= 0; --i) {
+            EXPECT_EQ(*s.top(), i);
+            s.pop();
+        }
+        EXPECT_TRUE(s.empty());
+        EXPECT_FALSE(s.try_pop().has_value());
+    }
+}   /* namespace dsa */
+
+#endif /* SMALL_VECTOR_TEST_H */
@@ -0,0 +1,197 @@
+/**
+ * @file    SnapshotTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A container snapshot save/load test
+*/
+
+#ifndef SNAPSHOT_TEST_H
+#define SNAPSHOT_TEST_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <gtest/gtest.h>
+
+#include "Checksum.h"
+#include "Deque.h"
+#include "DoublyLinkedList.h"
+#include "queue.h"
+#include "Snapshot.h"
+#include "Stack.h"
+
+namespace dsa {
+    struct snapshot_point {
+        std::int32_t x;
+        std::int64_t y;
+    };
+
+    struct snapshot_person {
+        std::string name;
+        int age;
+    };
+
+    template <>
+    struct snapshot_traits<snapshot_person> {
+        static constexpr std::uint32_t version = 2;
+
+        static void write(snapshot_writer& w, const snapshot_person& p) {
+            snapshot_traits<std::string>::write(w, p.name);
+            w.write(static_cast<std::int32_t>(p.age));
+        }
+
+        static snapshot_person read(snapshot_reader& r) {
+            std::string name = snapshot_traits<std::string>::read(r);
+            return snapshot_person{std::move(name), r.read<std::int32_t>()};
+        }
+    };
+
+    class SnapshotTest : public testing::Test {
+        protected:
+            std::filesystem::path file;
+
+        public:
+            SnapshotTest() {}
+            virtual ~SnapshotTest() {}
+            virtual void SetUp() {
+                file = std::filesystem::temp_directory_path() /
+                       ("dsa-snapshot-" + std::to_string(::getpid()) + "-" +
+                        testing::UnitTest::GetInstance()->current_test_info()->name());
+            }
+            virtual void TearDown() { std::filesystem::remove(file); }
+    };
+
+    TEST_F(SnapshotTest, testListStream) {
+        doubly_linked_list<int> list;
+        for (int i = 0; i < 100000; ++i) list.push_back(i * 3);
+        std::stringstream ss;
+        save_snapshot(ss, list);
+
+        doubly_linked_list<int> loaded{7, 8, 9};
+        load_snapshot(ss, loaded);
+        EXPECT_EQ(loaded.size(), list.size());
+        EXPECT_TRUE(std::equal(loaded.begin(), loaded.end(), list.begin()));
+        EXPECT_LE(loaded.memory_usage().allocations, 8u);          // one slab per 64 KiB chunk, not one node each
+
+        doubly_linked_list<int> empty;
+        std::stringstream es;
+        save_snapshot(es, empty);
+        load_snapshot(es, loaded);
+        EXPECT_TRUE(loaded.empty());
+    }
+
+    TEST_F(SnapshotTest, testDequeFileAndDescriptor) {
+        deque<snapshot_point> d;
+        for (int i = 0; i < 50000; ++i) d.push_back(snapshot_point{i, -i * 1000000007LL});
+        save_snapshot(file, d);
+        EXPECT_FALSE(std::filesystem::exists(file.string() + ".tmp"));
+
+        deque<snapshot_point> mapped;
+        load_snapshot(file, mapped);
+        ASSERT_EQ(mapped.size(), d.size());
+        for (std::size_t i = 0; i < d.size(); ++i) ASSERT_TRUE(mapped[i].x == d[i].x && mapped[i].y == d[i].y);
+
+        const int fd = ::open(file.c_str(), O_RDONLY);
+        ASSERT_GE(fd, 0);
+        deque<snapshot_point> read;
+        load_snapshot(fd, read);
+        ::close(fd);
+        ASSERT_EQ(read.size(), d.size());
+        EXPECT_EQ(read.back().y, d.back().y);
+    }
+
+    TEST_F(SnapshotTest, testAdaptors) {
+        stack<int> s;
+        queue<int> q;
+        for (int i = 0; i < 1000; ++i) s.push(i), q.push(i);
+        std::stringstream ss, qs;
+        save_snapshot(ss, s);
+        save_snapshot(qs, q);
+
+        stack<int> s2;
+        queue<int> q2;
+        load_snapshot(ss, s2);
+        load_snapshot(qs, q2);
+        EXPECT_EQ(s2.size(), 1000u);
+        EXPECT_EQ(s2.top(), 999);
+        EXPECT_EQ(q2.front(), 0);
+        EXPECT_EQ(q2.back(), 999);
+    }
+
+    TEST_F(SnapshotTest, testCustomTraits) {
+        doubly_linked_list<std::string> words{"", "a", std::string(100000, 'z'), "tail"};
+        save_snapshot(file, words);
+        doubly_linked_list<std::string> loaded;
+        load_snapshot(file, loaded);
+        EXPECT_TRUE(std::equal(loaded.begin(), loaded.end(), words.begin(), words.end()));
+
+        deque<snapshot_person> people;
+        for (int i = 0; i < 5000; ++i) people.push_back(snapshot_person{"person " + std::to_string(i), i % 90});
+        std::stringstream ss;
+        save_snapshot(ss, people);
+        deque<snapshot_person> back;
+        load_snapshot(ss, back);
+        ASSERT_EQ(back.size(), people.size());
+        EXPECT_EQ(back[4321].name, "person 4321");
+        EXPECT_EQ(back[4321].age, 4321 % 90);
+    }
+
+    TEST_F(SnapshotTest, testRejectsBadInput) {
+        doubly_linked_list<int> list{1, 2, 3, 4, 5};
+        std::stringstream ss;
+        save_snapshot(ss, list);
+        const std::string bytes = ss.str();
+        doubly_linked_list<int> target{42};
+
+        auto load = [&](const std::string& b, auto& c) {
+            std::stringstream in{b};
+            load_snapshot(in, c);
+        };
+        std::string corrupt = bytes;
+        corrupt[80] ^= 1;                                           // first payload byte
+        EXPECT_THROW(load(corrupt, target), std::runtime_error);
+        corrupt = bytes;
+        corrupt[31] ^= 0x10;                                        // high byte of the element count
+        EXPECT_THROW(load(corrupt, target), std::runtime_error);
+        EXPECT_THROW(load(bytes.substr(0, bytes.size() - 20), target), std::runtime_error);
+        EXPECT_THROW(load("not a snapshot at all, definitely not", target), std::runtime_error);
+        doubly_linked_list<long> wider;
+        EXPECT_THROW(load(bytes, wider), std::runtime_error);       // element size differs
+        doubly_linked_list<std::string> strings;
+        EXPECT_THROW(load(bytes, strings), std::runtime_error);     // bitwise vs serialized
+        EXPECT_EQ(target.size(), 1u);                               // unchanged after every failure
+        EXPECT_EQ(target.front(), 42);
+    }
+
+    TEST_F(SnapshotTest, testHugeCountWithValidHeader) {
+        std::vector<int> values{1, 2, 3, 4, 5};
+        std::stringstream ss;
+        save_snapshot(ss, values);
+        std::string bytes = ss.str();
+
+        /* A count that passes the header CRC still cannot reserve more than the file holds */
+        const std::uint64_t count = std::uint64_t{1} << 36;
+        std::memcpy(bytes.data() + 24, &count, sizeof(count));
+        const std::uint32_t crc = crc32(bytes.data(), 32);
+        std::memcpy(bytes.data() + 32, &crc, sizeof(crc));
+        std::FILE* out = std::fopen(file.c_str(), "wb");
+        ASSERT_NE(out, nullptr);
+        std::fwrite(bytes.data(), 1, bytes.size(), out);
+        std::fclose(out);
+
+        std::vector<int> target;
+        EXPECT_THROW(load_snapshot(file, target), std::runtime_error);
+        const int fd = ::open(file.c_str(), O_RDONLY);
+        EXPECT_THROW(load_snapshot(fd, target), std::runtime_error);
+        ::close(fd);
+    }
+}   /* namespace dsa */
+
+#endif /* SNAPSHOT_TEST_H */
@@ -0,0 +1,144 @@
+/**
+ * @file    TimerWheelTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A hierarchical timer wheel test
+*/
+
+#ifndef TIMER_WHEEL_TEST_H
+#define TIMER_WHEEL_TEST_H
+
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "TimerWheel.h"
+
+namespace dsa {
+    class TimerWheelTest : public testing::Test {
+        protected:
+            timer_wheel<int> my_wheel;
+            std::vector<std::pair<std::uint64_t, int>> fired;
+
+            auto recorder() {
+                return [this](int& id) { fired.emplace_back(my_wheel.now() - 1, id); };
+            }
+
+        public:
+            TimerWheelTest() {}
+            virtual ~TimerWheelTest() {}
+            virtual void SetUp() {}
+            virtual void TearDown() {}
+    };
+
+    TEST_F(TimerWheelTest, testEmptyWheel) {
+        EXPECT_TRUE(my_wheel.empty());
+        EXPECT_EQ(my_wheel.advance(1000000, recorder()), 0);
+        EXPECT_EQ(my_wheel.now(), 1000001);
+    }
+
+    TEST_F(TimerWheelTest, testFireAtExpiry) {
+        my_wheel.schedule(5, 1);
+        my_wheel.schedule(300, 2);
+        my_wheel.schedule(70000, 3);
+        my_wheel.schedule(5, 4);
+        EXPECT_EQ(my_wheel.size(), 4);
+
+        EXPECT_EQ(my_wheel.advance(4, recorder()), 0);
+        EXPECT_EQ(my_wheel.advance(299, recorder()), 2);
+        EXPECT_EQ(my_wheel.advance(100000, recorder()), 2);
+        EXPECT_TRUE(my_wheel.empty());
+
+        std::vector<std::pair<std::uint64_t, int>> expected{{5, 1}, {5, 4}, {300, 2}, {70000, 3}};
+        EXPECT_EQ(fired, expected);
+    }
+
+    TEST_F(TimerWheelTest, testCancelAfterCascade) {
+        auto h = my_wheel.schedule(1000, 1);
+        my_wheel.schedule(1001, 2);
+        my_wheel.advance(999, recorder());          /* 1000 now sits on level 0 */
+        EXPECT_EQ(h.expiry(), 1000);
+        EXPECT_EQ(h.payload(), 1);
+        my_wheel.cancel(h);
+        my_wheel.advance(2000, recorder());
+        ASSERT_EQ(fired.size(), 1);
+        EXPECT_EQ(fired[0].second, 2);
+    }
+
+    TEST_F(TimerWheelTest, testBeyondTopLevel) {
+        timer_wheel<int, 2> small;                  /* covers 65536 ticks */
+        small.schedule(200000, 1);
+        small.schedule(65537, 2);
+        std::vector<std::uint64_t> at;
+        small.advance(1000000, [&](int&) { at.push_back(small.now() - 1); });
+        EXPECT_EQ(at, (std::vector<std::uint64_t>{65537, 200000}));
+    }
+
+    TEST_F(TimerWheelTest, testScheduleFromCallback) {
+        my_wheel.schedule(10, 1);
+        my_wheel.advance(100, [this](int& id) {
+            fired.emplace_back(my_wheel.now() - 1, id);
+            if (id < 5) my_wheel.schedule(0, id + 1);         /* in the past: fires on the next tick */
+        });
+        ASSERT_EQ(fired.size(), 5);
+        EXPECT_EQ(fired.back(), (std::pair<std::uint64_t, int>{14, 5}));
+    }
+
+    TEST_F(TimerWheelTest, testCancelFromCallback) {
+        timer_wheel<int>::handle first = my_wheel.schedule(5, 1);
+        timer_wheel<int>::handle second = my_wheel.schedule(5, 2);
+        my_wheel.schedule(5, 3);
+        my_wheel.schedule(6, 4);
+        EXPECT_EQ(my_wheel.advance(5, [&](int& id) {
+            fired.emplace_back(my_wheel.now() - 1, id);
+            if (id == 1) {
+                my_wheel.cancel(second);                    /* same tick, not fired yet: dropped */
+                my_wheel.cancel(first);                     /* the running timer: no effect */
+            }
+        }), 2);
+        EXPECT_EQ(fired, (std::vector<std::pair<std::uint64_t, int>>{{5, 1}, {5, 3}}));
+        EXPECT_EQ(my_wheel.size(), 1);
+
+        EXPECT_EQ(my_wheel.advance(10, recorder()), 1);
+        EXPECT_EQ(fired.back(), (std::pair<std::uint64_t, int>{6, 4}));
+        EXPECT_TRUE(my_wheel.empty());
+    }
+
+    TEST_F(TimerWheelTest, testRandomAgainstMultimap) {
+        std::mt19937_64 rng{42};
+        std::multimap<std::uint64_t, int> reference;
+        std::vector<std::pair<timer_wheel<int>::handle, std::multimap<std::uint64_t, int>::iterator>> live;
+
+        std::uint64_t now = 0;
+        for (int id = 0; id < 20000; ++id) {
+            const std::uint64_t expiry = my_wheel.now() + rng() % (id % 7 == 0 ? 50000000 : 3000);
+            live.emplace_back(my_wheel.schedule(expiry, id), reference.emplace(expiry, id));
+            if (id % 5 == 0) {
+                const std::size_t victim = rng() % live.size();
+                my_wheel.cancel(live[victim].first);
+                reference.erase(live[victim].second);
+                live[victim] = live.back();
+                live.pop_back();
+            }
+            if (id % 50 == 0) {
+                now += rng() % 500;
+                my_wheel.advance(now, recorder());
+                live.clear();                               /* handles may have fired */
+            }
+        }
+        my_wheel.advance(now + 100000000, recorder());
+        EXPECT_TRUE(my_wheel.empty());
+
+        ASSERT_EQ(fired.size(), reference.size());
+        auto it = reference.begin();
+        for (const auto& f : fired) {
+            EXPECT_EQ(f.first, it->first);
+            ++it;
+        }
+    }
+}   /* namespace dsa */
+
+#endif /* TIMER_WHEEL_TEST_H */
@@ -0,0 +1,81 @@
+/**
+ * @file    TrailStackTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A checkpoint/rollback trail stack test
+*/
+
+#ifndef TRAIL_STACK_TEST_H
+#define TRAIL_STACK_TEST_H
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "TrailStack.h"
+
+namespace dsa {
+    class TrailStackTest : public testing::Test {
+        protected:
+            trail_stack<std::pair<int, int>, 4> my_trail;       // (variable, old value)
+
+        public:
+            TrailStackTest() {}
+            virtual ~TrailStackTest() {}
+            virtual void SetUp() {}
+            virtual void TearDown() {}
+    };
+
+    TEST_F(TrailStackTest, testRollback) {
+        auto root = my_trail.mark();
+        my_trail.push({0, 1});
+        auto level1 = my_trail.mark();
+        for (int i = 1; i <= 10; ++i) my_trail.emplace(i, -i);
+        EXPECT_EQ(my_trail.since(level1), 10);
+        EXPECT_EQ(level1.depth(), 1);
+
+        my_trail.rollback(level1);
+        EXPECT_EQ(my_trail.size(), 1);
+        EXPECT_EQ(my_trail.top(), (std::pair<int, int>{0, 1}));
+        EXPECT_EQ(my_trail.mark(), level1);
+
+        my_trail.rollback(root);
+        EXPECT_TRUE(my_trail.empty());
+    }
+
+    TEST_F(TrailStackTest, testUndoCallback) {
+        std::vector<int> values(8, 0);
+        auto assign = [&](int var, int value) {
+            my_trail.emplace(var, values[var]);
+            values[var] = value;
+        };
+
+        assign(0, 5);
+        auto cp = my_trail.mark();
+        assign(1, 7);
+        assign(0, 9);
+        assign(2, 3);
+        std::vector<int> undone;
+        my_trail.rollback(cp, [&](std::pair<int, int>& entry) {
+            undone.push_back(entry.first);
+            values[entry.first] = entry.second;
+        });
+        EXPECT_EQ(undone, (std::vector<int>{2, 0, 1}));
+        EXPECT_EQ(values, (std::vector<int>{5, 0, 0, 0, 0, 0, 0, 0}));
+        EXPECT_EQ(my_trail.size(), 1);
+    }
+
+    TEST_F(TrailStackTest, testNonTrivialElements) {
+        trail_stack<std::string, 2> names;
+        auto cp = names.mark();
+        for (int i = 0; i < 20; ++i) names.push(std::string(40, 'a' + i));
+        const std::size_t capacity = names.memory_usage().total();
+        names.rollback(cp);
+        EXPECT_TRUE(names.empty());
+        EXPECT_EQ(names.memory_usage().total(), capacity);      /* capacity is kept for the next descent */
+    }
+}   /* namespace dsa */
+
+#endif /* TRAIL_STACK_TEST_H */
@@ -0,0 +1,134 @@
+/**
+ * @file    UniqueQueueTest.h
+ * @author  Toan Dang, dangnhattoan@gmail.com
+ * @date    Oct 19, 2026
+ * @version 0.1
+ * @brief   A deduplicating FIFO queue test
+*/
+
+#ifndef UNIQUE_QUEUE_TEST_H
+#define UNIQUE_QUEUE_TEST_H
+
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "UniqueQueue.h"
+
+namespace dsa {
+    class UniqueQueueTest : public testing::Test {
+        public:
+            UniqueQueueTest() {}
+            virtual ~UniqueQueueTest() {}
+            virtual void SetUp() {}
+            virtual void TearDown() {}
+    };
+
+    /* an invalidation: the same work item for every mask of one id */
+    struct invalidation {
+        int id;
+        std::uint32_t mask;
+    };
+
+    struct invalidation_hash {
+        std::size_t operator()(const invalidation& a) const noexcept { return std::hash<int>{}(a.id); }
+    };
+
+    struct invalidation_equal {
+        bool operator()(const invalidation& a, const invalidation& b) const noexcept { return a.id == b.id; }
+    };
+
+    TEST_F(UniqueQueueTest, testMergeKeepsOrder) {
+        unique_queue<std::string> q;
+        EXPECT_EQ(q.pop(), std::nullopt);
+        EXPECT_TRUE(q.push("a"));
+        EXPECT_TRUE(q.push("b"));
+        EXPECT_FALSE(q.push("a"));
+        EXPECT_TRUE(q.push("c"));
+        EXPECT_FALSE(q.push("b"));
+        EXPECT_EQ(q.size(), 3u);
+        EXPECT_EQ(q.merged(), 2u);
+        EXPECT_TRUE(q.contains("b"));
+        EXPECT_FALSE(q.contains("d"));
+        EXPECT_EQ(q.front(), "a");
+
+        EXPECT_EQ(q.pop(), "a");
+        EXPECT_FALSE(q.contains("a"));
+        EXPECT_TRUE(q.push("a"));                                   // no longer pending, queued again
+        EXPECT_EQ(q.pop(), "b");
+        EXPECT_EQ(q.pop(), "c");
+        EXPECT_EQ(q.pop(), "a");
+        EXPECT_TRUE(q.empty());
+
+        q.push("x");
+        q.clear();
+        EXPECT_TRUE(q.empty());
+        EXPECT_FALSE(q.contains("x"));
+        EXPECT_EQ(q.merged(), 2u);
+    }
+
+    TEST_F(UniqueQueueTest, testCoalesce) {
+        unique_queue<invalidation, invalidation_hash, invalidation_equal> q;
+        auto merge_masks = [](invalidation& pending, invalidation&& x) { pending.mask |= x.mask; };
+        EXPECT_TRUE(q.push({1, 0b001}, merge_masks));
+        EXPECT_TRUE(q.push({2, 0b010}, merge_masks));
+        EXPECT_FALSE(q.push({1, 0b100}, merge_masks));
+        EXPECT_FALSE(q.push({1, 0b010}));                   // plain push keeps the pending entry
+        ASSERT_NE(q.find({1, 0}), nullptr);
+        EXPECT_EQ(q.find({1, 0})->mask, 0b101u);
+        EXPECT_EQ(q.find({3, 0}), nullptr);
+
+        std::optional<invalidation> x = q.pop();
+        ASSERT_TRUE(x);
+        EXPECT_EQ(x->id, 1);
+        EXPECT_EQ(x->mask, 0b101u);
+        EXPECT_FALSE(q.push({2, 0b001}, merge_masks));      // found after the front moved on
+        EXPECT_EQ(q.front().mask, 0b011u);
+    }
+
+    TEST_F(UniqueQueueTest, testFrontOnEmptyQueue) {
+        unique_queue<int> q;
+        EXPECT_THROW(q.front(), std::runtime_error);
+        q.push(1);
+        EXPECT_EQ(q.front(), 1);
+        q.pop();
+        EXPECT_THROW(q.front(), std::runtime_error);
+
+        using unchecked = unique_queue<int, std::hash<int>, std::equal_to<int>, deque<int>, unchecked_policy>;
+        static_assert(std::is_same_v<unchecked::error_policy, unchecked_policy>);
+        unchecked u;
+        u.push(2);
+        EXPECT_EQ(u.front(), 2);
+    }
+
+    TEST_F(UniqueQueueTest, testInvalidationStorm) {
+        unique_queue<int> q;
+        std::vector<int> expected;
+        std::uint64_t pushes = 0;
+        for (int round = 0; round < 50; ++round) {
+            for (int k = 0; k < 1000; ++k, ++pushes) {
+                if (q.push(k * 7 % 1000)) expected.push_back(k * 7 % 1000);
+            }
+            if (round % 10 == 9) {                                  // a worker drains a third
+                for (int i = 0; i < 333; ++i) {
+                    EXPECT_EQ(*q.pop(), expected.front());
+                    expected.erase(expected.begin());
+                }
+            }
+        }
+        EXPECT_EQ(q.size(), expected.size());
+        EXPECT_EQ(q.merged() + expected.size() + 5 * 333, pushes);
+        for (int k : expected) EXPECT_EQ(*q.pop(), k);
+        EXPECT_TRUE(q.empty());
+
+        memory_footprint m = q.memory_usage();
+        EXPECT_EQ(m.payload_bytes, 0u);
+        EXPECT_GT(m.overhead_bytes, 0u);
+    }
+}   /* namespace dsa */
+
+#endif /* UNIQUE_QUEUE_TEST_H */